@@ -0,0 +1,139 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <random>
+#include <span>
+#include <string>
+
+#include "mavlink/archive.hpp"
+#include "mavlink/deserializer.hpp"
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/global_position_int.hpp"
+#include "mavlink/payloads/sys_status.hpp"
+#include "mavlink/serializer.hpp"
+#include "mavlink/tlog.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+constexpr auto Seconds = std::uint32_t{3 * 3600};
+
+struct Paths {
+    std::string tlog;
+    std::string archive;
+};
+
+// Writes (once) a three hour flight of 10 Hz ATTITUDE, GLOBAL_POSITION_INT and SYS_STATUS from two systems, as a tlog
+// and as an archive.
+const Paths& flight_paths() {
+    static const auto paths = [] {
+        auto directory = std::filesystem::temp_directory_path();
+        auto paths = Paths{(directory / "avionicpp_benchmark_flight.tlog").string(),
+                           (directory / "avionicpp_benchmark_flight.mavarch").string()};
+        std::filesystem::remove(paths.tlog);
+        std::filesystem::remove(paths.tlog + ".idx");
+        auto tlog = TlogWriter{paths.tlog};
+        if (!tlog.open()) {
+            return paths;
+        }
+        auto archive = ArchiveWriter<Attitude, GlobalPositionInt, SysStatus>{};
+        auto rng = std::mt19937{1};
+        auto noise = std::normal_distribution<float>{0.0f, 0.002f};
+        auto buffer = std::array<std::uint8_t, 280>{};
+        for (auto tick = std::uint32_t{0}; tick < Seconds * 10; ++tick) {
+            auto timestamp = std::uint64_t{1'700'000'000'000'000} + tick * 100'000ULL;
+            auto append = [&](auto length) {
+                auto frame = std::span<const std::uint8_t>(buffer).first(*length);
+                [[maybe_unused]] auto written = tlog.write(frame, timestamp);
+                archive.add(parse_frame(frame), timestamp);
+            };
+            for (auto sysid : {std::uint8_t{1}, std::uint8_t{2}}) {
+                auto att = Attitude{};
+                att.time_boot_ms.value = tick * 100;
+                att.roll.value = 0.2f * std::sin(static_cast<float>(tick) / 300.0f) + noise(rng);
+                att.pitch.value = 0.05f + noise(rng);
+                att.yaw.value = std::fmod(static_cast<float>(tick) / 2000.0f, 6.28f);
+                append(serialize(att, sysid, 1, 0, buffer));
+
+                auto pos = GlobalPositionInt{};
+                pos.time_boot_ms.value = tick * 100;
+                pos.lat.value = 473'977'420 + static_cast<std::int32_t>(tick / 2);
+                pos.lon.value = 85'455'940 - static_cast<std::int32_t>(tick / 3);
+                pos.alt.value = 500'000 + static_cast<std::int32_t>(tick % 50);
+                pos.relative_alt.value = 100'000;
+                pos.hdg.value = 9000;
+                append(serialize(pos, sysid, 1, 0, buffer));
+
+                auto sys = SysStatus{};
+                sys.voltage_battery.value = static_cast<std::uint16_t>(16800 - tick / 100);
+                sys.battery_remaining.value = static_cast<std::int8_t>(100 - tick / 3000);
+                append(serialize(sys, sysid, 1, 0, buffer));
+            }
+        }
+        [[maybe_unused]] auto written = archive.write(paths.archive);
+        return paths;
+    }();
+    return paths;
+}
+
+}  // namespace
+
+// ATTITUDE roll of sysid 1 over the whole flight, from the archive.
+static void BM_Mavlink_Archive_ReadField(benchmark::State& state) {
+    auto reader = ArchiveReader{flight_paths().archive};
+    [[maybe_unused]] auto opened = reader.open();
+    const auto* table = reader.find_table(Attitude::MessageId, 1);
+    if (table == nullptr) {
+        state.SkipWithError("Archive not written");
+        return;
+    }
+    auto column = reader.columns(*table)[3];
+
+    for (auto _ : state) {
+        auto roll = reader.field<Attitude, 1>(*table);
+        benchmark::DoNotOptimize(roll);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * table->rows));
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * column.length));
+    state.counters["compression"] = static_cast<double>(std::filesystem::file_size(flight_paths().tlog)) /
+                                    static_cast<double>(std::filesystem::file_size(flight_paths().archive));
+}
+BENCHMARK(BM_Mavlink_Archive_ReadField)->Unit(benchmark::kMillisecond);
+
+// The same field through the tlog index, deserializing every ATTITUDE of sysid 1.
+static void BM_Mavlink_Archive_ReadField_Tlog(benchmark::State& state) {
+    auto reader = TlogReader{flight_paths().tlog};
+    [[maybe_unused]] auto opened = reader.open();
+    auto rows = std::size_t{0};
+
+    for (auto _ : state) {
+        auto roll = std::vector<float>{};
+        rows = reader.query(TlogQuery{Attitude::MessageId, 1}, [&](const TlogRecord& record) {
+            roll.push_back(deserialize<LazyAttitude>(record.view)->roll.value);
+        });
+        benchmark::DoNotOptimize(roll);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * rows));
+}
+BENCHMARK(BM_Mavlink_Archive_ReadField_Tlog)->Unit(benchmark::kMillisecond);
+
+// Encoding the whole flight.
+static void BM_Mavlink_Archive_Encode(benchmark::State& state) {
+    auto tlog = TlogReader{flight_paths().tlog};
+    [[maybe_unused]] auto opened = tlog.open();
+    auto archive = ArchiveWriter<Attitude, GlobalPositionInt, SysStatus>{};
+    tlog.query(TlogQuery{}, [&](const TlogRecord& record) { archive.add(record); });
+
+    for (auto _ : state) {
+        auto bytes = archive.encode();
+        benchmark::DoNotOptimize(bytes);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * tlog.bytes().size()));
+}
+BENCHMARK(BM_Mavlink_Archive_Encode)->Unit(benchmark::kMillisecond);
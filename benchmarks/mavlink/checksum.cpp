@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "mavlink/checksum.hpp"
+#include "mavlink/crc_kernels.hpp"
+
+using namespace mavlink;
+
+namespace {
+
+const std::vector<std::uint8_t>& payload() {
+    static const auto bytes = [] {
+        auto rng = std::mt19937{1};
+        auto data = std::vector<std::uint8_t>(280);
+        for (auto& b : data) {
+            b = static_cast<std::uint8_t>(rng());
+        }
+        return data;
+    }();
+    return bytes;
+}
+
+template <typename Kernel>
+void run_crc_benchmark(benchmark::State& state, Kernel kernel) {
+    auto bytes = std::span<const std::uint8_t>(payload()).first(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto crc = std::uint16_t{0xFFFF};
+        benchmark::DoNotOptimize(bytes.data());
+        kernel(crc, bytes);
+        benchmark::DoNotOptimize(crc);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes.size()));
+}
+
+}  // namespace
+
+static void BM_Mavlink_Crc_Bytewise(benchmark::State& state) {
+    run_crc_benchmark(state, [](std::uint16_t& crc, std::span<const std::uint8_t> bytes) {
+        for (auto b : bytes) {
+            crc_accumulate(b, crc);
+        }
+    });
+}
+BENCHMARK(BM_Mavlink_Crc_Bytewise)->Arg(10)->Arg(32)->Arg(64)->Arg(128)->Arg(280);
+
+static void BM_Mavlink_Crc_Table(benchmark::State& state) {
+    run_crc_benchmark(state, [](std::uint16_t& crc, std::span<const std::uint8_t> bytes) {
+        crc_accumulate_table(crc, bytes);
+    });
+}
+BENCHMARK(BM_Mavlink_Crc_Table)->Arg(10)->Arg(32)->Arg(64)->Arg(128)->Arg(280);
+
+static void BM_Mavlink_Crc_Slice4(benchmark::State& state) {
+    run_crc_benchmark(state, [](std::uint16_t& crc, std::span<const std::uint8_t> bytes) {
+        crc_accumulate_sliced<4>(crc, bytes);
+    });
+}
+BENCHMARK(BM_Mavlink_Crc_Slice4)->Arg(10)->Arg(32)->Arg(64)->Arg(128)->Arg(280);
+
+static void BM_Mavlink_Crc_Slice8(benchmark::State& state) {
+    run_crc_benchmark(state, [](std::uint16_t& crc, std::span<const std::uint8_t> bytes) {
+        crc_accumulate_sliced<8>(crc, bytes);
+    });
+}
+BENCHMARK(BM_Mavlink_Crc_Slice8)->Arg(10)->Arg(32)->Arg(64)->Arg(128)->Arg(280);
+
+#if defined(AVIONICPP_CRC_CLMUL)
+static void BM_Mavlink_Crc_Clmul(benchmark::State& state) {
+    if (!crc_clmul_supported()) {
+        state.SkipWithError("PCLMULQDQ not supported");
+        return;
+    }
+    run_crc_benchmark(state, [](std::uint16_t& crc, std::span<const std::uint8_t> bytes) {
+        crc_accumulate_clmul(crc, bytes);
+    });
+}
+BENCHMARK(BM_Mavlink_Crc_Clmul)->Arg(10)->Arg(32)->Arg(64)->Arg(128)->Arg(280);
+#endif
+
+static void BM_Mavlink_Crc_Buffer(benchmark::State& state) {
+    run_crc_benchmark(state, [](std::uint16_t& crc, std::span<const std::uint8_t> bytes) {
+        crc_accumulate_buffer(crc, reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    });
+}
+BENCHMARK(BM_Mavlink_Crc_Buffer)->Arg(10)->Arg(32)->Arg(64)->Arg(128)->Arg(280);
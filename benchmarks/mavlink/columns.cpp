@@ -0,0 +1,132 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <expected>
+#include <random>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "mavlink/columns.hpp"
+#include "mavlink/deserializer.hpp"
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/global_position_int.hpp"
+#include "mavlink/payloads/raw_imu.hpp"
+#include "mavlink/serializer.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+constexpr auto Messages = std::size_t{4096};
+
+// Serializes a batch of messages with random field values back to back, and returns the stream with views into it.
+template <typename MessageT>
+struct Batch {
+    std::vector<std::uint8_t> stream;
+    std::vector<MessageView> views;
+
+    Batch() {
+        auto rng = std::mt19937{1};
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto offsets = std::vector<std::size_t>{};
+        for ([[maybe_unused]] auto i : std::views::iota(std::size_t{0}, Messages)) {
+            auto message = MessageT{};
+            boost::pfr::for_each_field(message, [&](auto& field) {
+                using ValueType = typename std::remove_cvref_t<decltype(field)>::ValueType;
+                field.value = static_cast<ValueType>(rng() % 1000 + 1);
+            });
+            auto length = serialize(message, 1, 1, 0, buffer);
+            offsets.push_back(stream.size());
+            stream.insert(stream.end(), buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(*length));
+        }
+        for (auto offset : offsets) {
+            auto frame = std::span<const std::uint8_t>(stream).subspan(offset);
+            views.push_back(parse_frame(frame.first(*frame_length(frame))));
+        }
+    }
+};
+
+// One deserialize per message into an array of structs.
+template <typename MessageT, typename LazyT>
+void run_decode_per_message_benchmark(benchmark::State& state) {
+    static const auto batch = Batch<MessageT>{};
+    auto decoded = std::vector<std::expected<LazyT, MavlinkError>>{};
+    decoded.reserve(Messages);
+
+    for (auto _ : state) {
+        decoded.clear();
+        for (const auto& view : batch.views) {
+            decoded.push_back(deserialize<LazyT>(view));
+        }
+        benchmark::DoNotOptimize(decoded.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Messages));
+}
+
+// The same messages decoded into columns.
+template <typename MessageT>
+void run_decode_columns_benchmark(benchmark::State& state) {
+    static const auto batch = Batch<MessageT>{};
+    auto columns = PayloadColumns<MessageT>{};
+
+    for (auto _ : state) {
+        boost::pfr::for_each_field(columns, [](auto& column) { column.values.clear(); });
+        auto decoded = decode_columns<MessageT>(batch.views, columns);
+        benchmark::DoNotOptimize(decoded);
+        benchmark::DoNotOptimize(columns);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Messages));
+}
+
+// One float column out of a block of ATTITUDE payloads, with each gather kernel.
+template <bool Simd>
+void run_gather_column_benchmark(benchmark::State& state) {
+    constexpr auto Stride = calculate_payload_length<Attitude>(boost::pfr::tuple_size_v<Attitude>);
+    auto block = std::array<std::uint8_t, ColumnBlockRows * Stride + ColumnBlockSlack>{};
+    auto column = std::array<float, ColumnBlockRows>{};
+#if defined(AVIONICPP_COLUMNS_AVX2)
+    if (Simd && !columns_avx2_supported()) {
+        state.SkipWithError("AVX2 is not supported");
+        return;
+    }
+#else
+    if (Simd) {
+        state.SkipWithError("AVX2 kernels are not built on this target");
+        return;
+    }
+#endif
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(block);
+#if defined(AVIONICPP_COLUMNS_AVX2)
+        if constexpr (Simd) {
+            gather_column_avx2<float>(block, Stride, 4, column);
+        } else {
+            gather_column_scalar<float>(block, Stride, 4, column);
+        }
+#else
+        gather_column_scalar<float>(block, Stride, 4, column);
+#endif
+        benchmark::DoNotOptimize(column);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * ColumnBlockRows));
+}
+
+}  // namespace
+
+BENCHMARK(run_decode_per_message_benchmark<Attitude, LazyAttitude>)
+    ->Name("BM_Mavlink_DecodeBatch_Attitude/PerMessage");
+BENCHMARK(run_decode_columns_benchmark<Attitude>)->Name("BM_Mavlink_DecodeBatch_Attitude/Columns");
+BENCHMARK(run_decode_per_message_benchmark<RawImu, LazyRawImu>)->Name("BM_Mavlink_DecodeBatch_RawImu/PerMessage");
+BENCHMARK(run_decode_columns_benchmark<RawImu>)->Name("BM_Mavlink_DecodeBatch_RawImu/Columns");
+BENCHMARK(run_decode_per_message_benchmark<GlobalPositionInt, LazyGlobalPositionInt>)
+    ->Name("BM_Mavlink_DecodeBatch_GlobalPositionInt/PerMessage");
+BENCHMARK(run_decode_columns_benchmark<GlobalPositionInt>)->Name("BM_Mavlink_DecodeBatch_GlobalPositionInt/Columns");
+
+BENCHMARK(run_gather_column_benchmark<false>)->Name("BM_Mavlink_GatherColumn_Float/Scalar");
+BENCHMARK(run_gather_column_benchmark<true>)->Name("BM_Mavlink_GatherColumn_Float/Avx2");
@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include "mavlink/dispatcher.hpp"
+#include "mavlink/types.hpp"
+
+using namespace mavlink;
+
+namespace {
+
+/// @brief Minimal payload with a synthetic msgid, to register arbitrarily many message types.
+template <std::uint32_t Id>
+struct SyntheticPayload {
+    static constexpr std::uint32_t MessageId = Id;
+    RxField<std::uint32_t> value;
+};
+
+// msgids spread over the 24-bit range, like a dialect with many vendor messages
+constexpr std::uint32_t synthetic_msgid(std::size_t index) {
+    return static_cast<std::uint32_t>((index * 7919U + 13U) % (1U << 24));
+}
+
+template <typename IndexSequence>
+struct SyntheticDispatcher;
+
+template <std::size_t... I>
+struct SyntheticDispatcher<std::index_sequence<I...>> {
+    using Type = Dispatcher<SyntheticPayload<synthetic_msgid(I)>...>;
+
+    // the if/else chain this replaces
+    template <typename Visitor>
+    static bool dispatch_linear(const MessageView& view, Visitor&& visitor) {
+        return ((view.msgid == synthetic_msgid(I)
+                     ? (std::invoke(visitor, deserialize<SyntheticPayload<synthetic_msgid(I)>>(view)), true)
+                     : false) ||
+                ...);
+    }
+};
+
+template <std::size_t Count>
+using Synthetic = SyntheticDispatcher<std::make_index_sequence<Count>>;
+
+// One view per registered msgid, visited round-robin.
+template <std::size_t Count>
+std::vector<MessageView> make_views(const std::array<std::uint8_t, 4>& payload) {
+    auto views = std::vector<MessageView>(Count);
+    for (auto index : std::views::iota(std::size_t{0}, Count)) {
+        views[index].msgid = synthetic_msgid(index);
+        views[index].payload = payload;
+    }
+    return views;
+}
+
+template <std::size_t Count, bool Linear>
+void run_dispatch_benchmark(benchmark::State& state) {
+    constexpr auto payload = std::array<std::uint8_t, 4>{1, 2, 3, 4};
+    auto views = make_views<Count>(payload);
+    auto sum = std::uint64_t{0};
+    auto visitor = [&](const auto& result) { sum += result->value.value; };
+
+    for (auto _ : state) {
+        for (const auto& view : views) {
+            if constexpr (Linear) {
+                benchmark::DoNotOptimize(Synthetic<Count>::dispatch_linear(view, visitor));
+            } else {
+                benchmark::DoNotOptimize(Synthetic<Count>::Type::dispatch(view, visitor));
+            }
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * views.size()));
+}
+
+}  // namespace
+
+BENCHMARK(run_dispatch_benchmark<5, false>)->Name("BM_Mavlink_Dispatch_Hashed/5");
+BENCHMARK(run_dispatch_benchmark<25, false>)->Name("BM_Mavlink_Dispatch_Hashed/25");
+BENCHMARK(run_dispatch_benchmark<200, false>)->Name("BM_Mavlink_Dispatch_Hashed/200");
+BENCHMARK(run_dispatch_benchmark<5, true>)->Name("BM_Mavlink_Dispatch_Linear/5");
+BENCHMARK(run_dispatch_benchmark<25, true>)->Name("BM_Mavlink_Dispatch_Linear/25");
+BENCHMARK(run_dispatch_benchmark<200, true>)->Name("BM_Mavlink_Dispatch_Linear/200");
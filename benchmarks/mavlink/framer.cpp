@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/common_messages.hpp"
+#include "mavlink/payloads/heartbeat.hpp"
+#include "mavlink/payloads/sys_status.hpp"
+#include "mavlink/serializer.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+// Builds a ~1 MiB stream of back-to-back ATTITUDE, SYS_STATUS and HEARTBEAT frames.
+std::vector<std::uint8_t> make_stream() {
+    auto att = Attitude{};
+    att.time_boot_ms.value = 12345678;
+    att.roll.value = 1.0f;
+    att.pitch.value = -1.0f;
+    att.yaw.value = 0.5f;
+    att.rollspeed.value = 0.1f;
+    att.pitchspeed.value = -0.1f;
+    att.yawspeed.value = 0.5f;
+
+    auto sys = SysStatus{};
+    sys.onboard_control_sensors_present.value = 10;
+    sys.load.value = 500;
+    sys.voltage_battery.value = 11000;
+    sys.battery_remaining.value = 80;
+
+    auto hb = Heartbeat{};
+    hb.custom_mode.value = 7;
+    hb.type.value = MavType::QUADROTOR;
+    hb.mavlink_version.value = 3;
+
+    auto stream = std::vector<std::uint8_t>{};
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto append = [&](auto len) { stream.insert(stream.end(), buffer.begin(), buffer.begin() + *len); };
+    auto seq = std::uint8_t{0};
+    while (stream.size() < (1U << 20)) {
+        append(serialize(att, 1, 1, seq++, buffer));
+        append(serialize(sys, 1, 1, seq++, buffer));
+        append(serialize(hb, 1, 1, seq++, buffer));
+    }
+    return stream;
+}
+
+const std::vector<std::uint8_t>& stream() {
+    static const auto bytes = make_stream();
+    return bytes;
+}
+
+}  // namespace
+
+static void BM_Mavlink_Framer_PushByte(benchmark::State& state) {
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto buffer_span = std::span<std::uint8_t>(buffer);
+    auto framer = create_framer(&buffer_span);
+    const auto& bytes = stream();
+
+    for (auto _ : state) {
+        auto frames = std::size_t{0};
+        for (auto b : bytes) {
+            if (auto result = framer.push_byte(b); result && result->has_value()) {
+                ++frames;
+            }
+        }
+        benchmark::DoNotOptimize(frames);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes.size()));
+}
+BENCHMARK(BM_Mavlink_Framer_PushByte);
+
+static void BM_Mavlink_Framer_PushBytes(benchmark::State& state) {
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto buffer_span = std::span<std::uint8_t>(buffer);
+    auto framer = create_framer(&buffer_span);
+    const auto chunk_size = static_cast<std::size_t>(state.range(0));
+    const auto& bytes = stream();
+
+    for (auto _ : state) {
+        auto frames = std::size_t{0};
+        auto remaining = std::span<const std::uint8_t>(bytes);
+        while (!remaining.empty()) {
+            auto chunk = remaining.first(std::min(chunk_size, remaining.size()));
+            framer.push_bytes(chunk, [&](const Framer::ParseResult& result) { frames += result.has_value(); });
+            remaining = remaining.subspan(chunk.size());
+        }
+        benchmark::DoNotOptimize(frames);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes.size()));
+}
+BENCHMARK(BM_Mavlink_Framer_PushBytes)->Arg(64)->Arg(512)->Arg(4096);
+
+// Creating and destroying a framer, as a server does per connection: with its coroutine frame from the heap, or from
+// a pool resource reused across connections.
+static void BM_Mavlink_Framer_Create(benchmark::State& state, bool pooled) {
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto buffer_span = std::span<std::uint8_t>(buffer);
+    auto pool = std::pmr::unsynchronized_pool_resource{};
+    auto* resource = pooled ? static_cast<std::pmr::memory_resource*>(&pool) : std::pmr::new_delete_resource();
+
+    for (auto _ : state) {
+        auto framer = create_framer(std::allocator_arg, resource, &buffer_span, FramerOptions{CommonMessages::Entries});
+        benchmark::DoNotOptimize(framer.handle);
+    }
+}
+BENCHMARK_CAPTURE(BM_Mavlink_Framer_Create, heap, false);
+BENCHMARK_CAPTURE(BM_Mavlink_Framer_Create, pool, true);
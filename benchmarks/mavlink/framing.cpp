@@ -0,0 +1,217 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "mavlink/framer.hpp"
+#include "mavlink/msgid_filter.hpp"
+#include "mavlink/payloads/common_messages.hpp"
+#include "mavlink/synthetic_stream.hpp"
+
+// C Library headers
+#include <common/mavlink.h>
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+// Message mixes, by payload size.
+enum class Mix {
+    Small,      ///< Payloads of at most 16 bytes: HEARTBEAT, SYSTEM_TIME, acks, pressures.
+    Large,      ///< Payloads of 32 bytes and more: GPS_STATUS, commands, AUTOPILOT_VERSION, ...
+    Telemetry,  ///< Every common message at typical autopilot rates, from two systems.
+};
+
+constexpr auto StreamSize = std::size_t{4} << 20;
+constexpr auto Seed = std::uint64_t{2024};
+
+std::vector<std::uint8_t> make_stream(Mix mix) {
+    switch (mix) {
+        case Mix::Small: {
+            auto generator = SyntheticStream<Heartbeat,
+                                             SystemTime,
+                                             ChangeOperatorControlAck,
+                                             ParamRequestList,
+                                             RawPressure,
+                                             ScaledPressure,
+                                             CommandAck>{Seed};
+            generator.set_rates(10.0);
+            return generator.generate(StreamSize);
+        }
+        case Mix::Large: {
+            auto generator = SyntheticStream<AuthKey,
+                                             GpsStatus,
+                                             AttitudeQuaternion,
+                                             CommandInt,
+                                             CommandLong,
+                                             AutopilotVersion>{Seed};
+            generator.set_rates(10.0);
+            return generator.generate(StreamSize);
+        }
+        case Mix::Telemetry:
+        default: {
+            auto generator = CommonSyntheticStream{Seed, SyntheticFaults{}, 2};
+            return generator.generate(StreamSize);
+        }
+    }
+}
+
+// A clean multi-megabyte stream per mix, generated once.
+const std::vector<std::uint8_t>& stream(Mix mix) {
+    static const auto streams =
+        std::array{make_stream(Mix::Small), make_stream(Mix::Large), make_stream(Mix::Telemetry)};
+    return streams[static_cast<std::size_t>(mix)];
+}
+
+// Messages the framer accepts in one pass over a stream.
+std::uint64_t framer_count(std::span<const std::uint8_t> bytes) {
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto buffer_span = std::span<std::uint8_t>(buffer);
+    auto framer = create_framer(&buffer_span, FramerOptions{CommonMessages::Entries});
+    auto messages = std::uint64_t{0};
+    framer.push_bytes(bytes, [&](const Framer::ParseResult& result) { messages += result.has_value(); });
+    return messages;
+}
+
+// Messages the C library accepts in one pass over a stream, on a channel the benchmarks do not use.
+std::uint64_t parse_char_count(std::span<const std::uint8_t> bytes) {
+    mavlink_message_t msg;
+    mavlink_status_t status;
+    auto messages = std::uint64_t{0};
+    for (auto b : bytes) {
+        messages += mavlink_parse_char(MAVLINK_COMM_1, b, &msg, &status) == MAVLINK_FRAMING_OK;
+    }
+    return messages;
+}
+
+// Whether both parsers accept every message of a mix, so that their rates compare the same work.
+bool parsers_agree(Mix mix) {
+    static const auto agree = [] {
+        auto result = std::array<bool, 3>{};
+        for (auto m : {Mix::Small, Mix::Large, Mix::Telemetry}) {
+            result[static_cast<std::size_t>(m)] = framer_count(stream(m)) == parse_char_count(stream(m));
+        }
+        return result;
+    }();
+    return agree[static_cast<std::size_t>(mix)];
+}
+
+// Skips a benchmark whose mix the two parsers disagree on.
+bool check_parsers_agree(benchmark::State& state, Mix mix) {
+    if (!parsers_agree(mix)) {
+        state.SkipWithError("The framer and mavlink_parse_char accept different numbers of messages");
+        return false;
+    }
+    return true;
+}
+
+// bytes/s, messages/s and the time per message, from totals over all iterations.
+void set_counters(benchmark::State& state, std::size_t bytes, std::uint64_t messages) {
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+    state.counters["msgs/s"] = benchmark::Counter(static_cast<double>(messages), benchmark::Counter::kIsRate);
+    state.counters["time/msg"] = benchmark::Counter(static_cast<double>(messages),
+                                                    benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+}  // namespace
+
+static void BM_Mavlink_Framing_PushBytes(benchmark::State& state, Mix mix) {
+    if (!check_parsers_agree(state, mix)) {
+        return;
+    }
+    const auto& bytes = stream(mix);
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto buffer_span = std::span<std::uint8_t>(buffer);
+    auto framer = create_framer(&buffer_span, FramerOptions{CommonMessages::Entries});
+    auto messages = std::uint64_t{0};
+
+    for (auto _ : state) {
+        framer.push_bytes(bytes, [&](const Framer::ParseResult& result) { messages += result.has_value(); });
+    }
+    set_counters(state, bytes.size(), messages);
+}
+BENCHMARK_CAPTURE(BM_Mavlink_Framing_PushBytes, small, Mix::Small);
+BENCHMARK_CAPTURE(BM_Mavlink_Framing_PushBytes, large, Mix::Large);
+BENCHMARK_CAPTURE(BM_Mavlink_Framing_PushBytes, telemetry, Mix::Telemetry);
+
+static void BM_Mavlink_Framing_PushByte(benchmark::State& state, Mix mix) {
+    if (!check_parsers_agree(state, mix)) {
+        return;
+    }
+    const auto& bytes = stream(mix);
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto buffer_span = std::span<std::uint8_t>(buffer);
+    auto framer = create_framer(&buffer_span, FramerOptions{CommonMessages::Entries});
+    auto messages = std::uint64_t{0};
+
+    for (auto _ : state) {
+        for (auto b : bytes) {
+            if (auto result = framer.push_byte(b); result && result->has_value()) {
+                ++messages;
+            }
+        }
+    }
+    set_counters(state, bytes.size(), messages);
+}
+BENCHMARK_CAPTURE(BM_Mavlink_Framing_PushByte, small, Mix::Small);
+BENCHMARK_CAPTURE(BM_Mavlink_Framing_PushByte, large, Mix::Large);
+BENCHMARK_CAPTURE(BM_Mavlink_Framing_PushByte, telemetry, Mix::Telemetry);
+
+// Framing with a msgid filter that lets through only ATTITUDE, GLOBAL_POSITION_INT and VFR_HUD, as a companion
+// computer tracking the vehicle state would. With the message table, the other frames are checksummed before they are
+// skipped (push_byte() also copies them into the working buffer); without it, they are skipped unread. msgs/s counts
+// the yielded frames.
+static void BM_Mavlink_Framing_Filtered(benchmark::State& state, bool bulk, bool checked) {
+    const auto& bytes = stream(Mix::Telemetry);
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto buffer_span = std::span<std::uint8_t>(buffer);
+    const auto filter = MsgidFilter::of<Attitude, GlobalPositionInt, VfrHud>();
+    auto messages = checked ? std::span<const MessageInfo>(CommonMessages::Entries) : std::span<const MessageInfo>{};
+    auto framer = create_framer(&buffer_span, FramerOptions{.messages = messages, .filter = filter});
+    auto yielded = std::uint64_t{0};
+
+    for (auto _ : state) {
+        if (bulk) {
+            framer.push_bytes(bytes, [&](const Framer::ParseResult& result) { yielded += result.has_value(); });
+        } else {
+            for (auto b : bytes) {
+                if (auto result = framer.push_byte(b); result && result->has_value()) {
+                    ++yielded;
+                }
+            }
+        }
+    }
+    set_counters(state, bytes.size(), yielded);
+    state.counters["filtered/s"] =
+        benchmark::Counter(static_cast<double>(framer.filtered()), benchmark::Counter::kIsRate);
+}
+BENCHMARK_CAPTURE(BM_Mavlink_Framing_Filtered, push_bytes, true, true);
+BENCHMARK_CAPTURE(BM_Mavlink_Framing_Filtered, push_byte, false, true);
+BENCHMARK_CAPTURE(BM_Mavlink_Framing_Filtered, push_bytes_unchecked, true, false);
+BENCHMARK_CAPTURE(BM_Mavlink_Framing_Filtered, push_byte_unchecked, false, false);
+
+// The reference: the C library's byte-at-a-time parser, which also checks CRC_EXTRA.
+static void BM_Mavlink_Framing_ParseChar(benchmark::State& state, Mix mix) {
+    if (!check_parsers_agree(state, mix)) {
+        return;
+    }
+    const auto& bytes = stream(mix);
+    mavlink_message_t msg;
+    mavlink_status_t status;
+    auto messages = std::uint64_t{0};
+
+    for (auto _ : state) {
+        for (auto b : bytes) {
+            if (mavlink_parse_char(MAVLINK_COMM_0, b, &msg, &status) == MAVLINK_FRAMING_OK) {
+                ++messages;
+            }
+        }
+    }
+    set_counters(state, bytes.size(), messages);
+}
+BENCHMARK_CAPTURE(BM_Mavlink_Framing_ParseChar, small, Mix::Small);
+BENCHMARK_CAPTURE(BM_Mavlink_Framing_ParseChar, large, Mix::Large);
+BENCHMARK_CAPTURE(BM_Mavlink_Framing_ParseChar, telemetry, Mix::Telemetry);
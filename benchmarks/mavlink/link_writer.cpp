@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "mavlink/link_writer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/serializer.hpp"
+#include "uart/uart.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+/// @brief UART writing to /dev/null, so every write is a real syscall without a device behind it.
+class NullUART {
+   public:
+    using native_handle_type = int;
+
+    explicit NullUART([[maybe_unused]] std::string_view devicename) : handle_(::open("/dev/null", O_WRONLY)) {}
+    ~NullUART() { ::close(handle_); }
+    NullUART(const NullUART&) = delete;
+    NullUART(NullUART&&) = delete;
+    auto operator=(const NullUART&) = delete;
+    auto operator=(NullUART&&) = delete;
+
+    [[nodiscard]] auto write(const std::ranges::sized_range auto& buffer)
+        -> std::expected<std::size_t, std::pair<int, std::string>> {
+        auto result = ::write(handle_, std::ranges::cdata(buffer), std::ranges::size(buffer));
+        if (result < 0) {
+            return std::unexpected<std::pair<int, std::string>>{std::make_pair(errno, std::strerror(errno))};
+        }
+        return static_cast<std::size_t>(result);
+    }
+
+   private:
+    int handle_;
+};
+
+void set_rate_counters(benchmark::State& state, std::uint64_t frames, std::uint64_t writes) {
+    state.counters["frames/s"] = benchmark::Counter(static_cast<double>(frames), benchmark::Counter::kIsRate);
+    state.counters["syscalls/s"] = benchmark::Counter(static_cast<double>(writes), benchmark::Counter::kIsRate);
+}
+
+}  // namespace
+
+// One serialize and one UART write per frame, with the sequence number kept by hand.
+static void BM_Mavlink_Write_Attitude_PerFrame(benchmark::State& state) {
+    auto port = uart::UART<NullUART>(std::make_shared<NullUART>(""));
+    auto att = Attitude{};
+    att.time_boot_ms.value = 12345678;
+    att.yaw.value = 0.5f;
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto seq = std::uint8_t{0};
+    auto frames = std::uint64_t{0};
+
+    for (auto _ : state) {
+        auto length = serialize(att, 1, 1, seq++, buffer);
+        auto written = port.write(std::span(buffer).first(*length));
+        benchmark::DoNotOptimize(written);
+        ++frames;
+    }
+    set_rate_counters(state, frames, frames);
+}
+BENCHMARK(BM_Mavlink_Write_Attitude_PerFrame);
+
+// Frames batched by a LinkWriter, flushed with one UART write per full batch.
+static void BM_Mavlink_Write_Attitude_LinkWriter(benchmark::State& state) {
+    auto port = uart::UART<NullUART>(std::make_shared<NullUART>(""));
+    auto writer = LinkWriter<NullUART>(port, 1, 1, std::chrono::milliseconds{5});
+    auto att = Attitude{};
+    att.time_boot_ms.value = 12345678;
+    att.yaw.value = 0.5f;
+    auto now = LinkWriter<NullUART>::Clock::now();
+
+    for (auto _ : state) {
+        auto flushed = writer.write(att, now);
+        benchmark::DoNotOptimize(flushed);
+    }
+    set_rate_counters(state, writer.stats().frames, writer.stats().writes);
+}
+BENCHMARK(BM_Mavlink_Write_Attitude_LinkWriter);
@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include "mavlink/framer.hpp"
+#include "mavlink/outbound_queue.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/command_long.hpp"
+#include "mavlink/payloads/param_value.hpp"
+#include "uart/settings.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+using namespace std::chrono_literals;
+
+namespace {
+
+using Queue = OutboundQueue<64>;
+
+/// @brief Ten simulated seconds of a saturated 57600 baud radio link, stepped every millisecond: five systems
+///        stream ATTITUDE at 50 Hz, a parameter download streams PARAM_VALUE at 100 Hz, and a COMMAND_LONG is sent
+///        every 100 ms. Together they offer about twice what the link carries.
+/// @tparam Prioritized Whether frames are pushed in their classes with ATTITUDE coalesced per system, or all in one
+///                     FIFO class.
+template <bool Prioritized>
+void run_saturated_link_benchmark(benchmark::State& state) {
+    auto latencies = std::vector<double>{};
+    auto commands = std::uint64_t{0};
+    auto sent = std::uint64_t{0};
+
+    for (auto _ : state) {
+        auto queue = Queue{uart::BaudRate::b57600};
+        auto pushed_at = std::array<Queue::Clock::time_point, 256>{};
+        auto start = Queue::Clock::time_point{} + 1000s;
+        auto att = Attitude{};
+        att.yaw.value = 0.5f;
+        auto param = ParamValue{};
+        param.param_type.value = 9;
+        auto command = CommandLong{};
+        command.command.value = 400;
+        auto seq = std::uint8_t{0};
+        latencies.clear();
+        commands = 0;
+
+        auto priority = [](OutboundPriority wanted) { return Prioritized ? wanted : OutboundPriority::Bulk; };
+        auto coalesce = Prioritized ? CoalescePolicy::Replace : CoalescePolicy::Keep;
+
+        for (auto ms : std::views::iota(0, 10'000)) {
+            auto now = start + std::chrono::milliseconds{ms};
+            if (ms % 20 == 0) {
+                for (auto sysid : std::views::iota(1, 6)) {
+                    queue.push(att, static_cast<std::uint8_t>(sysid), 1, seq++, priority(OutboundPriority::Telemetry),
+                               now, coalesce);
+                }
+            }
+            if (ms % 10 == 0) {
+                queue.push(param, 1, 1, seq++, priority(OutboundPriority::Bulk), now);
+            }
+            if (ms % 100 == 0) {
+                pushed_at[seq] = now;
+                queue.push(command, 255, 190, seq++, priority(OutboundPriority::Command), now);
+                ++commands;
+            }
+            queue.send(now, [&](std::span<const std::uint8_t> frame) {
+                auto view = parse_frame(frame);
+                if (view.msgid == CommandLong::MessageId) {
+                    latencies.push_back(std::chrono::duration<double, std::milli>(now - pushed_at[view.seq]).count());
+                }
+            });
+        }
+        sent = queue.stats().sent;
+        benchmark::DoNotOptimize(latencies);
+    }
+
+    std::ranges::sort(latencies);
+    auto percentile = [&](double p) {
+        return latencies.empty() ? 0.0 : latencies[static_cast<std::size_t>(p * (latencies.size() - 1))];
+    };
+    state.counters["cmd_p50_ms"] = percentile(0.5);
+    state.counters["cmd_p99_ms"] = percentile(0.99);
+    state.counters["cmd_lost"] = static_cast<double>(commands - latencies.size());
+    state.counters["frames_sent"] = static_cast<double>(sent);
+}
+
+}  // namespace
+
+BENCHMARK(run_saturated_link_benchmark<true>)->Name("BM_Mavlink_OutboundQueue_SaturatedLink/Prioritized");
+BENCHMARK(run_saturated_link_benchmark<false>)->Name("BM_Mavlink_OutboundQueue_SaturatedLink/Fifo");
@@ -0,0 +1,218 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include "mavlink/deserializer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/autopilot_version.hpp"
+#include "mavlink/payloads/sys_status.hpp"
+#include "mavlink/serializer.hpp"
+
+#include <common/mavlink.h>
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+Attitude make_attitude() {
+    auto att = Attitude{};
+    att.time_boot_ms.value = 12345678;
+    att.roll.value = 1.0f;
+    att.pitch.value = -1.0f;
+    att.yaw.value = 0.5f;
+    att.rollspeed.value = 0.1f;
+    att.pitchspeed.value = -0.1f;
+    att.yawspeed.value = 0.5f;
+    return att;
+}
+
+SysStatus make_sys_status() {
+    auto sys = SysStatus{};
+    sys.onboard_control_sensors_present.value = 10;
+    sys.onboard_control_sensors_enabled.value = 10;
+    sys.onboard_control_sensors_health.value = 10;
+    sys.load.value = 500;
+    sys.voltage_battery.value = 11000;
+    sys.current_battery.value = 100;
+    sys.drop_rate_comm.value = 1;
+    sys.errors_comm.value = 2;
+    sys.errors_count1.value = 3;
+    sys.errors_count2.value = 4;
+    sys.errors_count3.value = 5;
+    sys.errors_count4.value = 6;
+    sys.battery_remaining.value = 80;
+    return sys;
+}
+
+constexpr auto CustomVersion = std::array<std::uint8_t, 8>{1, 2, 3, 4, 5, 6, 7, 8};
+constexpr auto Uid2 = std::array<std::uint8_t, 18>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18};
+
+AutopilotVersion make_autopilot_version() {
+    auto version = AutopilotVersion{};
+    version.capabilities.value = 0xFFFF;
+    version.uid.value = 0x0102030405060708;
+    version.flight_sw_version.value = 0x01020304;
+    version.middleware_sw_version.value = 0x05060708;
+    version.os_sw_version.value = 0x090A0B0C;
+    version.board_version.value = 0x0D0E0F10;
+    version.vendor_id.value = 0x1234;
+    version.product_id.value = 0x5678;
+    version.flight_custom_version.value = CustomVersion;
+    version.middleware_custom_version.value = CustomVersion;
+    version.os_custom_version.value = CustomVersion;
+    version.uid2.value = Uid2;
+    return version;
+}
+
+// Payload copy only, so the memcpy path is compared against the per-field PFR loop it replaces.
+template <auto Make, bool Bulk>
+void run_serialize_payload_benchmark(benchmark::State& state) {
+    auto message = Make();
+    auto payload = std::array<std::uint8_t, 255>{};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(message);
+        if constexpr (Bulk) {
+            benchmark::DoNotOptimize(serialize_payload(message, payload));
+        } else {
+            benchmark::DoNotOptimize(serialize_payload_fields(message, payload));
+        }
+        benchmark::DoNotOptimize(payload);
+    }
+}
+
+template <auto Make, bool Bulk>
+void run_deserialize_payload_benchmark(benchmark::State& state) {
+    auto payload = std::array<std::uint8_t, 255>{};
+    auto length = serialize_payload(Make(), payload);
+    auto view = std::span<const std::uint8_t>(payload).first(length);
+    auto message = decltype(Make()){};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(view);
+        if constexpr (Bulk) {
+            deserialize_payload(view, message);
+        } else {
+            deserialize_payload_fields(view, message);
+        }
+        benchmark::DoNotOptimize(message);
+    }
+}
+
+}  // namespace
+
+BENCHMARK(run_serialize_payload_benchmark<make_attitude, true>)->Name("BM_Mavlink_SerializePayload_Attitude/Memcpy");
+BENCHMARK(run_serialize_payload_benchmark<make_attitude, false>)->Name("BM_Mavlink_SerializePayload_Attitude/Fields");
+BENCHMARK(run_serialize_payload_benchmark<make_sys_status, true>)
+    ->Name("BM_Mavlink_SerializePayload_SysStatus/Memcpy");
+BENCHMARK(run_serialize_payload_benchmark<make_sys_status, false>)
+    ->Name("BM_Mavlink_SerializePayload_SysStatus/Fields");
+BENCHMARK(run_serialize_payload_benchmark<make_autopilot_version, true>)
+    ->Name("BM_Mavlink_SerializePayload_AutopilotVersion/Memcpy");
+BENCHMARK(run_serialize_payload_benchmark<make_autopilot_version, false>)
+    ->Name("BM_Mavlink_SerializePayload_AutopilotVersion/Fields");
+
+BENCHMARK(run_deserialize_payload_benchmark<make_attitude, true>)
+    ->Name("BM_Mavlink_DeserializePayload_Attitude/Memcpy");
+BENCHMARK(run_deserialize_payload_benchmark<make_attitude, false>)
+    ->Name("BM_Mavlink_DeserializePayload_Attitude/Fields");
+BENCHMARK(run_deserialize_payload_benchmark<make_sys_status, true>)
+    ->Name("BM_Mavlink_DeserializePayload_SysStatus/Memcpy");
+BENCHMARK(run_deserialize_payload_benchmark<make_sys_status, false>)
+    ->Name("BM_Mavlink_DeserializePayload_SysStatus/Fields");
+BENCHMARK(run_deserialize_payload_benchmark<make_autopilot_version, true>)
+    ->Name("BM_Mavlink_DeserializePayload_AutopilotVersion/Memcpy");
+BENCHMARK(run_deserialize_payload_benchmark<make_autopilot_version, false>)
+    ->Name("BM_Mavlink_DeserializePayload_AutopilotVersion/Fields");
+
+// --- Full frames of AUTOPILOT_VERSION (ATTITUDE and SYS_STATUS are in main.cpp) ---
+
+static void BM_Mavlink_Serialize_AutopilotVersion(benchmark::State& state) {
+    auto version = make_autopilot_version();
+    auto buffer = std::array<std::uint8_t, MaxFrameLength<AutopilotVersion>>{};
+
+    for (auto _ : state) {
+        auto res = serialize(version, 1, 1, 0, std::span(buffer));
+        benchmark::DoNotOptimize(res);
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+BENCHMARK(BM_Mavlink_Serialize_AutopilotVersion);
+
+static void BM_Mavlink_Deserialize_AutopilotVersion(benchmark::State& state) {
+    auto buffer = std::array<std::uint8_t, MaxFrameLength<AutopilotVersion>>{};
+    auto length = serialize(make_autopilot_version(), 1, 1, 0, std::span(buffer));
+
+    auto view = MessageView{};
+    view.msgid = AutopilotVersion::MessageId;
+    view.payload =
+        std::span<const std::uint8_t>(buffer).subspan(HeaderLengthV2, length - HeaderLengthV2 - ChecksumLength);
+
+    for (auto _ : state) {
+        auto res = deserialize<LazyAutopilotVersion>(view);
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK(BM_Mavlink_Deserialize_AutopilotVersion);
+
+static void BM_MavlinkC_Serialize_AutopilotVersion(benchmark::State& state) {
+    mavlink_message_t msg;
+    std::array<uint8_t, 280> buffer;
+
+    for (auto _ : state) {
+        mavlink_msg_autopilot_version_pack(1, 1, &msg, 0xFFFF, 0x01020304, 0x05060708, 0x090A0B0C, 0x0D0E0F10,
+                                           CustomVersion.data(), CustomVersion.data(), CustomVersion.data(), 0x1234,
+                                           0x5678, 0x0102030405060708, Uid2.data());
+
+        uint16_t len = mavlink_msg_to_send_buffer(buffer.data(), &msg);
+        benchmark::DoNotOptimize(len);
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+BENCHMARK(BM_MavlinkC_Serialize_AutopilotVersion);
+
+static void BM_MavlinkC_Deserialize_AutopilotVersion(benchmark::State& state) {
+    mavlink_message_t msg;
+    mavlink_msg_autopilot_version_pack(1, 1, &msg, 0xFFFF, 0x01020304, 0x05060708, 0x090A0B0C, 0x0D0E0F10,
+                                       CustomVersion.data(), CustomVersion.data(), CustomVersion.data(), 0x1234, 0x5678,
+                                       0x0102030405060708, Uid2.data());
+
+    mavlink_autopilot_version_t version;
+
+    for (auto _ : state) {
+        mavlink_msg_autopilot_version_decode(&msg, &version);
+        benchmark::DoNotOptimize(version);
+    }
+}
+BENCHMARK(BM_MavlinkC_Deserialize_AutopilotVersion);
+
+// --- A consumer reading only time_boot_ms and yaw, from an eager copy and from a lazy view ---
+
+template <typename Payload>
+void run_read_two_fields_benchmark(benchmark::State& state) {
+    auto buffer = std::array<std::uint8_t, MaxFrameLength<Attitude>>{};
+    auto length = serialize(make_attitude(), 1, 1, 0, std::span(buffer));
+
+    auto view = MessageView{};
+    view.msgid = Attitude::MessageId;
+    view.payload =
+        std::span<const std::uint8_t>(buffer).subspan(HeaderLengthV2, length - HeaderLengthV2 - ChecksumLength);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(view);
+        auto res = deserialize<Payload>(view);
+        if constexpr (ViewPayload<Payload>) {
+            benchmark::DoNotOptimize(res->time_boot_ms.value());
+            benchmark::DoNotOptimize(res->yaw.value());
+        } else {
+            benchmark::DoNotOptimize(res->time_boot_ms.value);
+            benchmark::DoNotOptimize(res->yaw.value);
+        }
+    }
+}
+
+BENCHMARK(run_read_two_fields_benchmark<LazyAttitude>)->Name("BM_Mavlink_ReadTwoFields_Attitude/Eager");
+BENCHMARK(run_read_two_fields_benchmark<ViewAttitude>)->Name("BM_Mavlink_ReadTwoFields_Attitude/View");
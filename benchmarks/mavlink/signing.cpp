@@ -0,0 +1,123 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/common_messages.hpp"
+#include "mavlink/serializer.hpp"
+#include "mavlink/sha256.hpp"
+#include "mavlink/signing.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+constexpr auto Key = SecretKey{0x42, 0x17, 0x99};
+
+Attitude make_attitude() {
+    auto att = Attitude{};
+    att.time_boot_ms.value = 12345678;
+    att.roll.value = 1.0f;
+    att.pitch.value = -1.0f;
+    att.yaw.value = 0.5f;
+    att.rollspeed.value = 0.1f;
+    att.pitchspeed.value = -0.1f;
+    att.yawspeed.value = 0.5f;
+    return att;
+}
+
+// Builds a ~1 MiB stream of signed ATTITUDE frames with increasing timestamps.
+std::vector<std::uint8_t> make_signed_stream() {
+    auto signer = Signer{Key, 1};
+    auto att = make_attitude();
+    auto stream = std::vector<std::uint8_t>{};
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto seq = std::uint8_t{0};
+    while (stream.size() < (1U << 20)) {
+        auto len = serialize(att, 1, 1, seq++, buffer, signer);
+        stream.insert(stream.end(), buffer.begin(), buffer.begin() + *len);
+    }
+    return stream;
+}
+
+const std::vector<std::uint8_t>& signed_stream() {
+    static const auto bytes = make_signed_stream();
+    return bytes;
+}
+
+template <auto Compress>
+void run_sha256_benchmark(benchmark::State& state) {
+    auto message = std::vector<std::uint8_t>(static_cast<std::size_t>(state.range(0)), 0x5A);
+    for (auto _ : state) {
+        auto sha = Sha256<Compress>{};
+        sha.update(message);
+        auto digest = sha.finalize();
+        benchmark::DoNotOptimize(digest);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * message.size()));
+}
+
+}  // namespace
+
+static void BM_Mavlink_Sha256_Portable(benchmark::State& state) {
+    run_sha256_benchmark<sha256_compress_portable>(state);
+}
+BENCHMARK(BM_Mavlink_Sha256_Portable)->Arg(64)->Arg(128)->Arg(312);
+
+#if defined(AVIONICPP_SHA_NI)
+static void BM_Mavlink_Sha256_ShaNi(benchmark::State& state) {
+    if (!sha256_sha_ni_supported()) {
+        state.SkipWithError("SHA extensions not supported");
+        return;
+    }
+    run_sha256_benchmark<sha256_compress_sha_ni>(state);
+}
+BENCHMARK(BM_Mavlink_Sha256_ShaNi)->Arg(64)->Arg(128)->Arg(312);
+#endif
+
+static void BM_Mavlink_Signing_Serialize_Attitude(benchmark::State& state) {
+    auto att = make_attitude();
+    auto signer = Signer{Key, 1};
+    auto buffer = std::array<std::uint8_t, 280>{};
+
+    for (auto _ : state) {
+        auto len = serialize(att, 1, 1, 0, buffer, signer);
+        benchmark::DoNotOptimize(len);
+        benchmark::DoNotOptimize(buffer);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Mavlink_Signing_Serialize_Attitude);
+
+static void BM_Mavlink_Signing_PushBytes(benchmark::State& state) {
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto buffer_span = std::span<std::uint8_t>(buffer);
+    const auto& bytes = signed_stream();
+
+    auto frames = std::size_t{0};
+    for (auto _ : state) {
+        // a fresh verifier per pass, otherwise every frame after the first pass is a replay
+        auto streams = std::array<SigningStream, 4>{};
+        auto verifier = SignatureVerifier{Key, streams};
+        auto options = FramerOptions{CommonMessages::Entries};
+        options.signing = verifier;
+        auto framer = create_framer(&buffer_span, options);
+
+        auto remaining = std::span<const std::uint8_t>(bytes);
+        while (!remaining.empty()) {
+            auto chunk = remaining.first(std::min(std::size_t{4096}, remaining.size()));
+            framer.push_bytes(chunk, [&](const Framer::ParseResult& result) { frames += result.has_value(); });
+            remaining = remaining.subspan(chunk.size());
+        }
+        benchmark::DoNotOptimize(frames);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes.size()));
+    state.SetItemsProcessed(static_cast<std::int64_t>(frames));
+}
+BENCHMARK(BM_Mavlink_Signing_PushBytes);
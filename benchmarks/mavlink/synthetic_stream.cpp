@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/common_messages.hpp"
+#include "mavlink/synthetic_stream.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+// Each fault of SyntheticFaults drawn with the same probability, given in per mille.
+SyntheticFaults faults(std::int64_t per_mille) {
+    auto probability = static_cast<double>(per_mille) / 1000.0;
+    return SyntheticFaults{probability, probability, probability, probability, 64};
+}
+
+// ~1 MiB of every common message from two systems at typical rates.
+struct Stream {
+    std::vector<std::uint8_t> bytes;
+    SyntheticStats stats;
+};
+
+Stream make_stream(std::int64_t per_mille) {
+    auto generator = CommonSyntheticStream{2024, faults(per_mille), 2};
+    auto bytes = generator.generate(1 << 20);
+    return Stream{std::move(bytes), generator.stats()};
+}
+
+// frames/s counts valid frames; recovered is the share of intact frames the framer got out of the noise.
+void set_counters(benchmark::State& state, const Stream& stream, std::uint64_t frames, std::uint64_t errors) {
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * stream.bytes.size()));
+    state.counters["frames/s"] = benchmark::Counter(static_cast<double>(frames), benchmark::Counter::kIsRate);
+    state.counters["errors/s"] = benchmark::Counter(static_cast<double>(errors), benchmark::Counter::kIsRate);
+    state.counters["recovered"] = static_cast<double>(frames) /
+                                  static_cast<double>(state.iterations() * stream.stats.intact_frames);
+}
+
+}  // namespace
+
+// The framer at full speed on realistic traffic, with each fault at Arg per mille of the frames.
+static void BM_Mavlink_Synthetic_PushBytes(benchmark::State& state) {
+    const auto stream = make_stream(state.range(0));
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto buffer_span = std::span<std::uint8_t>(buffer);
+    auto framer = create_framer(&buffer_span, FramerOptions{CommonMessages::Entries});
+    auto frames = std::uint64_t{0};
+    auto errors = std::uint64_t{0};
+
+    for (auto _ : state) {
+        framer.push_bytes(stream.bytes, [&](const Framer::ParseResult& result) {
+            frames += result.has_value();
+            errors += !result.has_value();
+        });
+    }
+    set_counters(state, stream, frames, errors);
+}
+BENCHMARK(BM_Mavlink_Synthetic_PushBytes)->Arg(0)->Arg(1)->Arg(10)->Arg(50);
+
+static void BM_Mavlink_Synthetic_PushByte(benchmark::State& state) {
+    const auto stream = make_stream(state.range(0));
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto buffer_span = std::span<std::uint8_t>(buffer);
+    auto framer = create_framer(&buffer_span, FramerOptions{CommonMessages::Entries});
+    auto frames = std::uint64_t{0};
+    auto errors = std::uint64_t{0};
+
+    for (auto _ : state) {
+        for (auto b : stream.bytes) {
+            if (auto result = framer.push_byte(b)) {
+                frames += result->has_value();
+                errors += !result->has_value();
+            }
+        }
+    }
+    set_counters(state, stream, frames, errors);
+}
+BENCHMARK(BM_Mavlink_Synthetic_PushByte)->Arg(0)->Arg(1)->Arg(10)->Arg(50);
@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <ranges>
+#include <vector>
+
+#include "mavlink/timeseries.hpp"
+
+using namespace mavlink;
+
+namespace {
+
+constexpr auto Samples = std::size_t{50 * 3600};  // an hour at 50 Hz
+constexpr auto SampleInterval = std::uint64_t{20'000};
+constexpr auto Pixels = std::size_t{1000};
+
+// An hour of altitude at 50 Hz.
+const TimeSeries& altitude() {
+    static const auto series = [] {
+        auto series = TimeSeries{Samples};
+        auto rng = std::mt19937{1};
+        auto noise = std::normal_distribution<double>{0.0, 0.3};
+        for (auto sample : std::views::iota(std::size_t{0}, Samples)) {
+            series.push(sample * SampleInterval, 100.0 + 20.0 * std::sin(static_cast<double>(sample) / 5000.0) +
+                                                     noise(rng));
+        }
+        return series;
+    }();
+    return series;
+}
+
+}  // namespace
+
+// Min/max/mean of the last range(0) minutes at one bucket per pixel, scanning every sample.
+static void BM_Mavlink_TimeSeries_Downsample_Scan(benchmark::State& state) {
+    const auto& series = altitude();
+    auto end = Samples * SampleInterval;
+    auto begin = end - static_cast<std::uint64_t>(state.range(0)) * 60'000'000;
+    auto buckets = std::vector<SeriesBucket>(Pixels);
+
+    for (auto _ : state) {
+        std::ranges::fill(buckets, SeriesBucket{});
+        for (auto index : std::views::iota(std::size_t{0}, series.size())) {
+            const auto& sample = series[index];
+            if (sample.timestamp_us >= begin && sample.timestamp_us < end) {
+                buckets[(sample.timestamp_us - begin) * Pixels / (end - begin)].add(sample.timestamp_us, sample.value);
+            }
+        }
+        benchmark::DoNotOptimize(buckets.data());
+    }
+}
+BENCHMARK(BM_Mavlink_TimeSeries_Downsample_Scan)->Arg(10)->Arg(60);
+
+// The same through the pyramid.
+static void BM_Mavlink_TimeSeries_Downsample(benchmark::State& state) {
+    const auto& series = altitude();
+    auto end = Samples * SampleInterval;
+    auto begin = end - static_cast<std::uint64_t>(state.range(0)) * 60'000'000;
+    auto buckets = std::vector<SeriesBucket>(Pixels);
+
+    for (auto _ : state) {
+        series.downsample(begin, end, buckets);
+        benchmark::DoNotOptimize(buckets.data());
+    }
+}
+BENCHMARK(BM_Mavlink_TimeSeries_Downsample)->Arg(10)->Arg(60);
+
+// LTTB decimation of the last range(0) minutes to one point per pixel.
+static void BM_Mavlink_TimeSeries_Lttb(benchmark::State& state) {
+    const auto& series = altitude();
+    auto end = Samples * SampleInterval;
+    auto begin = end - static_cast<std::uint64_t>(state.range(0)) * 60'000'000;
+    auto points = std::vector<SeriesPoint>(Pixels);
+
+    for (auto _ : state) {
+        auto picked = series.lttb(begin, end, points);
+        benchmark::DoNotOptimize(picked);
+        benchmark::DoNotOptimize(points.data());
+    }
+}
+BENCHMARK(BM_Mavlink_TimeSeries_Lttb)->Arg(10)->Arg(60);
+
+// Appending a sample to a full series.
+static void BM_Mavlink_TimeSeries_Push(benchmark::State& state) {
+    auto series = TimeSeries{Samples};
+    auto timestamp = std::uint64_t{0};
+
+    for (auto _ : state) {
+        series.push(timestamp, static_cast<double>(timestamp & 0xFF));
+        timestamp += SampleInterval;
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+BENCHMARK(BM_Mavlink_TimeSeries_Push);
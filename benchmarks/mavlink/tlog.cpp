@@ -0,0 +1,150 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <ranges>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/common_messages.hpp"
+#include "mavlink/payloads/global_position_int.hpp"
+#include "mavlink/payloads/sys_status.hpp"
+#include "mavlink/serializer.hpp"
+#include "mavlink/tlog.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+constexpr auto Seconds = std::uint64_t{3600};
+constexpr auto QueryBegin = std::uint64_t{1800} * 1'000'000;
+constexpr auto QueryEnd = std::uint64_t{1860} * 1'000'000;
+
+// Writes (once) an hour of 10 Hz ATTITUDE, GLOBAL_POSITION_INT and SYS_STATUS from two systems, ~5 MiB.
+const std::string& tlog_path() {
+    static const auto path = [] {
+        auto path = (std::filesystem::temp_directory_path() / "avionicpp_benchmark.tlog").string();
+        std::filesystem::remove(path);
+        std::filesystem::remove(path + ".idx");
+        auto writer = TlogWriter{path};
+        if (!writer.open()) {
+            return path;
+        }
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto att = Attitude{};
+        auto pos = GlobalPositionInt{};
+        auto sys = SysStatus{};
+        for (auto tick = std::uint64_t{0}; tick < Seconds * 10; ++tick) {
+            auto timestamp = tick * 100'000;
+            auto append = [&](auto length) {
+                [[maybe_unused]] auto written =
+                    writer.write(std::span<const std::uint8_t>(buffer).first(*length), timestamp);
+            };
+            for (auto sysid : {std::uint8_t{1}, std::uint8_t{2}}) {
+                pos.time_boot_ms.value = static_cast<std::uint32_t>(tick * 100);
+                append(serialize(att, sysid, 1, 0, buffer));
+                append(serialize(pos, sysid, 1, 0, buffer));
+                append(serialize(sys, sysid, 1, 0, buffer));
+            }
+        }
+        return path;
+    }();
+    return path;
+}
+
+// The benchmark tlog repeated to ~150 MiB, so every thread gets a few chunks.
+const std::vector<std::uint8_t>& large_tlog() {
+    static const auto bytes = [] {
+        auto reader = TlogReader{tlog_path()};
+        [[maybe_unused]] auto opened = reader.open();
+        auto bytes = std::vector<std::uint8_t>{};
+        bytes.reserve(32 * reader.bytes().size());
+        for ([[maybe_unused]] auto copy : std::views::iota(0, 32)) {
+            bytes.insert(bytes.end(), reader.bytes().begin(), reader.bytes().end());
+        }
+        return bytes;
+    }();
+    return bytes;
+}
+
+}  // namespace
+
+// GLOBAL_POSITION_INT of sysid 1 over one minute, by re-framing the whole tlog.
+static void BM_Mavlink_Tlog_Query_Reframe(benchmark::State& state) {
+    auto reader = TlogReader{tlog_path()};
+    [[maybe_unused]] auto opened = reader.open();
+    auto bytes = reader.bytes();
+
+    for (auto _ : state) {
+        auto found = std::size_t{0};
+        auto offset = std::size_t{0};
+        while (offset + TlogTimestampLength < bytes.size()) {
+            auto timestamp = std::uint64_t{0};
+            for (auto byte : bytes.subspan(offset, TlogTimestampLength)) {
+                timestamp = (timestamp << 8) | byte;
+            }
+            auto frame = bytes.subspan(offset + TlogTimestampLength);
+            auto length = frame_length(frame);
+            auto view = parse_frame(frame.first(*length));
+            if (view.msgid == GlobalPositionInt::MessageId && view.sysid == 1 && timestamp >= QueryBegin &&
+                timestamp < QueryEnd) {
+                benchmark::DoNotOptimize(view);
+                ++found;
+            }
+            offset += TlogTimestampLength + *length;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes.size()));
+}
+BENCHMARK(BM_Mavlink_Tlog_Query_Reframe);
+
+// The same query through the tlog index.
+static void BM_Mavlink_Tlog_Query_Indexed(benchmark::State& state) {
+    auto reader = TlogReader{tlog_path()};
+    [[maybe_unused]] auto opened = reader.open();
+
+    for (auto _ : state) {
+        auto found = reader.query(TlogQuery{GlobalPositionInt::MessageId, 1, QueryBegin, QueryEnd},
+                                  [](const TlogRecord& record) { benchmark::DoNotOptimize(record); });
+        benchmark::DoNotOptimize(found);
+    }
+}
+BENCHMARK(BM_Mavlink_Tlog_Query_Indexed);
+
+// Opening the tlog with its stored index.
+static void BM_Mavlink_Tlog_Open_StoredIndex(benchmark::State& state) {
+    auto reader = TlogReader{tlog_path()};
+    [[maybe_unused]] auto indexed = reader.open();
+
+    for (auto _ : state) {
+        auto opened = reader.open();
+        benchmark::DoNotOptimize(opened);
+    }
+    state.counters["records"] = static_cast<double>(reader.size());
+}
+BENCHMARK(BM_Mavlink_Tlog_Open_StoredIndex)->Unit(benchmark::kMillisecond);
+
+// Indexing a large tlog with checksum validation, on 1 to 16 threads.
+static void BM_Mavlink_Tlog_Scan_Threads(benchmark::State& state) {
+    const auto& tlog = large_tlog();
+    auto options = FramerOptions{CommonMessages::Entries};
+    auto threads = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        auto scan = scan_tlog(tlog, 0, options, threads);
+        benchmark::DoNotOptimize(scan);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * tlog.size()));
+}
+BENCHMARK(BM_Mavlink_Tlog_Scan_Threads)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
@@ -0,0 +1,145 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <sys/socket.h>
+
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/serializer.hpp"
+#include "uart/posixtcp.hpp"
+#include "uart/posixudp.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+constexpr auto Burst = std::size_t{64};
+
+// A burst of ATTITUDE frames, one per datagram.
+std::vector<std::vector<std::uint8_t>> make_frames() {
+    auto att = Attitude{};
+    att.time_boot_ms.value = 12345678;
+    att.roll.value = 0.1f;
+    att.pitch.value = -0.1f;
+    auto frames = std::vector<std::vector<std::uint8_t>>{};
+    auto buffer = std::array<std::uint8_t, 280>{};
+    for (auto seq = std::size_t{0}; seq < Burst; ++seq) {
+        auto length = serialize(att, 1, 1, static_cast<std::uint8_t>(seq), buffer);
+        frames.emplace_back(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(*length));
+    }
+    return frames;
+}
+
+void set_rate_counters(benchmark::State& state, std::uint64_t frames, std::uint64_t syscalls) {
+    state.counters["frames/s"] = benchmark::Counter(static_cast<double>(frames), benchmark::Counter::kIsRate);
+    state.counters["syscalls/s"] = benchmark::Counter(static_cast<double>(syscalls), benchmark::Counter::kIsRate);
+}
+
+}  // namespace
+
+// A burst over loopback UDP with one sendto and one recv per datagram, as a plain socket loop would do it.
+static void BM_Mavlink_Transport_Udp_PerDatagram(benchmark::State& state) {
+    auto ground = uart::PosixUDP{"udpin:127.0.0.1:0"};
+    [[maybe_unused]] auto listening = ground.open();
+    auto vehicle = uart::PosixUDP{"udpout:127.0.0.1:" + std::to_string(ground.port())};
+    [[maybe_unused]] auto opened = vehicle.open();
+    const auto frames = make_frames();
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto buffer_span = std::span<std::uint8_t>(buffer);
+    auto framer = create_framer(&buffer_span);
+    auto datagram = std::array<std::uint8_t, uart::UdpDatagramSize>{};
+    auto parsed = std::uint64_t{0};
+    auto syscalls = std::uint64_t{0};
+
+    for (auto _ : state) {
+        for (const auto& frame : frames) {
+            [[maybe_unused]] auto sent = vehicle.write(frame);
+        }
+        for (auto received = std::size_t{0}; received < frames.size(); ++received) {
+            auto length = ::recv(ground.native_handle(), datagram.data(), datagram.size(), 0);
+            framer.push_bytes(std::span<const std::uint8_t>(datagram).first(static_cast<std::size_t>(length)),
+                              [&](const Framer::ParseResult& result) { parsed += result.has_value(); });
+        }
+        syscalls += 2 * frames.size();
+    }
+    set_rate_counters(state, parsed, syscalls);
+}
+BENCHMARK(BM_Mavlink_Transport_Udp_PerDatagram);
+
+// The same burst through write_datagrams() and read(), a sendmmsg and a recvmmsg per UdpBatchSize datagrams.
+static void BM_Mavlink_Transport_Udp_Batched(benchmark::State& state) {
+    auto ground = uart::PosixUDP{"udpin:127.0.0.1:0"};
+    [[maybe_unused]] auto listening = ground.open();
+    auto vehicle = uart::PosixUDP{"udpout:127.0.0.1:" + std::to_string(ground.port())};
+    [[maybe_unused]] auto opened = vehicle.open();
+    const auto frames = make_frames();
+    auto datagrams = std::vector<std::span<const std::byte>>{};
+    for (const auto& frame : frames) {
+        datagrams.push_back(std::as_bytes(std::span(frame)));
+    }
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto buffer_span = std::span<std::uint8_t>(buffer);
+    auto framer = create_framer(&buffer_span);
+    auto chunk = std::array<std::uint8_t, 4096>{};
+    auto parsed = std::uint64_t{0};
+    auto syscalls = std::uint64_t{0};
+
+    for (auto _ : state) {
+        [[maybe_unused]] auto sent = vehicle.write_datagrams(datagrams);
+        auto before = parsed;
+        while (parsed - before < frames.size()) {
+            auto length = ground.read(chunk, chunk.size());
+            if (!length || *length == 0) {
+                break;
+            }
+            framer.push_bytes(std::span<const std::uint8_t>(chunk).first(*length),
+                              [&](const Framer::ParseResult& result) { parsed += result.has_value(); });
+        }
+        syscalls += 2 * ((frames.size() + uart::UdpBatchSize - 1) / uart::UdpBatchSize);
+    }
+    set_rate_counters(state, parsed, syscalls);
+}
+BENCHMARK(BM_Mavlink_Transport_Udp_Batched);
+
+// The same burst over loopback TCP, written frame by frame and read in chunks.
+static void BM_Mavlink_Transport_Tcp(benchmark::State& state) {
+    auto server = uart::PosixTCP{"tcpin:127.0.0.1:0"};
+    [[maybe_unused]] auto listening = server.open();
+    auto client = uart::PosixTCP{"tcp:127.0.0.1:" + std::to_string(server.port())};
+    [[maybe_unused]] auto opened = client.open();
+    [[maybe_unused]] auto timeout = server.set_timeout(std::chrono::milliseconds{100});
+    const auto frames = make_frames();
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto buffer_span = std::span<std::uint8_t>(buffer);
+    auto framer = create_framer(&buffer_span);
+    auto chunk = std::array<std::uint8_t, 4096>{};
+    auto parsed = std::uint64_t{0};
+    auto syscalls = std::uint64_t{0};
+
+    for (auto _ : state) {
+        for (const auto& frame : frames) {
+            [[maybe_unused]] auto sent = client.write(frame);
+        }
+        auto before = parsed;
+        while (parsed - before < frames.size()) {
+            auto length = server.read(chunk, chunk.size());
+            if (!length || *length == 0) {
+                break;
+            }
+            framer.push_bytes(std::span<const std::uint8_t>(chunk).first(*length),
+                              [&](const Framer::ParseResult& result) { parsed += result.has_value(); });
+            ++syscalls;
+        }
+        syscalls += frames.size();
+    }
+    set_rate_counters(state, parsed, syscalls);
+}
+BENCHMARK(BM_Mavlink_Transport_Tcp);
@@ -0,0 +1,225 @@
+#include <benchmark/benchmark.h>
+#include <minmea.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+#include "nmea0183/deserializer.hpp"
+#include "nmea0183/framer.hpp"
+#include "nmea0183/synthetic_stream.hpp"
+
+using namespace nmea0183::payloads;
+
+namespace {
+
+// Sentence mixes, by sentence length.
+enum class Mix {
+    Heading,   ///< Short HDT and ROT sentences.
+    Position,  ///< Long GGA, GLL, RMC, VTG and ZDA sentences, all of which minmea parses.
+    Gnss,      ///< Every sentence at typical receiver rates.
+};
+
+constexpr auto StreamSize = std::size_t{4} << 20;
+constexpr auto Seed = std::uint64_t{2024};
+
+std::vector<char> make_stream(Mix mix) {
+    switch (mix) {
+        case Mix::Heading: {
+            auto generator = nmea0183::SyntheticStream<"HE", HDT, ROT>{Seed};
+            return generator.generate(StreamSize);
+        }
+        case Mix::Position: {
+            auto generator = nmea0183::SyntheticStream<"GP", GGA, GLL, RMC, VTG, ZDA>{Seed};
+            return generator.generate(StreamSize);
+        }
+        case Mix::Gnss:
+        default: {
+            auto generator = nmea0183::GnssSyntheticStream{Seed};
+            return generator.generate(StreamSize);
+        }
+    }
+}
+
+// A clean multi-megabyte stream per mix, generated once.
+const std::vector<char>& stream(Mix mix) {
+    static const auto streams =
+        std::array{make_stream(Mix::Heading), make_stream(Mix::Position), make_stream(Mix::Gnss)};
+    return streams[static_cast<std::size_t>(mix)];
+}
+
+// bytes/s, messages/s and the time per message, from totals over all iterations.
+void set_counters(benchmark::State& state, std::size_t bytes, std::uint64_t messages) {
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+    state.counters["msgs/s"] = benchmark::Counter(static_cast<double>(messages), benchmark::Counter::kIsRate);
+    state.counters["time/msg"] = benchmark::Counter(static_cast<double>(messages),
+                                                    benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+// Hands each line of the stream to minmea NUL-terminated, as read by fgets() in minmea's example.
+template <typename Visitor>
+void for_each_line(const std::vector<char>& bytes, Visitor&& visitor) {
+    auto line = std::array<char, 128>{};
+    auto begin = bytes.begin();
+    while (begin != bytes.end()) {
+        auto end = std::find(begin, bytes.end(), '\n');
+        end = (end == bytes.end()) ? end : end + 1;
+        auto length = std::min(static_cast<std::size_t>(end - begin), line.size() - 1);
+        std::copy_n(begin, length, line.begin());
+        line[length] = '\0';
+        visitor(line.data());
+        begin = end;
+    }
+}
+
+using Handlers = nmea0183::Dispatcher<nmea0183::MessageHandler<"DTM", LazyDTM>,
+                                      nmea0183::MessageHandler<"GBS", LazyGBS>,
+                                      nmea0183::MessageHandler<"GGA", LazyGGA>,
+                                      nmea0183::MessageHandler<"GLL", LazyGLL>,
+                                      nmea0183::MessageHandler<"GNS", LazyGNS>,
+                                      nmea0183::MessageHandler<"GSA", LazyGSA>,
+                                      nmea0183::MessageHandler<"GST", LazyGST>,
+                                      nmea0183::MessageHandler<"HDT", LazyHDT>,
+                                      nmea0183::MessageHandler<"RMC", LazyRMC>,
+                                      nmea0183::MessageHandler<"ROT", LazyROT>,
+                                      nmea0183::MessageHandler<"VTG", LazyVTG>,
+                                      nmea0183::MessageHandler<"ZDA", LazyZDA>>;
+
+}  // namespace
+
+// Framing only: checksum validation and field splitting.
+static void BM_Nmea0183_Framing_Framer(benchmark::State& state, Mix mix) {
+    const auto& bytes = stream(mix);
+    std::array<char, 256> buffer;
+    std::span<char> span(buffer);
+    auto framer = nmea0183::create_framer(&span);
+    auto messages = std::uint64_t{0};
+
+    for (auto _ : state) {
+        for (char c : bytes) {
+            if (auto result = framer.push_byte(c); result && result->has_value()) {
+                ++messages;
+            }
+        }
+    }
+    set_counters(state, bytes.size(), messages);
+}
+BENCHMARK_CAPTURE(BM_Nmea0183_Framing_Framer, heading, Mix::Heading);
+BENCHMARK_CAPTURE(BM_Nmea0183_Framing_Framer, position, Mix::Position);
+BENCHMARK_CAPTURE(BM_Nmea0183_Framing_Framer, gnss, Mix::Gnss);
+
+// The reference for framing: minmea_sentence_id() validates the checksum and identifies the sentence.
+static void BM_Nmea0183_Framing_Minmea(benchmark::State& state, Mix mix) {
+    const auto& bytes = stream(mix);
+    auto messages = std::uint64_t{0};
+
+    for (auto _ : state) {
+        for_each_line(bytes, [&](const char* line) {
+            messages += minmea_sentence_id(line, false) != MINMEA_INVALID;
+        });
+    }
+    set_counters(state, bytes.size(), messages);
+}
+BENCHMARK_CAPTURE(BM_Nmea0183_Framing_Minmea, heading, Mix::Heading);
+BENCHMARK_CAPTURE(BM_Nmea0183_Framing_Minmea, position, Mix::Position);
+BENCHMARK_CAPTURE(BM_Nmea0183_Framing_Minmea, gnss, Mix::Gnss);
+
+// Framing and binding each sentence to its payload; fields are still parsed lazily, on access.
+static void BM_Nmea0183_Framing_FramerBind(benchmark::State& state, Mix mix) {
+    const auto& bytes = stream(mix);
+    std::array<char, 256> buffer;
+    std::span<char> span(buffer);
+    auto framer = nmea0183::create_framer(&span);
+    auto messages = std::uint64_t{0};
+
+    for (auto _ : state) {
+        for (char c : bytes) {
+            if (auto result = framer.push_byte(c); result && result->has_value()) {
+                auto matched = Handlers::dispatch(result->value(), [&](const auto& payload) {
+                    benchmark::DoNotOptimize(payload);
+                    messages += payload.has_value();
+                });
+                benchmark::DoNotOptimize(matched);
+            }
+        }
+    }
+    set_counters(state, bytes.size(), messages);
+}
+BENCHMARK_CAPTURE(BM_Nmea0183_Framing_FramerBind, heading, Mix::Heading);
+BENCHMARK_CAPTURE(BM_Nmea0183_Framing_FramerBind, position, Mix::Position);
+BENCHMARK_CAPTURE(BM_Nmea0183_Framing_FramerBind, gnss, Mix::Gnss);
+
+// The reference for parsing: minmea parses every field of the sentences it supports (not DTM, GNS, HDT, ROT).
+static void BM_Nmea0183_Framing_MinmeaParse(benchmark::State& state, Mix mix) {
+    const auto& bytes = stream(mix);
+    auto messages = std::uint64_t{0};
+    auto parse = [&](auto parser, auto& frame, const char* line) {
+        messages += parser(&frame, line);
+        benchmark::DoNotOptimize(frame);
+    };
+    struct minmea_sentence_gbs gbs;
+    struct minmea_sentence_gga gga;
+    struct minmea_sentence_gll gll;
+    struct minmea_sentence_gsa gsa;
+    struct minmea_sentence_gst gst;
+    struct minmea_sentence_rmc rmc;
+    struct minmea_sentence_vtg vtg;
+    struct minmea_sentence_zda zda;
+
+    for (auto _ : state) {
+        for_each_line(bytes, [&](const char* line) {
+            switch (minmea_sentence_id(line, false)) {
+                case MINMEA_SENTENCE_GBS:
+                    parse(minmea_parse_gbs, gbs, line);
+                    break;
+                case MINMEA_SENTENCE_GGA:
+                    parse(minmea_parse_gga, gga, line);
+                    break;
+                case MINMEA_SENTENCE_GLL:
+                    parse(minmea_parse_gll, gll, line);
+                    break;
+                case MINMEA_SENTENCE_GSA:
+                    parse(minmea_parse_gsa, gsa, line);
+                    break;
+                case MINMEA_SENTENCE_GST:
+                    parse(minmea_parse_gst, gst, line);
+                    break;
+                case MINMEA_SENTENCE_RMC:
+                    parse(minmea_parse_rmc, rmc, line);
+                    break;
+                case MINMEA_SENTENCE_VTG:
+                    parse(minmea_parse_vtg, vtg, line);
+                    break;
+                case MINMEA_SENTENCE_ZDA:
+                    parse(minmea_parse_zda, zda, line);
+                    break;
+                default:
+                    break;
+            }
+        });
+    }
+    set_counters(state, bytes.size(), messages);
+}
+BENCHMARK_CAPTURE(BM_Nmea0183_Framing_MinmeaParse, heading, Mix::Heading);
+BENCHMARK_CAPTURE(BM_Nmea0183_Framing_MinmeaParse, position, Mix::Position);
+BENCHMARK_CAPTURE(BM_Nmea0183_Framing_MinmeaParse, gnss, Mix::Gnss);
+
+// Creating and destroying a framer, as a server does per connection: with its coroutine frame from the heap, or from
+// a pool resource reused across connections.
+static void BM_Nmea0183_Framing_Create(benchmark::State& state, bool pooled) {
+    std::array<char, 256> buffer;
+    std::span<char> span(buffer);
+    auto pool = std::pmr::unsynchronized_pool_resource{};
+    auto* resource = pooled ? static_cast<std::pmr::memory_resource*>(&pool) : std::pmr::new_delete_resource();
+
+    for (auto _ : state) {
+        auto framer = nmea0183::create_framer(std::allocator_arg, resource, &span);
+        benchmark::DoNotOptimize(framer.handle);
+    }
+}
+BENCHMARK_CAPTURE(BM_Nmea0183_Framing_Create, heap, false);
+BENCHMARK_CAPTURE(BM_Nmea0183_Framing_Create, pool, true);
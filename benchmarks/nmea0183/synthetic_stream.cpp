@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "nmea0183/framer.hpp"
+#include "nmea0183/synthetic_stream.hpp"
+
+namespace {
+
+// Each fault of SyntheticFaults drawn with the same probability, given in per mille.
+nmea0183::SyntheticFaults faults(std::int64_t per_mille) {
+    auto probability = static_cast<double>(per_mille) / 1000.0;
+    return nmea0183::SyntheticFaults{probability, probability, probability, probability, 64};
+}
+
+// ~1 MiB of every sentence at typical receiver rates.
+struct Stream {
+    std::vector<char> bytes;
+    nmea0183::SyntheticStats stats;
+};
+
+Stream make_stream(std::int64_t per_mille) {
+    auto generator = nmea0183::GnssSyntheticStream{2024, faults(per_mille)};
+    auto bytes = generator.generate(1 << 20);
+    return Stream{std::move(bytes), generator.stats()};
+}
+
+}  // namespace
+
+// The framer at full speed on realistic traffic, with each fault at Arg per mille of the sentences.
+// sentences/s counts valid sentences; recovered is the share of intact sentences the framer got out of the noise.
+static void BM_Nmea0183_Synthetic_Framer(benchmark::State& state) {
+    const auto stream = make_stream(state.range(0));
+    std::array<char, 256> buffer;
+    std::span<char> span(buffer);
+    auto framer = nmea0183::create_framer(&span);
+    auto sentences = std::uint64_t{0};
+    auto errors = std::uint64_t{0};
+
+    for (auto _ : state) {
+        for (char c : stream.bytes) {
+            if (auto result = framer.push_byte(c)) {
+                sentences += result->has_value();
+                errors += !result->has_value();
+            }
+        }
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * stream.bytes.size()));
+    state.counters["sentences/s"] = benchmark::Counter(static_cast<double>(sentences), benchmark::Counter::kIsRate);
+    state.counters["errors/s"] = benchmark::Counter(static_cast<double>(errors), benchmark::Counter::kIsRate);
+    state.counters["recovered"] = static_cast<double>(sentences) /
+                                  static_cast<double>(state.iterations() * stream.stats.intact_sentences);
+}
+BENCHMARK(BM_Nmea0183_Synthetic_Framer)->Arg(0)->Arg(1)->Arg(10)->Arg(50);
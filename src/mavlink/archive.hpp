@@ -0,0 +1,700 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <functional>
+#include <limits>
+#include <map>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/pfr.hpp>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "mavlink/checksum.hpp"
+#include "mavlink/columns.hpp"
+#include "mavlink/message_registry.hpp"
+#include "mavlink/tlog.hpp"
+#include "mavlink/types.hpp"
+
+namespace mavlink {
+
+/// @brief How the values of an archive column are encoded.
+/// @note Every element is encoded against the same element of the previous row (zero for the first row). Residuals
+///       are stored as LEB128 varints; the Runs encodings store each residual with the number of times it repeats,
+///       which turns constant values (e.g. enums and flags) and constant rates (e.g. boot time) into a few bytes.
+enum class ArchiveEncoding : std::uint8_t {
+    Delta,      ///< Zigzag of the wrapped difference to the previous value (integers).
+    DeltaRuns,  ///< Delta, as (residual, repeats) pairs.
+    Xor,        ///< Bits XORed with the previous value, so unchanged sign, exponent and high mantissa bits cost nothing
+                ///< (floating point).
+    XorRuns,    ///< Xor, as (residual, repeats) pairs.
+};
+
+/// @brief Field index of the timestamp column of an archive table.
+inline constexpr std::uint16_t ArchiveTimestampField = 0xFFFF;
+
+/// @brief Field index of the component ID column of an archive table.
+inline constexpr std::uint16_t ArchiveCompidField = 0xFFFE;
+
+/// @brief Directory entry of the messages of one msgid from one system in an archive.
+struct ArchiveTable {
+    std::uint64_t rows;                    ///< Number of messages.
+    std::uint32_t msgid;                   ///< Message ID.
+    std::uint32_t first_column;            ///< Position of the table's first column in the column directory.
+    std::uint16_t column_count;            ///< Number of columns: timestamps, compids, then one per payload field.
+    std::uint8_t sysid;                    ///< System ID.
+    std::array<std::uint8_t, 5> reserved;  ///< Zero.
+};
+static_assert(std::is_trivially_copyable_v<ArchiveTable> && sizeof(ArchiveTable) == 24);
+
+/// @brief Directory entry of one encoded column of an archive.
+struct ArchiveColumn {
+    std::uint64_t offset;                  ///< Offset of the encoded column in the archive.
+    std::uint64_t length;                  ///< Length of the encoded column.
+    std::uint16_t field;                   ///< Payload field index, ArchiveTimestampField or ArchiveCompidField.
+    std::uint16_t element_count;           ///< Elements per row: the array length, or 1 for scalar fields.
+    std::uint8_t element_size;             ///< Size of an element.
+    ArchiveEncoding encoding;              ///< Encoding of the elements.
+    std::array<std::uint8_t, 2> reserved;  ///< Zero.
+};
+static_assert(std::is_trivially_copyable_v<ArchiveColumn> && sizeof(ArchiveColumn) == 24);
+
+namespace detail {
+
+/// @brief Unsigned integer with the size of an archive element type.
+template <typename E>
+using ArchiveBits =
+    std::conditional_t<sizeof(E) == 1,
+                       std::uint8_t,
+                       std::conditional_t<sizeof(E) == 2,
+                                          std::uint16_t,
+                                          std::conditional_t<sizeof(E) == 4, std::uint32_t, std::uint64_t>>>;
+
+/// @brief Appends a LEB128 varint.
+inline void put_varint(std::vector<std::uint8_t>& out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+/// @brief Reads a LEB128 varint.
+/// @return false if the bytes end in the middle of the varint or it is longer than 64 bits.
+[[nodiscard]] inline bool get_varint(const std::uint8_t*& at, const std::uint8_t* end, std::uint64_t& value) noexcept {
+    if (at != end && *at < 0x80) {
+        value = *at++;
+        return true;
+    }
+    value = 0;
+    for (auto shift = 0; shift < 64 && at != end; shift += 7) {
+        auto byte = *at++;
+        value |= std::uint64_t{byte & 0x7FU} << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// @brief Whether an encoding stores (residual, repeats) pairs.
+[[nodiscard]] constexpr bool has_runs(ArchiveEncoding encoding) noexcept {
+    return encoding == ArchiveEncoding::DeltaRuns || encoding == ArchiveEncoding::XorRuns;
+}
+
+/// @brief Counts the elements of a column stored as (residual, repeats) pairs, without decoding it.
+/// @return The element count, or std::nullopt if the bytes are not a sequence of whole pairs or the count overflows.
+[[nodiscard]] inline std::optional<std::uint64_t> count_run_elements(std::span<const std::uint8_t> bytes) noexcept {
+    const auto* at = bytes.data();
+    const auto* end = at + bytes.size();
+    auto count = std::uint64_t{0};
+    while (at != end) {
+        auto residual = std::uint64_t{0};
+        auto repeats = std::uint64_t{0};
+        if (!get_varint(at, end, residual) || !get_varint(at, end, repeats) ||
+            repeats >= std::numeric_limits<std::uint64_t>::max() - count) {
+            return std::nullopt;
+        }
+        count += repeats + 1;
+    }
+    return count;
+}
+
+/// @brief Whether an encoding XORs rather than subtracts.
+[[nodiscard]] constexpr bool is_xor(ArchiveEncoding encoding) noexcept {
+    return encoding == ArchiveEncoding::Xor || encoding == ArchiveEncoding::XorRuns;
+}
+
+/// @brief Length of a LEB128 varint.
+[[nodiscard]] constexpr std::size_t varint_length(std::uint64_t value) noexcept {
+    return static_cast<std::size_t>((std::bit_width(value | 1) + 6) / 7);
+}
+
+/// @brief Streams the residuals of a column, each with the number of times it repeats right after itself.
+/// @tparam E The element type.
+/// @param[in] elements The elements, row by row.
+/// @param[in] width Elements per row; every element is encoded against the same element of the previous row.
+/// @param[in] encoding The encoding; without runs, every residual is passed with no repeats.
+/// @param[in] visitor Called with each residual and its repeats, in order.
+template <typename E, typename Visitor>
+void for_each_residual_run(std::span<const E> elements,
+                           std::size_t width,
+                           ArchiveEncoding encoding,
+                           Visitor&& visitor) {
+    using Bits = ArchiveBits<E>;
+    using Signed = std::make_signed_t<Bits>;
+    auto previous = std::vector<Bits>(width);
+    auto column = std::size_t{0};
+    auto run = std::uint64_t{0};
+    auto repeats = std::uint64_t{0};
+    for (auto element : std::views::iota(std::size_t{0}, elements.size())) {
+        auto& last = previous[column];
+        column = column + 1 == width ? 0 : column + 1;
+        auto bits = std::bit_cast<Bits>(elements[element]);
+        auto delta = static_cast<Bits>(is_xor(encoding) ? bits ^ last : bits - last);
+        last = bits;
+        auto residual = std::uint64_t{delta};
+        if (!is_xor(encoding)) {
+            auto sign = static_cast<Bits>(std::bit_cast<Signed>(delta) >> (8 * sizeof(Bits) - 1));
+            residual = static_cast<Bits>(static_cast<Bits>(delta << 1) ^ sign);
+        }
+        if (element > 0 && has_runs(encoding) && residual == run) {
+            ++repeats;
+            continue;
+        }
+        if (element > 0) {
+            std::invoke(visitor, run, repeats);
+        }
+        run = residual;
+        repeats = 0;
+    }
+    if (!elements.empty()) {
+        std::invoke(visitor, run, repeats);
+    }
+}
+
+/// @brief Picks whichever of its type's encodings (Xor for floating point, Delta otherwise, each with or without
+///        runs) encodes a column shortest, from the lengths of both, totalled in one pass without encoding.
+/// @return The encoding and the length of the encoded column.
+template <typename E>
+[[nodiscard]] std::pair<ArchiveEncoding, std::size_t> shortest_archive_encoding(std::span<const E> elements,
+                                                                               std::size_t width) {
+    auto plain = std::is_floating_point_v<E> ? ArchiveEncoding::Xor : ArchiveEncoding::Delta;
+    auto runs = std::is_floating_point_v<E> ? ArchiveEncoding::XorRuns : ArchiveEncoding::DeltaRuns;
+    auto plain_length = std::size_t{0};
+    auto runs_length = std::size_t{0};
+    // both encodings share the residuals, the plain one writing a run's residual once per element
+    for_each_residual_run(elements, width, runs, [&](std::uint64_t residual, std::uint64_t repeats) {
+        plain_length += static_cast<std::size_t>(repeats + 1) * varint_length(residual);
+        runs_length += varint_length(residual) + varint_length(repeats);
+    });
+    return runs_length < plain_length ? std::pair{runs, runs_length} : std::pair{plain, plain_length};
+}
+
+/// @brief Encodes a column of an archive at the end of a byte vector.
+template <typename E>
+void append_archive_column(std::vector<std::uint8_t>& out,
+                           std::span<const E> elements,
+                           std::size_t width,
+                           ArchiveEncoding encoding) {
+    for_each_residual_run(elements, width, encoding, [&](std::uint64_t residual, std::uint64_t repeats) {
+        put_varint(out, residual);
+        if (has_runs(encoding)) {
+            put_varint(out, repeats);
+        }
+    });
+}
+
+}  // namespace detail
+
+/// @brief Encodes a column of an archive.
+/// @tparam E The element type.
+/// @param[in] elements The elements, row by row.
+/// @param[in] width Elements per row; every element is encoded against the same element of the previous row.
+/// @param[in] encoding The encoding.
+/// @return The encoded column.
+template <typename E>
+[[nodiscard]] std::vector<std::uint8_t> encode_archive_column(std::span<const E> elements,
+                                                              std::size_t width,
+                                                              ArchiveEncoding encoding) {
+    auto out = std::vector<std::uint8_t>{};
+    out.reserve(elements.size());
+    detail::append_archive_column(out, elements, width, encoding);
+    return out;
+}
+
+/// @brief Decodes a column of an archive.
+/// @tparam E The element type.
+/// @param[in] bytes The encoded column.
+/// @param[in] width Elements per row, as encoded.
+/// @param[in] encoding The encoding.
+/// @param[out] elements The elements, row by row; its size is the number of elements to decode.
+/// @return true if the column decoded to exactly that many elements.
+template <typename E>
+[[nodiscard]] bool decode_archive_column(std::span<const std::uint8_t> bytes,
+                                         std::size_t width,
+                                         ArchiveEncoding encoding,
+                                         std::span<E> elements) noexcept {
+    using Bits = detail::ArchiveBits<E>;
+    if (width == 0 || width > 255 || elements.size() % width != 0) {
+        return false;
+    }
+    auto previous = std::array<Bits, 255>{};
+    const auto* at = bytes.data();
+    const auto* end = at + bytes.size();
+
+    auto decode = [&]<bool Xor, bool Runs>() {
+        auto residual = std::uint64_t{0};
+        auto repeats = std::uint64_t{0};
+        auto column = std::size_t{0};
+        for (auto& element : elements) {
+            if constexpr (Runs) {
+                if (repeats == 0) {
+                    if (!detail::get_varint(at, end, residual) || !detail::get_varint(at, end, repeats)) {
+                        return false;
+                    }
+                    ++repeats;
+                }
+                --repeats;
+            } else if (!detail::get_varint(at, end, residual)) {
+                return false;
+            }
+            auto& last = previous[column];
+            auto bits = static_cast<Bits>(residual);
+            if constexpr (Xor) {
+                last ^= bits;
+            } else {
+                last += static_cast<Bits>((bits >> 1) ^ static_cast<Bits>(-(bits & 1)));
+            }
+            element = std::bit_cast<E>(last);
+            column = column + 1 == width ? 0 : column + 1;
+        }
+        return repeats == 0 && at == end;
+    };
+
+    switch (encoding) {
+        case ArchiveEncoding::Delta:
+            return decode.template operator()<false, false>();
+        case ArchiveEncoding::DeltaRuns:
+            return decode.template operator()<false, true>();
+        case ArchiveEncoding::Xor:
+            return decode.template operator()<true, false>();
+        case ArchiveEncoding::XorRuns:
+            return decode.template operator()<true, true>();
+    }
+    return false;
+}
+
+/// @brief Encodes a column of an archive with whichever of its type's encodings (Xor for floating point, Delta
+///        otherwise, each with or without runs) is shortest.
+/// @tparam E The element type.
+/// @param[in] elements The elements, row by row.
+/// @param[in] width Elements per row.
+/// @return The encoding and the encoded column.
+template <typename E>
+[[nodiscard]] std::pair<ArchiveEncoding, std::vector<std::uint8_t>> encode_archive_column(std::span<const E> elements,
+                                                                                         std::size_t width) {
+    auto [encoding, length] = detail::shortest_archive_encoding(elements, width);
+    auto out = std::vector<std::uint8_t>{};
+    out.reserve(length);
+    detail::append_archive_column(out, elements, width, encoding);
+    return {encoding, std::move(out)};
+}
+
+namespace detail {
+
+/// @brief Header of an archive: the encoded columns follow it, then the table and column directories.
+struct ArchiveHeader {
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t table_count;
+    std::uint64_t column_count;
+    std::uint64_t directory_offset;  ///< Offset of the table directory; the column directory follows it.
+};
+static_assert(std::is_trivially_copyable_v<ArchiveHeader> && sizeof(ArchiveHeader) == 32);
+
+inline constexpr std::array<char, 8> ArchiveMagic{'M', 'A', 'V', 'A', 'R', 'C', 'H', 'V'};
+inline constexpr std::uint32_t ArchiveVersion = 1;
+
+}  // namespace detail
+
+/// @brief Builds a compressed columnar archive of Mavlink telemetry, e.g. of a long flight's tlog.
+/// @note Messages are grouped into tables by msgid and sysid. Each table stores its timestamps, its compids and each
+///       payload field as a separate column, encoded with encode_archive_column, so that a reader can decode one field
+///       of a whole flight without touching the rest. The columns are laid out from the payload definitions by
+///       reflection, so any payload type can be archived by listing it. Messages are kept in memory until written.
+/// @tparam Payloads The payload types (e.g. payloads::Attitude) to archive; other messages are not archived.
+template <typename... Payloads>
+class ArchiveWriter {
+   public:
+    using Error = std::pair<int, std::string>;
+
+    /// @brief Adds a message.
+    /// @param[in] view The message.
+    /// @param[in] timestamp_us Message timestamp, in microseconds since the Unix epoch.
+    /// @return true if the message is of one of the archived payload types.
+    bool add(const MessageView& view, std::uint64_t timestamp_us) {
+        auto payload = std::size_t{0};
+        auto length = std::size_t{0};
+        auto known = [&]<std::size_t... P>(std::index_sequence<P...>) {
+            return ((view.msgid == PayloadAt<P>::MessageId ? (payload = P, length = Lengths[P], true) : false) || ...);
+        }(std::index_sequence_for<Payloads...>{});
+        if (!known) {
+            return false;
+        }
+
+        auto& table = tables_[std::pair{view.msgid, view.sysid}];
+        table.payload = payload;
+        table.timestamps.push_back(timestamp_us);
+        table.compids.push_back(view.compid);
+        auto copied = std::min(view.payload.size(), length);
+        table.rows.insert(table.rows.end(), view.payload.begin(), view.payload.begin() + copied);
+        table.rows.resize(table.rows.size() + length - copied);  // zero-truncated fields
+        ++size_;
+        return true;
+    }
+
+    /// @brief Adds a tlog record.
+    /// @param[in] record The record, e.g. from TlogReader::query.
+    /// @return true if the message is of one of the archived payload types.
+    bool add(const TlogRecord& record) { return add(record.view, record.timestamp_us); }
+
+    /// @brief Number of messages added.
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return size_; }
+
+    /// @brief Encodes the archive.
+    /// @return The archive bytes.
+    [[nodiscard]] std::vector<std::uint8_t> encode() const {
+        auto out = std::vector<std::uint8_t>(sizeof(detail::ArchiveHeader));
+        auto tables = std::vector<ArchiveTable>{};
+        auto columns = std::vector<ArchiveColumn>{};
+        // columns are encoded straight into the archive, in the shortest encoding found by sizing them first
+        auto append = [&]<typename E>(std::uint16_t field, std::size_t width, std::span<const E> elements) {
+            auto [encoding, length] = detail::shortest_archive_encoding(elements, width);
+            columns.push_back(ArchiveColumn{out.size(), length, field, static_cast<std::uint16_t>(width),
+                                            static_cast<std::uint8_t>(sizeof(E)), encoding, {}});
+            out.reserve(out.size() + length);
+            detail::append_archive_column(out, elements, width, encoding);
+        };
+
+        for (const auto& [key, table] : tables_) {
+            auto first = columns.size();
+            append(ArchiveTimestampField, 1, std::span<const std::uint64_t>(table.timestamps));
+            append(ArchiveCompidField, 1, std::span<const std::uint8_t>(table.compids));
+            [&]<std::size_t... P>(std::index_sequence<P...>) {
+                ((table.payload == P ? encode_fields<PayloadAt<P>>(table, append) : void()), ...);
+            }(std::index_sequence_for<Payloads...>{});
+            tables.push_back(ArchiveTable{table.timestamps.size(), key.first, static_cast<std::uint32_t>(first),
+                                          static_cast<std::uint16_t>(columns.size() - first), key.second, {}});
+        }
+
+        auto header = detail::ArchiveHeader{detail::ArchiveMagic, detail::ArchiveVersion,
+                                            static_cast<std::uint32_t>(tables.size()), columns.size(), out.size()};
+        std::memcpy(out.data(), &header, sizeof(header));
+        auto directory = std::as_bytes(std::span(tables));
+        out.insert(out.end(), reinterpret_cast<const std::uint8_t*>(directory.data()),
+                   reinterpret_cast<const std::uint8_t*>(directory.data() + directory.size()));
+        directory = std::as_bytes(std::span(columns));
+        out.insert(out.end(), reinterpret_cast<const std::uint8_t*>(directory.data()),
+                   reinterpret_cast<const std::uint8_t*>(directory.data() + directory.size()));
+        return out;
+    }
+
+    /// @brief Encodes the archive and writes it to a file, replacing the file if it exists.
+    /// @param[in] path Path of the archive.
+    /// @return The number of bytes written,
+    ///         error code and string via std::unexpected if the file could not be written
+    auto write(std::string_view path) const -> std::expected<std::size_t, Error> {
+        auto bytes = encode();
+        auto fd = ::open(std::string(path).c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            return detail::errno_error();
+        }
+        if (!detail::pwrite_all(fd, std::as_bytes(std::span(bytes)), 0)) {
+            auto error = detail::errno_error();
+            ::close(fd);
+            return error;
+        }
+        ::close(fd);
+        return bytes.size();
+    }
+
+   private:
+    /// @brief Messages of one msgid from one system.
+    struct Table {
+        std::size_t payload = 0;  ///< Position of the payload type in Payloads.
+        std::vector<std::uint64_t> timestamps;
+        std::vector<std::uint8_t> compids;
+        std::vector<std::uint8_t> rows;  ///< Payloads, zero-padded to their full length, back to back.
+    };
+
+    template <std::size_t P>
+    using PayloadAt = std::tuple_element_t<P, std::tuple<Payloads...>>;
+
+    static constexpr std::array<std::size_t, sizeof...(Payloads)> Lengths{
+        calculate_payload_length<Payloads>(boost::pfr::tuple_size_v<Payloads>)...};
+
+    /// @brief Encodes every payload field of a table into a column.
+    template <typename MessageT, typename Append>
+    static void encode_fields(const Table& table, Append& append) {
+        constexpr auto Length = calculate_payload_length<MessageT>(boost::pfr::tuple_size_v<MessageT>);
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (([&] {
+                 using FieldType = std::remove_cvref_t<typename boost::pfr::tuple_element<I, MessageT>::type>;
+                 using ValueType = typename UnwrapField<FieldType>::Type;
+                 using ElementType = typename FieldShape<ValueType>::ElementType;
+                 constexpr auto Width = std::max<std::size_t>(1, FieldShape<ValueType>::ArrayLength);
+                 static_assert(sizeof(ValueType) == Width * sizeof(ElementType));
+
+                 auto values = std::vector<ValueType>(table.timestamps.size());
+                 gather_column_scalar<ValueType>(table.rows, Length, calculate_payload_length<MessageT>(I), values);
+                 auto elements = std::span<const ElementType>(reinterpret_cast<const ElementType*>(values.data()),
+                                                              values.size() * Width);
+                 append(static_cast<std::uint16_t>(I), Width, elements);
+             }()),
+             ...);
+        }(std::make_index_sequence<boost::pfr::tuple_size_v<MessageT>>{});
+    }
+
+    std::map<std::pair<std::uint32_t, std::uint8_t>, Table> tables_;  ///< By msgid and sysid.
+    std::size_t size_ = 0;
+};
+
+/// @brief Reads a compressed columnar archive written by ArchiveWriter, memory-mapped.
+/// @note Only the directory is read when the archive is opened; reading a column decodes just that column's bytes,
+///       so one field of a whole flight streams through without paging in the others.
+class ArchiveReader {
+   public:
+    using Error = std::pair<int, std::string>;
+
+    /// @brief Constructor.
+    /// @param[in] path Path of the archive.
+    explicit ArchiveReader(std::string_view path) noexcept : path_(path) {}
+    ~ArchiveReader() { close(); }
+    ArchiveReader(const ArchiveReader&) = delete;
+    ArchiveReader(ArchiveReader&&) = delete;
+    auto operator=(const ArchiveReader&) = delete;
+    auto operator=(ArchiveReader&&) = delete;
+
+    /// @brief Maps the archive and reads its directory; will close the archive if already open.
+    /// @return true if the archive is open,
+    ///         error code and string via std::unexpected if it could not be opened or mapped, or is not an archive
+    [[nodiscard]] auto open() -> std::expected<bool, Error> {
+        close();
+        auto fd = ::open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return detail::errno_error();
+        }
+        struct stat status {};
+        if (::fstat(fd, &status) != 0) {
+            auto error = detail::errno_error();
+            ::close(fd);
+            return error;
+        }
+        size_ = static_cast<std::size_t>(status.st_size);
+        if (size_ > 0) {
+            auto* map = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map == MAP_FAILED) {
+                auto error = detail::errno_error();
+                ::close(fd);
+                return error;
+            }
+            map_ = static_cast<const std::uint8_t*>(map);
+        }
+        ::close(fd);  // the mapping keeps the file
+
+        if (!read_directory()) {
+            close();
+            return std::unexpected(Error{EINVAL, "Not a Mavlink archive"});
+        }
+        isopen_ = true;
+        return true;
+    }
+
+    [[nodiscard]] auto is_open() const noexcept -> bool { return isopen_; }
+
+    /// @brief Unmaps the archive and drops its directory from memory.
+    void close() noexcept {
+        if (map_ != nullptr) {
+            ::munmap(const_cast<std::uint8_t*>(map_), size_);
+        }
+        map_ = nullptr;
+        size_ = 0;
+        tables_.clear();
+        columns_.clear();
+        isopen_ = false;
+    }
+
+    /// @brief The mapped archive.
+    [[nodiscard]] auto bytes() const noexcept -> std::span<const std::uint8_t> { return {map_, size_}; }
+
+    /// @brief The tables, sorted by msgid and sysid.
+    [[nodiscard]] auto tables() const noexcept -> std::span<const ArchiveTable> { return tables_; }
+
+    /// @brief The columns of a table.
+    [[nodiscard]] auto columns(const ArchiveTable& table) const noexcept -> std::span<const ArchiveColumn> {
+        return std::span(columns_).subspan(table.first_column, table.column_count);
+    }
+
+    /// @brief Finds the table of a msgid and sysid.
+    /// @return The table, or nullptr if the archive has no such messages.
+    [[nodiscard]] auto find_table(std::uint32_t msgid, std::uint8_t sysid) const noexcept -> const ArchiveTable* {
+        auto key = [](const ArchiveTable& table) { return std::pair{table.msgid, table.sysid}; };
+        auto table = std::ranges::lower_bound(tables_, std::pair{msgid, sysid}, std::less{}, key);
+        return (table != tables_.end() && key(*table) == std::pair{msgid, sysid}) ? &*table : nullptr;
+    }
+
+    /// @brief Decodes the timestamps of a table.
+    /// @return The timestamps in microseconds since the Unix epoch, one per message,
+    ///         MavlinkError::ParseError via std::unexpected if the column is corrupt
+    [[nodiscard]] auto timestamps(const ArchiveTable& table) const
+        -> std::expected<std::vector<std::uint64_t>, MavlinkError> {
+        return read_column<std::uint64_t>(table, ArchiveTimestampField);
+    }
+
+    /// @brief Decodes the component IDs of a table.
+    /// @return The component IDs, one per message,
+    ///         MavlinkError::ParseError via std::unexpected if the column is corrupt
+    [[nodiscard]] auto compids(const ArchiveTable& table) const
+        -> std::expected<std::vector<std::uint8_t>, MavlinkError> {
+        return read_column<std::uint8_t>(table, ArchiveCompidField);
+    }
+
+    /// @brief Decodes one payload field of a table, touching only that field's column.
+    /// @tparam MessageT The payload type of the table (e.g. payloads::Attitude).
+    /// @tparam I Index of the field in the payload.
+    /// @param[in] table The table.
+    /// @return The field of every message of the table,
+    ///         MavlinkError::ProtocolViolation via std::unexpected if the table is not of MessageT,
+    ///         MavlinkError::ParseError via std::unexpected if the column is corrupt
+    template <typename MessageT, std::size_t I>
+    [[nodiscard]] auto field(const ArchiveTable& table) const {
+        using FieldType = std::remove_cvref_t<typename boost::pfr::tuple_element<I, MessageT>::type>;
+        using ValueType = typename UnwrapField<FieldType>::Type;
+        using Result = std::expected<std::vector<ValueType>, MavlinkError>;
+        if (table.msgid != MessageT::MessageId) {
+            return Result{std::unexpected(MavlinkError::ProtocolViolation)};
+        }
+        return Result{read_column<ValueType>(table, static_cast<std::uint16_t>(I))};
+    }
+
+    /// @brief Decodes every column of a table.
+    /// @tparam MessageT The payload type of the table (e.g. payloads::Attitude).
+    /// @param[in] table The table.
+    /// @return The payload fields of every message of the table,
+    ///         MavlinkError::ProtocolViolation via std::unexpected if the table is not of MessageT,
+    ///         MavlinkError::ParseError via std::unexpected if a column is corrupt
+    template <typename MessageT>
+    [[nodiscard]] auto read(const ArchiveTable& table) const -> std::expected<PayloadColumns<MessageT>, MavlinkError> {
+        auto columns = PayloadColumns<MessageT>{};
+        auto error = MavlinkError::None;
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (([&] {
+                 if (error != MavlinkError::None) {
+                     return;
+                 }
+                 auto values = field<MessageT, I>(table);
+                 if (values) {
+                     boost::pfr::get<I>(columns).values = std::move(*values);
+                 } else {
+                     error = values.error();
+                 }
+             }()),
+             ...);
+        }(std::make_index_sequence<boost::pfr::tuple_size_v<MessageT>>{});
+        if (error != MavlinkError::None) {
+            return std::unexpected(error);
+        }
+        return columns;
+    }
+
+   private:
+    /// @brief Copies the directory out of the mapping and checks that every column lies within the archive.
+    bool read_directory() {
+        auto header = detail::ArchiveHeader{};
+        if (size_ < sizeof(header)) {
+            return false;
+        }
+        std::memcpy(&header, map_, sizeof(header));
+        auto directory_length = header.table_count * sizeof(ArchiveTable) + header.column_count * sizeof(ArchiveColumn);
+        if (header.magic != detail::ArchiveMagic || header.version != detail::ArchiveVersion ||
+            header.directory_offset > size_ || header.column_count > size_ ||
+            directory_length > size_ - header.directory_offset) {
+            return false;
+        }
+        tables_.resize(header.table_count);
+        columns_.resize(header.column_count);
+        std::memcpy(tables_.data(), map_ + header.directory_offset, tables_.size() * sizeof(ArchiveTable));
+        std::memcpy(columns_.data(), map_ + header.directory_offset + tables_.size() * sizeof(ArchiveTable),
+                    columns_.size() * sizeof(ArchiveColumn));
+        auto valid_column = [this](const ArchiveColumn& column) {
+            return column.offset <= size_ && column.length <= size_ - column.offset;
+        };
+        auto valid_table = [this](const ArchiveTable& table) {
+            return table.first_column <= columns_.size() && table.column_count <= columns_.size() - table.first_column;
+        };
+        return std::ranges::all_of(columns_, valid_column) && std::ranges::all_of(tables_, valid_table);
+    }
+
+    /// @brief Decodes a column of a table into values of a field type.
+    template <typename ValueType>
+    auto read_column(const ArchiveTable& table, std::uint16_t field) const
+        -> std::expected<std::vector<ValueType>, MavlinkError> {
+        using ElementType = typename FieldShape<ValueType>::ElementType;
+        constexpr auto Width = std::max<std::size_t>(1, FieldShape<ValueType>::ArrayLength);
+        static_assert(sizeof(ValueType) == Width * sizeof(ElementType));
+
+        auto columns = this->columns(table);
+        auto column = std::ranges::find(columns, field, &ArchiveColumn::field);
+        if (column == columns.end()) {
+            return std::unexpected(MavlinkError::ProtocolViolation);
+        }
+        if (column->element_count != Width || column->element_size != sizeof(ElementType)) {
+            return std::unexpected(MavlinkError::ProtocolViolation);
+        }
+        // a corrupt row count is caught before allocating: every element takes at least one byte, or is counted in
+        // the repeats of a run
+        auto encoded = bytes().subspan(column->offset, column->length);
+        if (table.rows > std::numeric_limits<std::uint64_t>::max() / Width) {
+            return std::unexpected(MavlinkError::ParseError);
+        }
+        if (detail::has_runs(column->encoding)) {
+            if (detail::count_run_elements(encoded) != table.rows * Width) {
+                return std::unexpected(MavlinkError::ParseError);
+            }
+        } else if (table.rows * Width > column->length) {
+            return std::unexpected(MavlinkError::ParseError);
+        }
+        auto values = std::vector<ValueType>(table.rows);
+        auto elements = std::span<ElementType>(reinterpret_cast<ElementType*>(values.data()), values.size() * Width);
+        if (!decode_archive_column(encoded, Width, column->encoding, elements)) {
+            return std::unexpected(MavlinkError::ParseError);
+        }
+        return values;
+    }
+
+    std::string path_;
+    const std::uint8_t* map_ = nullptr;
+    std::size_t size_ = 0;
+    std::vector<ArchiveTable> tables_;
+    std::vector<ArchiveColumn> columns_;
+    bool isopen_ = false;
+};
+
+}  // namespace mavlink
@@ -2,7 +2,9 @@
 #include <array>
 #include <boost/pfr.hpp>
 #include <cstdint>
+#include <span>
 #include <string_view>
+#include "mavlink/crc_kernels.hpp"
 #include "mavlink/types.hpp"
 
 namespace mavlink {
@@ -17,13 +19,26 @@ constexpr void crc_accumulate(std::uint8_t data, std::uint16_t& crcAccum) {
 }
 
 /// @brief Accumulate the X.25 CRC for a buffer.
+/// @note At run time, uses the PCLMULQDQ folding kernel for longer buffers when the CPU supports it, and the
+///       slice-by-8 table kernel otherwise; constant evaluation goes byte by byte. Every kernel produces the same
+///       result as crc_accumulate applied byte by byte.
 /// @param[inout] crcAccum Current CRC value.
 /// @param[in] pBuffer Buffer to accumulate.
 /// @param[in] length Length of the buffer.
 constexpr void crc_accumulate_buffer(std::uint16_t& crcAccum, const char* pBuffer, size_t length) {
-    const std::uint8_t* p = (const std::uint8_t*)pBuffer;
-    while (length--) {
-        crc_accumulate(*p++, crcAccum);
+    if !consteval {
+        auto data = std::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t*>(pBuffer), length);
+#if defined(AVIONICPP_CRC_CLMUL)
+        if (data.size() >= CrcClmulThreshold && crc_clmul_supported()) {
+            crc_accumulate_clmul(crcAccum, data);
+            return;
+        }
+#endif
+        crc_accumulate_sliced<8>(crcAccum, data);
+        return;
+    }
+    for (auto i = std::size_t{0}; i < length; ++i) {
+        crc_accumulate(static_cast<std::uint8_t>(pBuffer[i]), crcAccum);
     }
 }
 
@@ -63,7 +78,7 @@ consteval std::string_view type_string() {
         return "double";
     if constexpr (std::is_same_v<T, char>)
         return "char";
-    return "unknown";  // TODO: handle arrays?
+    return "unknown";
 }
 
 /// @brief Helper to unwrap TxField/RxField or direct type to the underlying value type.
@@ -85,6 +100,46 @@ struct UnwrapField<RxField<T>> {
     using Type = T;
 };
 
+/// @brief Specialization for ViewField.
+template <typename T>
+struct UnwrapField<ViewField<T>> {
+    using Type = T;
+};
+
+/// @brief Specialization for ColumnField.
+template <typename T>
+struct UnwrapField<ColumnField<T>> {
+    using Type = T;
+};
+
+/// @brief Helper to split a field value type into its Mavlink element type and array length.
+/// @tparam T The field value type.
+template <typename T>
+struct FieldShape {
+    using ElementType = T;
+    static constexpr std::size_t ArrayLength = 0;
+};
+
+/// @brief Specialization for array fields.
+template <typename T, std::size_t N>
+struct FieldShape<std::array<T, N>> {
+    using ElementType = T;
+    static constexpr std::size_t ArrayLength = N;
+};
+
+/// @brief Number of leading fields that belong to the base (non-extension) message definition.
+/// @note Messages with Mavlink 2 extension fields declare a BaseFieldCount; extension fields are excluded from the
+///       CRC_EXTRA calculation.
+/// @tparam MessageT The message type struct.
+template <typename MessageT>
+consteval std::size_t base_field_count() {
+    if constexpr (requires { MessageT::BaseFieldCount; }) {
+        return MessageT::BaseFieldCount;
+    } else {
+        return boost::pfr::tuple_size_v<MessageT>;
+    }
+}
+
 /// @brief Calculate the Mavlink CRC_EXTRA byte at compile time.
 /// @tparam MessageT The message type struct.
 /// @return The calculated CRC_EXTRA byte.
@@ -108,7 +163,7 @@ consteval uint8_t calculate_crc_extra() {
     // But we need names and types.
     // boost::pfr::get_name<N, MessageT>() works.
 
-    constexpr auto field_count = boost::pfr::tuple_size_v<MessageT>;
+    constexpr auto field_count = base_field_count<MessageT>();
 
     [&]<size_t... I>(std::index_sequence<I...>) {
         (([&]() {
@@ -116,8 +171,9 @@ consteval uint8_t calculate_crc_extra() {
              // FieldType is like TxField<uint32_t>
              using CleanType = std::remove_cvref_t<FieldType>;
              using ValueType = typename UnwrapField<CleanType>::Type;
+             using Shape = FieldShape<ValueType>;
 
-             std::string_view type_str = type_string<ValueType>();
+             std::string_view type_str = type_string<typename Shape::ElementType>();
              std::string_view name_str = boost::pfr::get_name<I, MessageT>();
 
              // "type name "
@@ -126,9 +182,10 @@ consteval uint8_t calculate_crc_extra() {
              crc_accumulate_string(crc, name_str);
              crc_accumulate((uint8_t)' ', crc);
 
-             // TODO: Array length?
-             // If ValueType is array, type_string should handle it?
-             // For now assuming primitive types as in Heartbeat.
+             // arrays are described by their element type, followed by the array length
+             if constexpr (Shape::ArrayLength > 0) {
+                 crc_accumulate(static_cast<std::uint8_t>(Shape::ArrayLength), crc);
+             }
          }()),
          ...);
     }(std::make_index_sequence<field_count>{});
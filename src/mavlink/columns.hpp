@@ -0,0 +1,243 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <boost/pfr.hpp>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define AVIONICPP_COLUMNS_AVX2 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#include "mavlink/message_registry.hpp"
+#include "mavlink/types.hpp"
+
+namespace mavlink {
+
+/// @brief Payloads copied into a block before the block is transposed into the columns.
+inline constexpr std::size_t ColumnBlockRows = 16;
+
+/// @brief Bytes a block extends past its last row, so that kernels may load whole words there.
+inline constexpr std::size_t ColumnBlockSlack = 8;
+
+namespace detail {
+
+/// @brief Swaps the traits of a payload template instance (e.g. from payloads::Attitude to its columns).
+template <typename MessageT>
+struct RebindTraits;
+
+template <template <typename> class PayloadT, typename Traits>
+struct RebindTraits<PayloadT<Traits>> {
+    template <typename NewTraits>
+    using Type = PayloadT<NewTraits>;
+};
+
+}  // namespace detail
+
+/// @brief Struct-of-arrays batch of a payload type: one ColumnField per payload field, with the field's name.
+/// @tparam MessageT The payload type (e.g. payloads::Attitude or payloads::LazyAttitude).
+template <typename MessageT>
+using PayloadColumns = typename detail::RebindTraits<MessageT>::template Type<ColumnTraits>;
+
+/// @brief Copies one field out of every row of a block of payloads, one row at a time.
+/// @tparam T The field type.
+/// @param[in] block The rows, stride bytes apart.
+/// @param[in] stride Distance between rows.
+/// @param[in] offset Offset of the field in a row.
+/// @param[out] out One value per row.
+template <typename T>
+void gather_column_scalar(std::span<const std::uint8_t> block,
+                          std::size_t stride,
+                          std::size_t offset,
+                          std::span<T> out) noexcept {
+    for (auto row : std::views::iota(std::size_t{0}, out.size())) {
+        std::memcpy(&out[row], block.data() + row * stride + offset, sizeof(T));
+    }
+}
+
+#if defined(AVIONICPP_COLUMNS_AVX2)
+
+#if defined(__GNUC__) || defined(__clang__)
+#define AVIONICPP_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define AVIONICPP_TARGET_AVX2
+#endif
+
+namespace detail {
+
+/// @brief Byte offsets of a field in eight consecutive rows.
+AVIONICPP_TARGET_AVX2 inline __m256i column_offsets(std::size_t stride, std::size_t offset, std::size_t row) noexcept {
+    auto rows = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    return _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(row * stride + offset)),
+                            _mm256_mullo_epi32(rows, _mm256_set1_epi32(static_cast<int>(stride))));
+}
+
+}  // namespace detail
+
+/// @brief Reports whether the CPU supports the AVX2 gathers used by gather_column_avx2.
+[[nodiscard]] inline bool columns_avx2_supported() noexcept {
+    static const auto supported = [] {
+#if defined(_MSC_VER)
+        auto info = std::array<int, 4>{};
+        __cpuidex(info.data(), 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        return __builtin_cpu_supports("avx2") != 0;
+#endif
+    }();
+    return supported;
+}
+
+/// @brief Copies one field out of every row of a block of payloads with AVX2 gathers.
+/// @note 4- and 8-byte fields are gathered eight and four rows at a time. 2-byte fields are gathered as 4-byte words
+///       and packed, sixteen rows at a time, so the block must extend ColumnBlockSlack bytes past its last row. Other
+///       fields, and rows left over, are copied by gather_column_scalar. The caller must check
+///       columns_avx2_supported() first.
+/// @tparam T The field type.
+/// @param[in] block The rows, stride bytes apart.
+/// @param[in] stride Distance between rows.
+/// @param[in] offset Offset of the field in a row.
+/// @param[out] out One value per row.
+template <typename T>
+AVIONICPP_TARGET_AVX2 void gather_column_avx2(std::span<const std::uint8_t> block,
+                                              std::size_t stride,
+                                              std::size_t offset,
+                                              std::span<T> out) noexcept {
+    const auto* words = reinterpret_cast<const int*>(block.data());
+    auto row = std::size_t{0};
+    if constexpr (std::is_arithmetic_v<T> && sizeof(T) == 4) {
+        for (; row + 8 <= out.size(); row += 8) {
+            auto values = _mm256_i32gather_epi32(words, detail::column_offsets(stride, offset, row), 1);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out.data() + row), values);
+        }
+    } else if constexpr (std::is_arithmetic_v<T> && sizeof(T) == 8) {
+        const auto* quads = reinterpret_cast<const long long*>(block.data());
+        for (; row + 4 <= out.size(); row += 4) {
+            auto offsets = _mm256_castsi256_si128(detail::column_offsets(stride, offset, row));
+            auto values = _mm256_i32gather_epi64(quads, offsets, 1);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out.data() + row), values);
+        }
+    } else if constexpr (std::is_arithmetic_v<T> && sizeof(T) == 2) {
+        const auto low_halves = _mm256_set1_epi32(0xFFFF);
+        for (; row + 16 <= out.size(); row += 16) {
+            auto first = _mm256_i32gather_epi32(words, detail::column_offsets(stride, offset, row), 1);
+            auto second = _mm256_i32gather_epi32(words, detail::column_offsets(stride, offset, row + 8), 1);
+            // the pack interleaves the 128-bit lanes of its operands, the permute puts them back in row order
+            auto packed =
+                _mm256_packus_epi32(_mm256_and_si256(first, low_halves), _mm256_and_si256(second, low_halves));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out.data() + row), _mm256_permute4x64_epi64(packed, 0xD8));
+        }
+    }
+    gather_column_scalar(block.subspan(row * stride), stride, offset, out.subspan(row));
+}
+
+#undef AVIONICPP_TARGET_AVX2
+
+#endif  // AVIONICPP_COLUMNS_AVX2
+
+/// @brief Copies one field out of every row of a block of payloads, with the fastest kernel the CPU supports.
+/// @tparam T The field type.
+/// @param[in] block The rows, stride bytes apart, extending ColumnBlockSlack bytes past the last row.
+/// @param[in] stride Distance between rows.
+/// @param[in] offset Offset of the field in a row.
+/// @param[out] out One value per row.
+template <typename T>
+void gather_column(std::span<const std::uint8_t> block, std::size_t stride, std::size_t offset, std::span<T> out) {
+#if defined(AVIONICPP_COLUMNS_AVX2)
+    if constexpr (std::is_arithmetic_v<T> && sizeof(T) >= 2) {
+        if (columns_avx2_supported()) {
+            gather_column_avx2(block, stride, offset, out);
+            return;
+        }
+    }
+#endif
+    gather_column_scalar(block, stride, offset, out);
+}
+
+/// @brief Appends the payloads of a range of messages to the columns of their payload type.
+/// @note Payloads are copied, zero-padded to their full length, into a block of ColumnBlockRows rows, and each full
+///       block is transposed into the columns field by field, so every column is written contiguously. Views of other
+///       msgids are skipped. Fields past the end of a zero-truncated payload decode as zero, as with deserialize.
+/// @tparam MessageT The payload type (e.g. payloads::Attitude).
+/// @tparam Views Range of MessageView.
+/// @param[in] views The messages to decode.
+/// @param[inout] columns The columns to append to.
+/// @return The number of payloads appended.
+template <typename MessageT, std::ranges::input_range Views>
+    requires std::convertible_to<std::ranges::range_reference_t<Views>, const MessageView&>
+std::size_t decode_columns(Views&& views, PayloadColumns<MessageT>& columns) {
+    constexpr auto FieldCount = boost::pfr::tuple_size_v<MessageT>;
+    constexpr auto Length = calculate_payload_length<MessageT>(FieldCount);
+
+    if constexpr (std::ranges::sized_range<Views>) {
+        boost::pfr::for_each_field(columns, [&](auto& column) {
+            column.values.reserve(column.values.size() + std::ranges::size(views));
+        });
+    }
+
+    auto block = std::array<std::uint8_t, ColumnBlockRows * Length + ColumnBlockSlack>{};
+    auto rows = std::size_t{0};
+    auto transpose = [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (([&] {
+             using FieldType = std::remove_cvref_t<typename boost::pfr::tuple_element<I, MessageT>::type>;
+             using ValueType = typename UnwrapField<FieldType>::Type;
+             auto& values = boost::pfr::get<I>(columns).values;
+             auto first = values.size();
+             values.resize(first + rows);
+             gather_column<ValueType>(block, Length, calculate_payload_length<MessageT>(I),
+                                      std::span(values).subspan(first));
+         }()),
+         ...);
+        rows = 0;
+    };
+
+    auto decoded = std::size_t{0};
+    for (const MessageView& view : views) {
+        if (view.msgid != MessageT::MessageId) {
+            continue;
+        }
+        auto* row = block.data() + rows * Length;
+        if (view.payload.size() >= Length) {
+            std::memcpy(row, view.payload.data(), Length);
+        } else {
+            if (!view.payload.empty()) {
+                std::memcpy(row, view.payload.data(), view.payload.size());
+            }
+            std::memset(row + view.payload.size(), 0, Length - view.payload.size());
+        }
+        ++decoded;
+        if (++rows == ColumnBlockRows) {
+            transpose(std::make_index_sequence<FieldCount>{});
+        }
+    }
+    if (rows > 0) {
+        transpose(std::make_index_sequence<FieldCount>{});
+    }
+    return decoded;
+}
+
+/// @brief Decodes the payloads of a range of messages into columns.
+/// @tparam MessageT The payload type (e.g. payloads::Attitude).
+/// @tparam Views Range of MessageView.
+/// @param[in] views The messages to decode; views of other msgids are skipped.
+/// @return The columns, one value per decoded payload.
+template <typename MessageT, std::ranges::input_range Views>
+    requires std::convertible_to<std::ranges::range_reference_t<Views>, const MessageView&>
+[[nodiscard]] PayloadColumns<MessageT> decode_columns(Views&& views) {
+    auto columns = PayloadColumns<MessageT>{};
+    decode_columns<MessageT>(std::forward<Views>(views), columns);
+    return columns;
+}
+
+}  // namespace mavlink
@@ -0,0 +1,187 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define AVIONICPP_CRC_CLMUL 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+namespace mavlink {
+
+/// @brief Reflected X.25 (CRC-16/MCRF4XX) polynomial, as used by Mavlink.
+inline constexpr std::uint16_t CrcPolynomial = 0x8408;
+
+/// @brief Slicing tables for the X.25 CRC.
+/// @note Table 0 is the classic byte-at-a-time table; table k advances a byte through k further zero bytes, which lets
+///       the sliced kernels consume 4 or 8 bytes per step with independent lookups.
+inline constexpr auto CrcTables = [] {
+    auto tables = std::array<std::array<std::uint16_t, 256>, 8>{};
+    for (auto i : std::views::iota(0U, 256U)) {
+        auto crc = static_cast<std::uint16_t>(i);
+        for ([[maybe_unused]] auto bit : std::views::iota(0, 8)) {
+            crc = static_cast<std::uint16_t>((crc & 1U) ? (crc >> 1) ^ CrcPolynomial : crc >> 1);
+        }
+        tables[0][i] = crc;
+    }
+    for (auto k : std::views::iota(std::size_t{1}, tables.size())) {
+        for (auto i : std::views::iota(0U, 256U)) {
+            auto prev = tables[k - 1][i];
+            tables[k][i] = static_cast<std::uint16_t>((prev >> 8) ^ tables[0][prev & 0xFF]);
+        }
+    }
+    return tables;
+}();
+
+/// @brief Accumulate the X.25 CRC one byte at a time using the lookup table.
+/// @param[inout] crc Current CRC value.
+/// @param[in] data Bytes to accumulate.
+constexpr void crc_accumulate_table(std::uint16_t& crc, std::span<const std::uint8_t> data) noexcept {
+    for (auto b : data) {
+        crc = static_cast<std::uint16_t>((crc >> 8) ^ CrcTables[0][(crc ^ b) & 0xFF]);
+    }
+}
+
+/// @brief Accumulate the X.25 CRC using slice-by-N lookups.
+/// @tparam Slices Bytes consumed per step (4 or 8).
+/// @param[inout] crc Current CRC value.
+/// @param[in] data Bytes to accumulate.
+template <std::size_t Slices>
+    requires(Slices == 4 || Slices == 8)
+constexpr void crc_accumulate_sliced(std::uint16_t& crc, std::span<const std::uint8_t> data) noexcept {
+    while (data.size() >= Slices) {
+        // the 16-bit register only overlaps the first two bytes of the step
+        auto x = std::array<std::uint8_t, Slices>{};
+        std::ranges::copy(data.first(Slices), x.begin());
+        x[0] ^= static_cast<std::uint8_t>(crc & 0xFF);
+        x[1] ^= static_cast<std::uint8_t>(crc >> 8);
+
+        auto next = std::uint16_t{0};
+        for (auto i : std::views::iota(std::size_t{0}, Slices)) {
+            next ^= CrcTables[Slices - 1 - i][x[i]];
+        }
+        crc = next;
+        data = data.subspan(Slices);
+    }
+    crc_accumulate_table(crc, data);
+}
+
+#if defined(AVIONICPP_CRC_CLMUL)
+
+/// @brief Inputs shorter than this are faster through the sliced kernel than through carry-less multiply folding.
+inline constexpr std::size_t CrcClmulThreshold = 64;
+
+namespace detail {
+
+/// @brief x^n mod P for the (non-reflected) X.25 generator, reflected and pre-shifted for PCLMULQDQ folding.
+/// @note A 64x64 carry-less product of reflected operands lands one bit low, hence the shift. A constant held in the
+///       low 33 bits of a lane also multiplies in x^32, so folding by D bits uses x^(D + 32) for the low lane and
+///       x^(D - 32) for the high lane.
+consteval std::int64_t crc_fold_constant(unsigned n) {
+    auto r = std::uint32_t{1};
+    for ([[maybe_unused]] auto i : std::views::iota(0U, n)) {
+        r <<= 1;
+        if (r & 0x10000U) {
+            r ^= 0x11021U;
+        }
+    }
+    auto reflected = std::uint64_t{0};
+    for (auto bit : std::views::iota(0U, 32U)) {
+        if (r & (1U << bit)) {
+            reflected |= std::uint64_t{1} << (31U - bit);
+        }
+    }
+    return static_cast<std::int64_t>(reflected << 1);
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+#define AVIONICPP_TARGET_CLMUL __attribute__((target("pclmul,sse4.1")))
+#else
+#define AVIONICPP_TARGET_CLMUL
+#endif
+
+AVIONICPP_TARGET_CLMUL inline __m128i crc_fold(__m128i x, __m128i k) noexcept {
+    return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11));
+}
+
+AVIONICPP_TARGET_CLMUL inline __m128i crc_load(std::span<const std::uint8_t> data) noexcept {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data.data()));
+}
+
+}  // namespace detail
+
+/// @brief Reports whether the CPU supports the carry-less multiply instructions used by crc_accumulate_clmul.
+[[nodiscard]] inline bool crc_clmul_supported() noexcept {
+    static const auto supported = [] {
+#if defined(_MSC_VER)
+        auto info = std::array<int, 4>{};
+        __cpuid(info.data(), 1);
+        return (info[2] & (1 << 1)) != 0 && (info[2] & (1 << 19)) != 0;
+#else
+        return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+#endif
+    }();
+    return supported;
+}
+
+/// @brief Accumulate the X.25 CRC by folding 16-byte blocks with PCLMULQDQ.
+/// @note Folding keeps a 128-bit remainder that is congruent, modulo the generator, to everything consumed so far; it
+///       is reduced at the end by running it through the table kernel, which avoids a Barrett reduction step. The
+///       caller must check crc_clmul_supported() first; inputs under 16 bytes go straight to the sliced kernel.
+/// @param[inout] crc Current CRC value.
+/// @param[in] data Bytes to accumulate.
+AVIONICPP_TARGET_CLMUL inline void crc_accumulate_clmul(std::uint16_t& crc,
+                                                        std::span<const std::uint8_t> data) noexcept {
+    if (data.size() < 16) {
+        crc_accumulate_sliced<8>(crc, data);
+        return;
+    }
+
+    // the initial register value is equivalent to xor-ing it into the first two message bytes, with a zero register
+    auto x = _mm_xor_si128(detail::crc_load(data), _mm_cvtsi32_si128(crc));
+    data = data.subspan(16);
+
+    const auto fold_by_1 = _mm_set_epi64x(detail::crc_fold_constant(128 - 32), detail::crc_fold_constant(128 + 32));
+    if (data.size() >= 48) {
+        // four independent accumulators hide the multiplier latency
+        const auto fold_by_4 =
+            _mm_set_epi64x(detail::crc_fold_constant(512 - 32), detail::crc_fold_constant(512 + 32));
+        auto x1 = detail::crc_load(data);
+        auto x2 = detail::crc_load(data.subspan(16));
+        auto x3 = detail::crc_load(data.subspan(32));
+        data = data.subspan(48);
+        while (data.size() >= 64) {
+            x = _mm_xor_si128(detail::crc_fold(x, fold_by_4), detail::crc_load(data));
+            x1 = _mm_xor_si128(detail::crc_fold(x1, fold_by_4), detail::crc_load(data.subspan(16)));
+            x2 = _mm_xor_si128(detail::crc_fold(x2, fold_by_4), detail::crc_load(data.subspan(32)));
+            x3 = _mm_xor_si128(detail::crc_fold(x3, fold_by_4), detail::crc_load(data.subspan(48)));
+            data = data.subspan(64);
+        }
+        x = _mm_xor_si128(detail::crc_fold(x, fold_by_1), x1);
+        x = _mm_xor_si128(detail::crc_fold(x, fold_by_1), x2);
+        x = _mm_xor_si128(detail::crc_fold(x, fold_by_1), x3);
+    }
+    while (data.size() >= 16) {
+        x = _mm_xor_si128(detail::crc_fold(x, fold_by_1), detail::crc_load(data));
+        data = data.subspan(16);
+    }
+
+    auto remainder = std::array<std::uint8_t, 16>{};
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(remainder.data()), x);
+    crc = 0;
+    crc_accumulate_sliced<8>(crc, remainder);
+    crc_accumulate_sliced<8>(crc, data);
+}
+
+#undef AVIONICPP_TARGET_CLMUL
+
+#endif  // AVIONICPP_CRC_CLMUL
+
+}  // namespace mavlink
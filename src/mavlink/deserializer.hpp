@@ -3,6 +3,10 @@
 #include <boost/pfr.hpp>
 #include <cstring>
 #include <expected>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include "mavlink/message_registry.hpp"
 #include "mavlink/types.hpp"
 
 namespace mavlink {
@@ -34,24 +38,16 @@ constexpr void set_value(TxField<T>& dest, const T& src) {
     dest.value = src;
 }
 
-/// @brief Deserializes a MessageView into a payload struct.
+/// @brief Copies a payload into the fields of a payload struct one at a time, using PFR.
+/// @note Fields past the end of a zero-truncated payload are zeroed.
 /// @tparam MessageT The payload struct type.
-/// @param[in] view The message view to deserialize.
-/// @return The deserialized message struct or an error.
+/// @param[in] payload The payload bytes.
+/// @param[out] message The payload struct to fill.
 template <typename MessageT>
-[[nodiscard]] std::expected<MessageT, MavlinkError> deserialize(const MessageView& view) {
-    if (view.msgid != MessageT::MessageId) {
-        return std::unexpected(MavlinkError::ParseError);
-    }
-
-    auto message = MessageT{};
-
-    auto payload_ptr = view.payload.data();
-    auto payload_len = view.payload.size();
-    auto current_pos = payload_ptr;
-    auto end_pos = payload_ptr + payload_len;
+void deserialize_payload_fields(std::span<const std::uint8_t> payload, MessageT& message) {
+    auto current_pos = payload.data();
+    auto end_pos = payload.data() + payload.size();
 
-    // Iterate fields and copy
     boost::pfr::for_each_field(message, [&](auto& field) {
         using FieldType = std::remove_cvref_t<decltype(field)>;
         using ValueType = typename FieldType::ValueType;
@@ -68,7 +64,71 @@ template <typename MessageT>
 
         set_value(field, val);
     });
+}
+
+/// @brief Copies a payload into a payload struct, with a single memcpy if its layout is the wire layout.
+/// @note Fields past the end of a zero-truncated payload are zeroed.
+/// @tparam MessageT The payload struct type.
+/// @param[in] payload The payload bytes.
+/// @param[out] message The payload struct to fill.
+template <typename MessageT>
+void deserialize_payload(std::span<const std::uint8_t> payload, MessageT& message) {
+    if constexpr (WireCompatible<MessageT>) {
+        constexpr auto length = calculate_payload_length<MessageT>(boost::pfr::tuple_size_v<MessageT>);
+        auto copied = std::min(payload.size(), length);
+        auto bytes = reinterpret_cast<std::uint8_t*>(&message);
+        if (copied > 0) {
+            std::memcpy(bytes, payload.data(), copied);
+        }
+        std::memset(bytes + copied, 0, length - copied);
+    } else {
+        deserialize_payload_fields(payload, message);
+    }
+}
+
+/// @brief Whether every field of a payload struct is a ViewField.
+/// @tparam MessageT The payload struct type.
+template <typename MessageT>
+inline constexpr bool ViewPayload = []<std::size_t... I>(std::index_sequence<I...>) {
+    return (IsViewField<std::remove_cvref_t<typename boost::pfr::tuple_element<I, MessageT>::type>> && ...);
+}(std::make_index_sequence<boost::pfr::tuple_size_v<MessageT>>{});
+
+/// @brief Points the fields of a view payload struct at their bytes in a payload, without decoding them.
+/// @note Fields past the end of a zero-truncated payload view fewer (or no) bytes and read back as zero.
+/// @tparam MessageT The view payload struct type.
+/// @param[in] payload The payload bytes, which must outlive the struct.
+/// @param[out] message The payload struct to bind.
+template <typename MessageT>
+    requires ViewPayload<MessageT>
+void bind_payload(std::span<const std::uint8_t> payload, MessageT& message) {
+    auto offset = std::size_t{0};
+    boost::pfr::for_each_field(message, [&](auto& field) {
+        using ValueType = typename std::remove_cvref_t<decltype(field)>::ValueType;
+
+        auto start = std::min(offset, payload.size());
+        field.bytes = payload.subspan(start, std::min(payload.size() - start, sizeof(ValueType)));
+        offset += sizeof(ValueType);
+    });
+}
 
+/// @brief Deserializes a MessageView into a payload struct.
+/// @note View payloads (e.g. payloads::ViewAttitude) are bound to the view's payload instead of copied, so they are
+///       only valid while the payload bytes are.
+/// @tparam MessageT The payload struct type.
+/// @param[in] view The message view to deserialize.
+/// @return The deserialized message struct or an error.
+template <typename MessageT>
+[[nodiscard]] std::expected<MessageT, MavlinkError> deserialize(const MessageView& view) {
+    if (view.msgid != MessageT::MessageId) {
+        return std::unexpected(MavlinkError::ParseError);
+    }
+
+    auto message = MessageT{};
+    if constexpr (ViewPayload<MessageT>) {
+        bind_payload(view.payload, message);
+    } else {
+        deserialize_payload(view.payload, message);
+    }
     return message;
 }
 
@@ -0,0 +1,115 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+#include "mavlink/deserializer.hpp"
+#include "mavlink/types.hpp"
+
+namespace mavlink {
+
+/// @brief Multiplicative hash mapping a fixed set of msgids to distinct table slots.
+struct MsgidHash {
+    std::uint32_t multiplier = 0;  ///< Odd multiplier; 0 if no collision-free hash was found.
+    int bits = 0;                  ///< The table has 2^bits slots.
+
+    /// @brief Table slot of a msgid.
+    [[nodiscard]] constexpr std::size_t operator()(std::uint32_t msgid) const noexcept {
+        return static_cast<std::size_t>(static_cast<std::uint32_t>(msgid * multiplier) >> (32 - bits));
+    }
+};
+
+/// @brief Searches for a collision-free MsgidHash over a set of msgids.
+/// @note Tables from twice up to 64 times the number of msgids are tried, smallest first, each with a few hundred
+///       multipliers; sparse 24-bit msgid sets are hashed collision-free well within that range.
+/// @param[in] msgids The distinct msgids to hash.
+/// @return The hash, or one with a zero multiplier if none was found.
+template <std::size_t N>
+consteval MsgidHash find_msgid_hash(const std::array<std::uint32_t, N>& msgids) {
+    constexpr auto MinBits = static_cast<int>(std::bit_width(N)) + 1;
+    for (auto bits : std::views::iota(MinBits, MinBits + 6)) {
+        for (auto attempt : std::views::iota(std::uint32_t{0}, std::uint32_t{256})) {
+            auto hash = MsgidHash{(0x9E3779B1U + attempt * 0x6A09E668U) | 1U, bits};
+            auto used = std::vector<bool>(std::size_t{1} << bits);
+            auto collides = std::ranges::any_of(msgids, [&](std::uint32_t msgid) {
+                auto slot = hash(msgid);
+                auto taken = static_cast<bool>(used[slot]);
+                used[slot] = true;
+                return taken;
+            });
+            if (!collides) {
+                return hash;
+            }
+        }
+    }
+    return MsgidHash{};
+}
+
+/// @brief Dispatches a message view to the visitor, deserialized into the payload type registered for its msgid.
+/// @note The msgid table is perfect-hashed at compile time, so a dispatch costs one hash, one table probe and one
+///       indirect call however many payloads are registered.
+/// @tparam Payloads The payload types (e.g. payloads::LazyAttitude) to dispatch to.
+template <typename... Payloads>
+    requires(sizeof...(Payloads) > 0 && sizeof...(Payloads) < std::numeric_limits<std::uint16_t>::max())
+struct Dispatcher {
+    /// @brief Tries to match the view's msgid against the registered payloads and invokes the visitor.
+    /// @tparam Visitor Callable accepting std::expected<Payload, MavlinkError> for every registered Payload.
+    /// @param[in] view The message view to dispatch.
+    /// @param[in] visitor The visitor to invoke with the result.
+    /// @return true if a payload is registered for the msgid, false otherwise.
+    template <typename Visitor>
+    [[nodiscard]] static bool dispatch(const MessageView& view, Visitor&& visitor) noexcept {
+        const auto& slot = Slots[Hash(view.msgid)];
+        if (slot.index == EmptySlot || slot.msgid != view.msgid) {
+            return false;
+        }
+        Handlers<std::remove_reference_t<Visitor>>[slot.index](view, visitor);
+        return true;
+    }
+
+   private:
+    static constexpr auto MessageIds = std::array<std::uint32_t, sizeof...(Payloads)>{Payloads::MessageId...};
+    static_assert(
+        [] {
+            auto sorted = MessageIds;
+            std::ranges::sort(sorted);
+            return std::ranges::adjacent_find(sorted) == sorted.end();
+        }(),
+        "Each msgid may only be registered once");
+
+    static constexpr auto Hash = find_msgid_hash(MessageIds);
+    static_assert(Hash.multiplier != 0, "No collision-free hash found for the registered msgids");
+
+    static constexpr auto EmptySlot = std::numeric_limits<std::uint16_t>::max();
+
+    struct Slot {
+        std::uint32_t msgid = 0;
+        std::uint16_t index = EmptySlot;
+    };
+
+    static constexpr auto Slots = [] {
+        auto slots = std::array<Slot, std::size_t{1} << Hash.bits>{};
+        for (auto index : std::views::iota(std::size_t{0}, MessageIds.size())) {
+            slots[Hash(MessageIds[index])] = Slot{MessageIds[index], static_cast<std::uint16_t>(index)};
+        }
+        return slots;
+    }();
+
+    template <typename Payload, typename Visitor>
+    static void invoke(const MessageView& view, Visitor& visitor) {
+        std::invoke(visitor, deserialize<Payload>(view));
+    }
+
+    template <typename Visitor>
+    static constexpr auto Handlers =
+        std::array<void (*)(const MessageView&, Visitor&), sizeof...(Payloads)>{&invoke<Payloads, Visitor>...};
+};
+
+}  // namespace mavlink
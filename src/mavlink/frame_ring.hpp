@@ -0,0 +1,108 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include "mavlink/types.hpp"
+
+namespace mavlink {
+
+/// @brief One frame buffer of a FrameRing.
+struct FrameSlot {
+    /// @brief Longest Mavlink frame: a signed v2 frame with a 255-byte payload.
+    static constexpr std::size_t Capacity = HeaderLengthV2 + 255 + ChecksumLength + SignatureLength;
+
+    std::array<std::uint8_t, Capacity> bytes{};
+    std::atomic<bool> held{false};  ///< true while a MessageView into the slot is out with a consumer
+};
+
+/// @brief Fixed ring of frame slots that keeps MessageViews valid until they are released.
+/// @details A framer created with create_framer(FrameRing&) receives each frame into the ring's active slot. When it
+///          yields a view, the slot is held and the framer moves on to the next free slot, so the view stays valid
+///          until release() is called with it, possibly from another thread. Frames that push_bytes() validates in
+///          place are copied into the active slot first. When every other slot is held, the framer yields
+///          MavlinkError::BufferOverrun instead of the frame, and the frame is lost.
+/// @note The framer side (hold) must run on one thread; release may be called from any thread. A consumer releasing
+///       a view must be done with its bytes, since the slot is reused right away.
+/// @note Neither copyable nor movable; the framer keeps a pointer to the active slot span.
+class FrameRing {
+   public:
+    /// @brief Constructor.
+    /// @param[in] slots Storage for the frames; at least two slots, the active one and one held.
+    template <std::size_t Extent>
+        requires(Extent != std::dynamic_extent && Extent >= 2)
+    explicit FrameRing(std::span<FrameSlot, Extent> slots) noexcept : slots_(slots), active_(slots_.front().bytes) {}
+
+    /// @brief Constructor.
+    /// @param[in] slots Storage for the frames; at least two slots, the active one and one held.
+    template <std::size_t N>
+        requires(N >= 2)
+    explicit FrameRing(std::array<FrameSlot, N>& slots) noexcept : FrameRing(std::span<FrameSlot, N>(slots)) {}
+    FrameRing(const FrameRing&) = delete;
+    FrameRing(FrameRing&&) = delete;
+    auto operator=(const FrameRing&) = delete;
+    auto operator=(FrameRing&&) = delete;
+
+    /// @brief The working buffer of the framer, pointing at the active slot.
+    [[nodiscard]] std::span<std::uint8_t>* active() noexcept { return &active_; }
+
+    /// @brief Holds the frame of a view in the active slot and moves the active slot on to a free one.
+    /// @param[in] view A view yielded by the framer, into the active slot or (from push_bytes) into the caller's chunk.
+    /// @return The view, now into the held slot, or std::nullopt if no other slot is free.
+    [[nodiscard]] std::optional<MessageView> hold(const MessageView& view) noexcept {
+        auto free = std::optional<std::size_t>{};
+        for (auto step = std::size_t{1}; step < slots_.size() && !free; ++step) {
+            auto index = (active_index_ + step) % slots_.size();
+            if (!slots_[index].held.load(std::memory_order_acquire)) {
+                free = index;
+            }
+        }
+        if (!free) {
+            return std::nullopt;
+        }
+
+        auto& slot = slots_[active_index_];
+        auto held = view;
+        if (view.frame.data() != slot.bytes.data()) {
+            std::ranges::copy(view.frame, slot.bytes.begin());
+            auto payload_offset = static_cast<std::size_t>(view.payload.data() - view.frame.data());
+            held.frame = std::span<const std::uint8_t>(slot.bytes).first(view.frame.size());
+            held.payload = held.frame.subspan(payload_offset, view.payload.size());
+        }
+        slot.held.store(true, std::memory_order_relaxed);
+        active_index_ = *free;
+        active_ = slots_[active_index_].bytes;
+        return held;
+    }
+
+    /// @brief Gives the slot of a held view back to the framer; the view and copies of it become invalid.
+    /// @param[in] view A view returned by hold(), i.e. yielded by the framer.
+    void release(const MessageView& view) noexcept {
+        auto slot =
+            std::ranges::find_if(slots_, [&](const FrameSlot& s) { return s.bytes.data() == view.frame.data(); });
+        if (slot != slots_.end()) {
+            slot->held.store(false, std::memory_order_release);
+        }
+    }
+
+    /// @brief Number of slots held by consumers.
+    [[nodiscard]] std::size_t held() const noexcept {
+        return static_cast<std::size_t>(
+            std::ranges::count_if(slots_, [](const FrameSlot& s) { return s.held.load(std::memory_order_acquire); }));
+    }
+
+    /// @brief Number of slots, including the active one.
+    [[nodiscard]] std::size_t size() const noexcept { return slots_.size(); }
+
+   private:
+    std::span<FrameSlot> slots_;
+    std::size_t active_index_ = 0;
+    std::span<std::uint8_t> active_;
+};
+
+}  // namespace mavlink
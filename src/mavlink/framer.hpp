@@ -1,9 +1,16 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <coroutine>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <expected>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <new>
 #include <optional>
 #include <ranges>
 #include <span>
@@ -11,12 +18,56 @@
 #include <utility>
 #include <vector>
 
+#include "mavlink/checksum.hpp"
+#include "mavlink/frame_ring.hpp"
+#include "mavlink/message_registry.hpp"
+#include "mavlink/msgid_filter.hpp"
+#include "mavlink/signing.hpp"
 #include "mavlink/types.hpp"
 
 namespace mavlink {
 
 struct InputAwaiter;
 
+/// @brief Bytes a framer coroutine hands back to be scanned again, ahead of any new input.
+struct Rescan {
+    std::span<const std::uint8_t> bytes;
+};
+
+/// @brief Bytes a framer coroutine drops unread: the rest of a frame its MsgidFilter does not allow (none if the frame
+///        was read to check its checksum).
+struct Skip {
+    std::size_t length;
+};
+
+/// @brief Input a framer coroutine awaits while scanning for the STX of the next frame.
+struct StartMarker {};
+
+/// @brief Configuration of a Mavlink framer.
+struct FramerOptions {
+    /// @brief Messages whose checksum is validated, sorted by msgid (e.g. MessageRegistry<...>::Entries).
+    /// @note An empty table disables checksum validation entirely.
+    std::span<const MessageInfo> messages{};
+    /// @brief Handling of frames whose msgid is not in the table (ignored if the table is empty).
+    UnknownMessagePolicy unknown_messages = UnknownMessagePolicy::PassThrough;
+    /// @brief Verifier for signed frames; without one, signatures are not checked.
+    std::optional<std::reference_wrapper<SignatureVerifier>> signing{};
+    /// @brief Handling of unsigned frames when a verifier is set.
+    UnsignedMessagePolicy unsigned_messages = UnsignedMessagePolicy::Reject;
+    /// @brief Ring holding every yielded frame until it is released; set by create_framer(FrameRing&, ...).
+    std::optional<std::reference_wrapper<FrameRing>> ring{};
+    /// @brief Messages to yield; frames of other msgids are not yielded. Without one, every frame is yielded.
+    /// @note The header of a frame outside the set is not trusted unless it can be checked, so a false start marker
+    ///       in the noise cannot hide the frames behind it. A frame of a msgid in the message table is checksummed
+    ///       first (in place by push_bytes() when the whole frame is in the chunk, buffered otherwise), then counted
+    ///       in Framer::filtered() and skipped, or reported like any other frame if the checksum fails. A frame of a
+    ///       msgid not in the table cannot be told from noise: it is neither counted nor skipped, and scanning
+    ///       resumes at the byte after its start marker, so its payload is scanned for start markers and filtering
+    ///       such a msgid costs more than passing it through. Only without a message table are frames outside the
+    ///       set counted and dropped unread, as nothing is checked then.
+    std::optional<std::reference_wrapper<const MsgidFilter>> filter{};
+};
+
 /// @brief A coroutine-based Mavlink message framer.
 struct Framer {
     struct promise_type;
@@ -34,14 +85,82 @@ struct Framer {
     }
 
     /// @brief Pushes a byte into the framer and retrieves any yielded result.
+    /// @note When a frame is rejected (checksum mismatch, or unknown msgid with UnknownMessagePolicy::Drop), its bytes
+    ///       after the start marker are scanned again, ahead of new input, in case the marker was a corrupted byte and
+    ///       real frames were swallowed. Frames found that way are yielded by the following push_byte() or rescan()
+    ///       calls, one per call.
     /// @param[in] c The character to process.
     /// @return An optional ParseResult containing a MessageView or error if a message completed.
     [[nodiscard]] YieldedValue push_byte(std::uint8_t c);
 
+    /// @brief Scans the rest of the bytes of a rejected frame without new input.
+    /// @return The next result found, or std::nullopt once there is nothing left to scan.
+    [[nodiscard]] YieldedValue rescan();
+
+    /// @brief Pushes a chunk of bytes into the framer and invokes the visitor for every result it completes.
+    /// @note Frames lying entirely inside the chunk are located by scanning for the start marker and viewed in place,
+    ///       without resuming the coroutine. Only a frame straddling a chunk boundary is buffered through push_byte.
+    ///       Scanning resumes at the byte after the start marker of a rejected frame, and the bytes of a rejected
+    ///       buffered frame are rescanned before returning, so no result is left pending.
+    ///       A view passed to the visitor is valid only until the visitor returns, unless the framer has a FrameRing.
+    /// @tparam Visitor Callable accepting a ParseResult.
+    /// @param[in] bytes The received bytes.
+    /// @param[in] visitor The visitor to invoke with each result.
+    template <typename Visitor>
+    void push_bytes(std::span<const std::uint8_t> bytes, Visitor&& visitor);
+
+    /// @brief Number of frames skipped because FramerOptions::filter does not allow their msgid.
+    /// @note With a message table, only frames of msgids in the table whose checksum holds are counted; frames of
+    ///       other msgids cannot be told from noise and are not (see FramerOptions::filter).
+    [[nodiscard]] std::uint64_t filtered() const noexcept { return handle.promise().filtered; }
+
     struct promise_type {
+        /// @brief Capacity of the rescan queue. A rejected frame gives back at most one frame's bytes, and every
+        ///        byte pushed meanwhile is taken out before the next result, so twice the longest frame never fills.
+        static constexpr std::size_t RescanCapacity = 2 * (HeaderLengthV2 + 255 + ChecksumLength + SignatureLength);
+
         std::uint8_t current_input;
         YieldedValue current_output = std::nullopt;
-        bool just_yielded = false;
+        bool has_input = false;
+        FramerOptions options;
+        /// @brief Ring of bytes to scan before current_input; left uninitialized, as only queued bytes are read.
+        std::array<std::uint8_t, RescanCapacity> rescan_bytes;
+        std::size_t rescan_head = 0;
+        std::size_t rescan_size = 0;
+        std::uint64_t filtered = 0;  ///< frames skipped by the msgid filter
+        std::size_t skip = 0;        ///< bytes of a filtered frame still to be dropped before resuming the coroutine
+        bool awaiting_start = true;  ///< true while the coroutine scans for an STX, holding no part of a frame
+
+        promise_type(std::allocator_arg_t,
+                     [[maybe_unused]] std::pmr::memory_resource* resource,
+                     [[maybe_unused]] std::span<std::uint8_t>* active_buffer_ptr,
+                     const FramerOptions& framer_options)
+            : options(framer_options) {}
+
+        /// @brief Allocates the coroutine frame from the memory resource passed to create_framer, which is stored
+        ///        behind the frame for operator delete.
+        static void* operator new(std::size_t size,
+                                  std::allocator_arg_t,
+                                  std::pmr::memory_resource* resource,
+                                  std::span<std::uint8_t>*,
+                                  const FramerOptions&) {
+            auto* frame = resource->allocate(resource_offset(size) + sizeof(resource), alignof(std::max_align_t));
+            ::new (static_cast<std::byte*>(frame) + resource_offset(size)) std::pmr::memory_resource*(resource);
+            return frame;
+        }
+
+        static void operator delete(void* frame, std::size_t size) noexcept {
+            auto* resource =
+                *std::launder(reinterpret_cast<std::pmr::memory_resource**>(static_cast<std::byte*>(frame) +
+                                                                          resource_offset(size)));
+            resource->deallocate(frame, resource_offset(size) + sizeof(resource), alignof(std::max_align_t));
+        }
+
+        /// @brief Offset of the memory resource pointer behind a coroutine frame of the given size.
+        static constexpr std::size_t resource_offset(std::size_t size) noexcept {
+            constexpr auto Alignment = alignof(std::pmr::memory_resource*);
+            return (size + Alignment - 1) / Alignment * Alignment;
+        }
 
         Framer get_return_object() { return Framer{Handle::from_promise(*this)}; }
         std::suspend_never initial_suspend() { return {}; }
@@ -51,60 +170,356 @@ struct Framer {
 
         std::suspend_always yield_value(MessageView view) {
             current_output = ParseResult(view);
-            just_yielded = true;
             return {};
         }
 
         std::suspend_always yield_value(ErrorType error) {
             current_output = std::unexpected(error);
-            just_yielded = true;
             return {};
         }
 
         InputAwaiter await_transform(InputAwaiter);
+        InputAwaiter await_transform(StartMarker);
+
+        /// @brief Queues bytes to be scanned again, in order, ahead of the bytes already queued.
+        std::suspend_never await_transform(Rescan rescan) {
+            for (auto b : rescan.bytes | std::views::reverse) {
+                rescan_head = (rescan_head + RescanCapacity - 1) % RescanCapacity;
+                rescan_bytes[rescan_head] = b;
+            }
+            rescan_size = std::min(rescan_size + rescan.bytes.size(), RescanCapacity);
+            return {};
+        }
+
+        /// @brief Counts a filtered frame and drops the rest of its bytes, queued ones first, then as they are pushed.
+        std::suspend_never await_transform(Skip rest) {
+            auto queued = std::min(rest.length, rescan_size);
+            rescan_head = (rescan_head + queued) % RescanCapacity;
+            rescan_size -= queued;
+            skip = rest.length - queued;
+            ++filtered;
+            return {};
+        }
+
+        /// @brief Queues a byte behind the bytes already queued.
+        void push_input(std::uint8_t c) {
+            if (rescan_size == 0) {
+                current_input = c;
+                has_input = true;
+            } else if (rescan_size < RescanCapacity) {
+                rescan_bytes[(rescan_head + rescan_size++) % RescanCapacity] = c;
+            }
+        }
+
+        /// @brief Takes the next byte to scan: a queued one first, then the pushed one.
+        std::uint8_t next_input() {
+            if (rescan_size == 0) {
+                has_input = false;
+                return current_input;
+            }
+            auto b = rescan_bytes[rescan_head];
+            rescan_head = (rescan_head + 1) % RescanCapacity;
+            --rescan_size;
+            return b;
+        }
     };
+
+   private:
+    bool in_frame_ = false;  ///< true while the coroutine holds a partially received frame or bytes to rescan
+
+    /// @brief Updates in_frame_ after resuming the coroutine.
+    /// @param[in] yielded Whether the coroutine yielded; it then goes back to scanning for an STX when resumed.
+    void update_in_frame(bool yielded) noexcept {
+        const auto& promise = handle.promise();
+        in_frame_ = promise.rescan_size > 0 || (!yielded && !promise.awaiting_start);
+    }
+
+    /// @brief Holds a yielded frame in the ring, if there is one.
+    [[nodiscard]] YieldedValue hold(YieldedValue output);
 };
 
 struct InputAwaiter {
     Framer::promise_type* promise;
     explicit InputAwaiter(Framer::promise_type* p = nullptr) : promise(p) {}
-    bool await_ready() {
-        if (promise->just_yielded) {
-            promise->just_yielded = false;
-            return true;
-        }
-        return false;
-    }
+    bool await_ready() { return promise->has_input || promise->rescan_size > 0; }
     void await_suspend(std::coroutine_handle<>) {}
-    std::uint8_t await_resume() { return promise->current_input; }
+    std::uint8_t await_resume() { return promise->next_input(); }
 };
 
 inline InputAwaiter Framer::promise_type::await_transform(InputAwaiter) {
+    awaiting_start = false;
+    return InputAwaiter{this};
+}
+
+inline InputAwaiter Framer::promise_type::await_transform(StartMarker) {
+    awaiting_start = true;
     return InputAwaiter{this};
 }
 
 inline Framer::YieldedValue Framer::push_byte(std::uint8_t c) {
-    handle.promise().current_input = c;
+    if (handle.promise().skip > 0) {
+        --handle.promise().skip;
+        return std::nullopt;
+    }
+    handle.promise().push_input(c);
     handle.promise().current_output = std::nullopt;
     if (!handle.done()) {
         handle.resume();
     }
-    return std::move(handle.promise().current_output);
+    auto output = std::move(handle.promise().current_output);
+    update_in_frame(output.has_value());
+    return hold(std::move(output));
 }
 
-/// @brief Creates a coroutine-based Mavlink parser state machine.
+inline Framer::YieldedValue Framer::rescan() {
+    if (handle.promise().rescan_size == 0) {
+        return std::nullopt;
+    }
+    handle.promise().current_output = std::nullopt;
+    if (!handle.done()) {
+        handle.resume();
+    }
+    auto output = std::move(handle.promise().current_output);
+    update_in_frame(output.has_value());
+    return hold(std::move(output));
+}
+
+inline Framer::YieldedValue Framer::hold(YieldedValue output) {
+    const auto& ring = handle.promise().options.ring;
+    if (!ring || !output || !output->has_value()) {
+        return output;
+    }
+    if (auto view = ring->get().hold(output->value())) {
+        return ParseResult{*view};
+    }
+    return ParseResult{std::unexpected(std::make_pair(MavlinkError::BufferOverrun, "Frame ring full"))};
+}
+
+/// @brief Locates the first Mavlink start-of-frame marker in a byte range.
+/// @note Scans a 64-bit word at a time, using the classic "has zero byte" test on the word xor'ed with each marker.
+/// @param[in] bytes The bytes to scan.
+/// @return Index of the first 0xFD or 0xFE byte, or bytes.size() if there is none.
+[[nodiscard]] inline std::size_t find_start_marker(std::span<const std::uint8_t> bytes) noexcept {
+    constexpr auto Ones = std::uint64_t{0x0101010101010101};
+    constexpr auto Highs = std::uint64_t{0x8080808080808080};
+    constexpr auto has_byte = [](std::uint64_t word, std::uint8_t value) {
+        auto x = word ^ (Ones * value);
+        return ((x - Ones) & ~x & Highs) != 0;
+    };
+
+    auto idx = std::size_t{0};
+    while (idx + sizeof(std::uint64_t) <= bytes.size()) {
+        auto word = std::uint64_t{0};
+        std::memcpy(&word, bytes.data() + idx, sizeof(word));
+        if (has_byte(word, MagicV1) || has_byte(word, MagicV2)) {
+            break;
+        }
+        idx += sizeof(word);
+    }
+    auto tail = bytes.subspan(idx);
+    auto found = std::ranges::find_if(tail, [](std::uint8_t b) { return b == MagicV1 || b == MagicV2; });
+    return idx + static_cast<std::size_t>(found - tail.begin());
+}
+
+/// @brief Computes the length of the frame starting at the front of a byte range.
+/// @param[in] bytes Bytes starting with a start-of-frame marker.
+/// @return The total frame length, or std::nullopt if the header is not complete yet.
+[[nodiscard]] inline std::optional<std::size_t> frame_length(std::span<const std::uint8_t> bytes) noexcept {
+    auto header_length = (bytes[0] == MagicV2) ? HeaderLengthV2 : HeaderLengthV1;
+    if (bytes.size() < header_length) {
+        return std::nullopt;
+    }
+    auto is_signed = bytes[0] == MagicV2 && (bytes[2] & IncompatFlagSigned) != 0;
+    return header_length + bytes[1] + ChecksumLength + (is_signed ? SignatureLength : 0);
+}
+
+/// @brief Reads the msgid of the frame starting at the front of a byte range.
+/// @param[in] header Bytes starting with a start-of-frame marker, at least a complete header.
+/// @return The message ID.
+[[nodiscard]] inline std::uint32_t frame_msgid(std::span<const std::uint8_t> header) noexcept {
+    if (header[0] == MagicV2) {
+        return header[7] | (header[8] << 8) | (header[9] << 16);
+    }
+    return header[5];
+}
+
+/// @brief Builds a MessageView over a complete frame.
+/// @param[in] frame The complete frame, starting with its start-of-frame marker.
+/// @return A view whose payload and frame refer into the frame.
+[[nodiscard]] inline MessageView parse_frame(std::span<const std::uint8_t> frame) noexcept {
+    auto view = MessageView{};
+    view.frame = frame;
+    if (frame[0] == MagicV2) {
+        view.incompat_flags = frame[2];
+        view.compat_flags = frame[3];
+        view.seq = frame[4];
+        view.sysid = frame[5];
+        view.compid = frame[6];
+        view.msgid = frame_msgid(frame);
+        view.payload = frame.subspan(HeaderLengthV2, frame[1]);
+    } else {
+        view.seq = frame[2];
+        view.sysid = frame[3];
+        view.compid = frame[4];
+        view.msgid = frame_msgid(frame);
+        view.payload = frame.subspan(HeaderLengthV1, frame[1]);
+    }
+    return view;
+}
+
+/// @brief Checks the signature of a complete frame against the framer options.
+/// @param[in] frame The complete frame, starting with its start-of-frame marker.
+/// @param[in] options The framer options holding the signature verifier.
+/// @return The error to report, or std::nullopt if the frame is accepted.
+[[nodiscard]] inline std::optional<Framer::ErrorType> check_signature(std::span<const std::uint8_t> frame,
+                                                                      const FramerOptions& options) noexcept {
+    if (!options.signing) {
+        return std::nullopt;
+    }
+    if (frame[0] == MagicV2 && (frame[2] & IncompatFlagSigned) != 0) {
+        if (auto verified = options.signing->get().verify(frame); !verified) {
+            return std::make_pair(MavlinkError::InvalidSignature, verified.error());
+        }
+        return std::nullopt;
+    }
+    if (options.unsigned_messages == UnsignedMessagePolicy::Accept) {
+        return std::nullopt;
+    }
+    return std::make_pair(MavlinkError::InvalidSignature, std::string_view{"Unsigned message"});
+}
+
+/// @brief Checks the checksum of a complete frame, CRC_EXTRA included.
+/// @param[in] frame The complete frame, starting with its start-of-frame marker.
+/// @param[in] info The table entry of the frame's msgid.
+/// @return true if the received checksum matches.
+[[nodiscard]] inline bool checksum_matches(std::span<const std::uint8_t> frame, const MessageInfo& info) noexcept {
+    auto header_length = (frame[0] == MagicV2) ? HeaderLengthV2 : HeaderLengthV1;
+    auto checked_length = header_length + frame[1];
+    auto crc = std::uint16_t{0xFFFF};
+    crc_accumulate_buffer(crc, reinterpret_cast<const char*>(frame.data() + 1), checked_length - 1);
+    crc_accumulate(info.crc_extra, crc);
+    auto received_crc = static_cast<std::uint16_t>(frame[checked_length] | (frame[checked_length + 1] << 8));
+    return crc == received_crc;
+}
+
+/// @brief Checks a complete frame against the framer options.
+/// @param[in] frame The complete frame, starting with its start-of-frame marker.
+/// @param[in] options The framer options holding the message table.
+/// @return The result to report, or std::nullopt if the frame is to be dropped silently.
+[[nodiscard]] inline Framer::YieldedValue validate_frame(std::span<const std::uint8_t> frame,
+                                                         const FramerOptions& options) noexcept {
+    auto view = parse_frame(frame);
+    auto info = find_message_info(options.messages, view.msgid);
+    if (!info && !options.messages.empty() && options.unknown_messages == UnknownMessagePolicy::Drop) {
+        return std::nullopt;
+    }
+
+    if (info && !checksum_matches(frame, *info)) {
+        return Framer::ParseResult{std::unexpected(std::make_pair(MavlinkError::InvalidChecksum, "Checksum mismatch"))};
+    }
+    if (auto error = check_signature(frame, options)) {
+        return Framer::ParseResult{std::unexpected(*error)};
+    }
+    return Framer::ParseResult{view};
+}
+
+template <typename Visitor>
+void Framer::push_bytes(std::span<const std::uint8_t> bytes, Visitor&& visitor) {
+    while (!bytes.empty()) {
+        if (auto& skip = handle.promise().skip; skip > 0) {
+            // drop the rest of a filtered frame left over from the previous chunk
+            auto skipped = std::min(skip, bytes.size());
+            skip -= skipped;
+            bytes = bytes.subspan(skipped);
+            continue;
+        }
+        if (in_frame_) {
+            // finish the frame left over from the previous chunk
+            if (auto result = push_byte(bytes.front())) {
+                std::invoke(visitor, std::move(*result));
+            }
+            bytes = bytes.subspan(1);
+            continue;
+        }
+
+        bytes = bytes.subspan(find_start_marker(bytes));
+        if (bytes.empty()) {
+            break;
+        }
+
+        auto length = frame_length(bytes);
+        const auto& options = handle.promise().options;
+        if (length && options.filter && !options.filter->get().contains(frame_msgid(bytes))) {
+            if (options.messages.empty()) {
+                // nothing is checked: skip the frame unread, dropping any part of it still to come with the next chunk
+                auto skipped = std::min(*length, bytes.size());
+                ++handle.promise().filtered;
+                handle.promise().skip = *length - skipped;
+                bytes = bytes.subspan(skipped);
+                continue;
+            }
+            auto info = find_message_info(options.messages, frame_msgid(bytes));
+            if (!info) {
+                // a header that cannot be checked may be noise hiding real frames, so scan on from the byte after it
+                bytes = bytes.subspan(1);
+                continue;
+            }
+            if (*length <= bytes.size()) {
+                // skip the frame once its checksum shows the header is genuine, otherwise report it and scan on
+                if (checksum_matches(bytes.first(*length), *info)) {
+                    ++handle.promise().filtered;
+                    bytes = bytes.subspan(*length);
+                } else {
+                    std::invoke(visitor, ParseResult{std::unexpected(
+                                             std::make_pair(MavlinkError::InvalidChecksum, "Checksum mismatch"))});
+                    bytes = bytes.subspan(1);
+                }
+                continue;
+            }
+        }
+        if (!length || *length > bytes.size()) {
+            // frame is cut off by the end of the chunk, so hand it to the coroutine to buffer
+            if (auto result = push_byte(bytes.front())) {
+                std::invoke(visitor, std::move(*result));
+            }
+            bytes = bytes.subspan(1);
+            continue;
+        }
+
+        auto result = validate_frame(bytes.first(*length), handle.promise().options);
+        // a rejected frame may start at a corrupted byte and hide real frames, so scan on from the byte after it
+        auto rejected = !result || (!result->has_value() && result->error().first == MavlinkError::InvalidChecksum);
+        if (result) {
+            std::invoke(visitor, std::move(*hold(std::move(result))));
+        }
+        bytes = bytes.subspan(rejected ? 1 : *length);
+    }
+    while (auto result = rescan()) {
+        std::invoke(visitor, std::move(*result));
+    }
+}
+
+/// @brief Creates a coroutine-based Mavlink parser state machine whose coroutine frame is allocated from a memory
+///        resource, e.g. a std::pmr::unsynchronized_pool_resource reused by the framers of every connection, or a
+///        std::pmr::monotonic_buffer_resource over a fixed buffer with std::pmr::null_memory_resource() upstream.
+/// @param[in] resource The memory resource; it must outlive the framer.
 /// @param[in] active_buffer_ptr Pointer to a span used as a working buffer.
+/// @param[in] options Message table, signature verifier and policies used to validate frames.
 /// @return A Framer instance.
-inline Framer create_framer(std::span<std::uint8_t>* active_buffer_ptr) {
+inline Framer create_framer(std::allocator_arg_t,
+                            [[maybe_unused]] std::pmr::memory_resource* resource,
+                            std::span<std::uint8_t>* active_buffer_ptr,
+                            FramerOptions options = {}) {
     while (true) {
         auto view = MessageView{};
         auto magic = std::uint8_t{0};
         auto idx = size_t{0};
+        auto received_crc = std::uint16_t{0};
 
         // 1. Wait for STX
         do {
-            magic = co_await InputAwaiter{};
-        } while (magic != 0xFD && magic != 0xFE);
+            magic = co_await StartMarker{};
+        } while (magic != MagicV2 && magic != MagicV1);
         (*active_buffer_ptr)[idx++] = magic;
 
         // 2. Read Payload Length
@@ -112,12 +527,14 @@ inline Framer create_framer(std::span<std::uint8_t>* active_buffer_ptr) {
         (*active_buffer_ptr)[idx++] = len;
 
         // 3. Read Header Fields
-        if (magic == 0xFD) {
+        if (magic == MagicV2) {
             // Mavlink v2
             // INC_FLAGS
-            (*active_buffer_ptr)[idx++] = co_await InputAwaiter{};
+            view.incompat_flags = co_await InputAwaiter{};
+            (*active_buffer_ptr)[idx++] = view.incompat_flags;
             // CMP_FLAGS
-            (*active_buffer_ptr)[idx++] = co_await InputAwaiter{};
+            view.compat_flags = co_await InputAwaiter{};
+            (*active_buffer_ptr)[idx++] = view.compat_flags;
         }
         // common to Mavlink v1 and v2
         // SEQ
@@ -133,7 +550,7 @@ inline Framer create_framer(std::span<std::uint8_t>* active_buffer_ptr) {
         view.msgid = co_await InputAwaiter{} & 0xFF;
         (*active_buffer_ptr)[idx++] = view.msgid;
 
-        if (magic == 0xFD) {
+        if (magic == MagicV2) {
             // Mavlink v2 MSGID is 3 bytes, total, little endian
             auto id_mid = co_await InputAwaiter{};
             view.msgid |= id_mid << 8;
@@ -143,9 +560,30 @@ inline Framer create_framer(std::span<std::uint8_t>* active_buffer_ptr) {
             (*active_buffer_ptr)[idx++] = id_hi;
         }
 
+        // A frame the filter does not allow is only counted. Without a message table nothing is checked, so its
+        // payload, checksum and signature are dropped unread. Otherwise a header of an unknown msgid cannot be
+        // checked and may be noise hiding real frames, so its bytes are scanned again from the one after the STX;
+        // a known one is read and dropped once its checksum holds.
+        auto filtered = options.filter && !options.filter->get().contains(view.msgid);
+        if (filtered && options.messages.empty()) {
+            auto is_signed = magic == MagicV2 && (view.incompat_flags & IncompatFlagSigned) != 0;
+            co_await Skip{len + ChecksumLength + (is_signed ? SignatureLength : 0)};
+            continue;
+        }
+        if (filtered && !find_message_info(options.messages, view.msgid)) {
+            co_await Rescan{std::span<const std::uint8_t>(active_buffer_ptr->data() + 1, idx - 1)};
+            continue;
+        }
+
         // Payload Starts at the current index
         view.payload = std::span<const std::uint8_t>(active_buffer_ptr->data() + idx, len);
 
+        // The checksum covers the header (without STX) and the payload; the header is accumulated here in one go,
+        // the payload byte by byte as it arrives
+        auto crc = std::uint16_t{0xFFFF};
+        crc_accumulate_buffer(crc, reinterpret_cast<const char*>(active_buffer_ptr->data() + 1), idx - 1);
+        auto info = find_message_info(options.messages, view.msgid);
+
         // 4. Read Payload
         for ([[maybe_unused]] auto i : std::ranges::iota_view{size_t{0}, static_cast<size_t>(len)}) {
             auto b = co_await InputAwaiter{};
@@ -153,24 +591,28 @@ inline Framer create_framer(std::span<std::uint8_t>* active_buffer_ptr) {
                 co_yield std::make_pair(MavlinkError::BufferOverrun, "Buffer overrun");
                 goto next_message;
             }
+            crc_accumulate(b, crc);
             (*active_buffer_ptr)[idx++] = b;
         }
 
-        // 5. Read CRC (2 bytes)
-        {
-            auto crc1 = co_await InputAwaiter{};
-            (*active_buffer_ptr)[idx++] = crc1;
-            auto crc2 = co_await InputAwaiter{};
-            (*active_buffer_ptr)[idx++] = crc2;
+        // 5. Read CRC (2 bytes, little endian)
+        for (auto shift : {0, 8}) {
+            auto b = co_await InputAwaiter{};
+            if (idx >= active_buffer_ptr->size()) {
+                co_yield std::make_pair(MavlinkError::BufferOverrun, "Buffer overrun");
+                goto next_message;
+            }
+            received_crc |= static_cast<std::uint16_t>(b << shift);
+            (*active_buffer_ptr)[idx++] = b;
         }
 
         // 6. Signature (v2 only, if incompatible flags & 0x01)
         // Check incompat flags (byte at index 2 for v2)
-        if (magic == 0xFD) {
+        if (magic == MagicV2) {
             auto inc_flags = (*active_buffer_ptr)[2];
-            if (inc_flags & 0x01) {
+            if (inc_flags & IncompatFlagSigned) {
                 // Read 13 bytes signature
-                for (auto i : std::ranges::iota_view{0, 13}) {
+                for (auto i : std::ranges::iota_view{size_t{0}, SignatureLength}) {
                     (void)i;  // Unused
                     auto b = co_await InputAwaiter{};
                     if (idx >= active_buffer_ptr->size()) {
@@ -182,12 +624,68 @@ inline Framer create_framer(std::span<std::uint8_t>* active_buffer_ptr) {
             }
         }
 
-        // TODO: Validate Checksum here if we had the CRC extra info.
+        // 7. Validate Checksum; the bytes of a rejected frame are scanned again from the one after its STX
+        if (info) {
+            crc_accumulate(info->crc_extra, crc);
+            if (crc != received_crc) {
+                co_await Rescan{std::span<const std::uint8_t>(active_buffer_ptr->data() + 1, idx - 1)};
+                co_yield std::make_pair(MavlinkError::InvalidChecksum, "Checksum mismatch");
+                goto next_message;
+            }
+        } else if (!options.messages.empty() && options.unknown_messages == UnknownMessagePolicy::Drop) {
+            co_await Rescan{std::span<const std::uint8_t>(active_buffer_ptr->data() + 1, idx - 1)};
+            goto next_message;
+        }
+
+        if (filtered) {
+            co_await Skip{0};
+            goto next_message;
+        }
+
+        // 8. Validate Signature
+        if (auto error = check_signature(std::span<const std::uint8_t>(active_buffer_ptr->data(), idx), options)) {
+            co_yield *error;
+            goto next_message;
+        }
 
+        view.frame = std::span<const std::uint8_t>(active_buffer_ptr->data(), idx);
         co_yield view;
 
     next_message:;
     }
 }
 
+/// @brief Creates a coroutine-based Mavlink parser state machine.
+/// @note The coroutine frame is allocated from std::pmr::get_default_resource().
+/// @param[in] active_buffer_ptr Pointer to a span used as a working buffer.
+/// @param[in] options Message table, signature verifier and policies used to validate frames.
+/// @return A Framer instance.
+inline Framer create_framer(std::span<std::uint8_t>* active_buffer_ptr, FramerOptions options = {}) {
+    return create_framer(std::allocator_arg, std::pmr::get_default_resource(), active_buffer_ptr, options);
+}
+
+/// @brief Creates a Mavlink parser state machine receiving into a FrameRing, so that yielded views stay valid until
+///        they are released to the ring.
+/// @param[in] ring The ring of frame slots; it must outlive the framer.
+/// @param[in] options Message table, signature verifier and policies used to validate frames.
+/// @return A Framer instance.
+inline Framer create_framer(FrameRing& ring, FramerOptions options = {}) {
+    options.ring = ring;
+    return create_framer(ring.active(), options);
+}
+
+/// @brief Creates a Mavlink parser state machine receiving into a FrameRing, with its coroutine frame allocated from a
+///        memory resource.
+/// @param[in] resource The memory resource; it must outlive the framer.
+/// @param[in] ring The ring of frame slots; it must outlive the framer.
+/// @param[in] options Message table, signature verifier and policies used to validate frames.
+/// @return A Framer instance.
+inline Framer create_framer(std::allocator_arg_t,
+                            std::pmr::memory_resource* resource,
+                            FrameRing& ring,
+                            FramerOptions options = {}) {
+    options.ring = ring;
+    return create_framer(std::allocator_arg, resource, ring.active(), options);
+}
+
 }  // namespace mavlink
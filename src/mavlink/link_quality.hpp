@@ -0,0 +1,195 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <bitset>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+
+#include "mavlink/types.hpp"
+
+namespace mavlink {
+
+/// @brief Link quality of one (sysid, compid) source.
+struct LinkQuality {
+    std::uint64_t received;    ///< Distinct frames received since the source was first heard.
+    std::uint64_t lost;        ///< Frames missing from the sequence, less those that arrived late.
+    std::uint64_t duplicated;  ///< Frames repeating a recently received sequence number.
+    std::uint64_t reordered;   ///< Frames that arrived after a later sequence number.
+    std::uint64_t bytes;       ///< Raw frame bytes received.
+    double loss_rate;          ///< Lost / (received + lost) over the rolling window.
+    double bytes_per_second;   ///< Byte rate over the rolling window.
+};
+
+/// @brief Tracks sequence gaps and traffic rates of every Mavlink source.
+/// @note A sequence number up to half the sequence space ahead of the expected one counts the frames in between as
+///       lost; one behind it is a duplicate if that sequence number was already received in the last half of the
+///       sequence space, and a late (reordered) frame otherwise. A late frame is taken off the loss of the bucket that
+///       counted its gap. The rolling window is a ring of buckets tagged with the time slot they cover, so recording a
+///       frame is O(1) and stale buckets are simply skipped when a window is summed. The source table is a fixed-size
+///       open addressing hash table; sources beyond its capacity are not tracked.
+/// @tparam MaxSources Capacity of the source table (a power of two).
+/// @tparam WindowBuckets Number of buckets in the rolling window.
+template <std::size_t MaxSources = 32, std::size_t WindowBuckets = 10>
+    requires(std::has_single_bit(MaxSources) && WindowBuckets > 0)
+class LinkQualityTracker {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Constructor.
+    /// @param[in] bucket_length Time covered by one bucket; the window covers WindowBuckets of them.
+    explicit LinkQualityTracker(Clock::duration bucket_length = std::chrono::milliseconds{100}) noexcept
+        : bucket_length_(bucket_length) {}
+
+    /// @brief Records a received frame.
+    /// @param[in] view The received frame.
+    /// @param[in] now Time of reception.
+    void record(const MessageView& view, Clock::time_point now) noexcept {
+        auto index = index_of(view.sysid, view.compid);
+        if (!index) {
+            return;
+        }
+        auto& source = sources_[*index];
+        if (!source.in_use) {
+            source = Source{true, view.sysid, view.compid};
+        }
+        auto& bucket = current_bucket(source, now);
+        source.bytes += view.frame.size();
+        bucket.bytes += view.frame.size();
+
+        if (source.received == 0) {
+            source.received = 1;
+            bucket.received = 1;
+            source.last_seq = view.seq;
+            source.seen.set(view.seq);
+            return;
+        }
+        auto gap = static_cast<std::uint8_t>(view.seq - source.last_seq - 1);
+        if (gap < 128) {
+            for (auto skipped : std::views::iota(1U, gap + 1U)) {
+                auto seq = static_cast<std::uint8_t>(source.last_seq + skipped);
+                source.seen.reset(seq);
+                source.lost_slot[seq] = static_cast<std::uint32_t>(bucket.slot);
+            }
+            source.seen.set(view.seq);
+            source.received += 1;
+            bucket.received += 1;
+            source.lost += gap;
+            bucket.lost += gap;
+            source.last_seq = view.seq;
+        } else if (source.seen.test(view.seq)) {
+            source.duplicated += 1;
+        } else {
+            // a frame counted as lost arrived late
+            source.seen.set(view.seq);
+            source.received += 1;
+            bucket.received += 1;
+            source.reordered += 1;
+            source.lost -= source.lost > 0 ? 1 : 0;
+            // the bucket that counted the gap may have been reused since; then its loss has left the window already
+            auto counted = std::ranges::find(source.window, source.lost_slot[view.seq],
+                                             [](const Bucket& b) { return static_cast<std::uint32_t>(b.slot); });
+            if (counted != source.window.end() && counted->lost > 0) {
+                counted->lost -= 1;
+            }
+        }
+    }
+
+    /// @brief Link quality of a source.
+    /// @param[in] sysid The system ID.
+    /// @param[in] compid The component ID.
+    /// @param[in] now Current time, which ends the rolling window.
+    /// @return The link quality, or std::nullopt if the source has not been heard.
+    [[nodiscard]] std::optional<LinkQuality> quality(std::uint8_t sysid,
+                                                     std::uint8_t compid,
+                                                     Clock::time_point now) const noexcept {
+        auto index = index_of(sysid, compid);
+        if (!index || !sources_[*index].in_use) {
+            return std::nullopt;
+        }
+        const auto& source = sources_[*index];
+
+        auto slot = time_slot(now);
+        auto received = std::uint64_t{0};
+        auto lost = std::uint64_t{0};
+        auto bytes = std::uint64_t{0};
+        for (const auto& bucket : source.window) {
+            if (bucket.slot <= slot && slot - bucket.slot < static_cast<std::int64_t>(WindowBuckets)) {
+                received += bucket.received;
+                lost += bucket.lost;
+                bytes += bucket.bytes;
+            }
+        }
+        auto window_seconds = std::chrono::duration<double>(bucket_length_ * WindowBuckets).count();
+        return LinkQuality{
+            source.received,
+            source.lost,
+            source.duplicated,
+            source.reordered,
+            source.bytes,
+            (received + lost) > 0 ? static_cast<double>(lost) / static_cast<double>(received + lost) : 0.0,
+            static_cast<double>(bytes) / window_seconds,
+        };
+    }
+
+   private:
+    struct Bucket {
+        std::int64_t slot = -1;
+        std::uint32_t received = 0;
+        std::uint32_t lost = 0;
+        std::uint64_t bytes = 0;
+    };
+
+    struct Source {
+        bool in_use = false;
+        std::uint8_t sysid = 0;
+        std::uint8_t compid = 0;
+        std::uint8_t last_seq = 0;
+        std::uint64_t received = 0;
+        std::uint64_t lost = 0;
+        std::uint64_t duplicated = 0;
+        std::uint64_t reordered = 0;
+        std::uint64_t bytes = 0;
+        std::bitset<256> seen{};  ///< sequence numbers received in the last half of the sequence space
+        std::array<std::uint32_t, 256> lost_slot{};  ///< low bits of the time slot that counted each missing sequence
+        std::array<Bucket, WindowBuckets> window{};
+    };
+
+    /// @brief Finds the table entry of a source by linear probing.
+    /// @return The index of the source's entry, or of the free entry it would take, or std::nullopt if the table is
+    ///         full.
+    [[nodiscard]] std::optional<std::size_t> index_of(std::uint8_t sysid, std::uint8_t compid) const noexcept {
+        auto hash = static_cast<std::size_t>(sysid) * 131U + compid;
+        for (auto probe : std::views::iota(std::size_t{0}, MaxSources)) {
+            auto index = (hash + probe) & (MaxSources - 1);
+            const auto& source = sources_[index];
+            if (!source.in_use || (source.sysid == sysid && source.compid == compid)) {
+                return index;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /// @brief Index of the bucket-length time slot containing a point in time.
+    [[nodiscard]] std::int64_t time_slot(Clock::time_point time) const noexcept {
+        return static_cast<std::int64_t>(time.time_since_epoch() / bucket_length_);
+    }
+
+    /// @brief The bucket for the current time slot, reset if it last covered an older slot.
+    Bucket& current_bucket(Source& source, Clock::time_point now) noexcept {
+        auto slot = time_slot(now);
+        auto& bucket = source.window[static_cast<std::size_t>(slot) % WindowBuckets];
+        if (bucket.slot != slot) {
+            bucket = Bucket{slot};
+        }
+        return bucket;
+    }
+
+    Clock::duration bucket_length_;
+    std::array<Source, MaxSources> sources_{};
+};
+
+}  // namespace mavlink
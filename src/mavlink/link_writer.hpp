@@ -0,0 +1,153 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "mavlink/message_registry.hpp"
+#include "mavlink/serializer.hpp"
+#include "mavlink/signing.hpp"
+#include "uart/uart.hpp"
+
+namespace mavlink {
+
+/// @brief Counters of a LinkWriter.
+struct LinkWriterStats {
+    std::uint64_t frames;  ///< Frames queued into the batch buffer.
+    std::uint64_t bytes;   ///< Bytes written to the UART.
+    std::uint64_t writes;  ///< Calls to UART::write (one per flush, unless the UART writes short).
+};
+
+/// @brief Writes the outgoing Mavlink frames of one link, in batches.
+/// @note The writer owns the link's sequence number and serializes frames back to back into its batch buffer, so a
+///       flush hands all of them to the UART in a single write. A batch is flushed when the next frame does not fit,
+///       or on the first write or poll after its deadline (measured from its first frame) has passed.
+/// @tparam UARTType The UART implementation (e.g. uart::PosixUART).
+/// @tparam Capacity Size of the batch buffer; it must hold at least one frame of every message written.
+template <typename UARTType, std::size_t Capacity = 2048>
+class LinkWriter {
+   public:
+    using Clock = std::chrono::steady_clock;
+    using Error = std::pair<int, std::string>;
+
+    /// @brief Constructor.
+    /// @param[in] uart The UART to write to, which must outlive the writer.
+    /// @param[in] sysid System ID of the frames.
+    /// @param[in] compid Component ID of the frames.
+    /// @param[in] deadline Longest time a frame waits in the batch buffer, checked on write and poll.
+    /// @param[in] signer Signer for the frames, which must outlive the writer; frames are unsigned if null.
+    LinkWriter(uart::UART<UARTType>& uart,
+               std::uint8_t sysid,
+               std::uint8_t compid,
+               Clock::duration deadline = std::chrono::milliseconds{5},
+               Signer* signer = nullptr) noexcept
+        : uart_(uart), sysid_(sysid), compid_(compid), deadline_(deadline), signer_(signer) {}
+
+    /// @brief Serializes a message into the batch with the next sequence number, flushing the batch if it is due.
+    /// @tparam MessageT The message type struct.
+    /// @param[in] message The message to write.
+    /// @param[in] now Current time.
+    /// @return The number of bytes flushed to the UART by this call (0 if the frame was only batched),
+    ///         error code and string via std::unexpected if a flush failed.
+    template <typename MessageT>
+    auto write(const MessageT& message, Clock::time_point now) -> std::expected<std::size_t, Error> {
+        static_assert(Capacity >= MaxSignedFrameLength<MessageT>, "Batch buffer cannot hold a frame of this message");
+
+        auto flushed = std::size_t{0};
+        if (Capacity - used_ < MaxSignedFrameLength<MessageT>) {
+            auto result = flush();
+            if (!result) {
+                return result;
+            }
+            flushed = *result;
+            if (Capacity - used_ < MaxSignedFrameLength<MessageT>) {
+                return std::unexpected(Error{static_cast<int>(std::errc::no_buffer_space), "Batch buffer is full"});
+            }
+        }
+
+        auto slot = std::span(buffer_).subspan(used_);
+        auto length = signer_ ? serialize(message, sysid_, compid_, seq_, slot, *signer_)
+                              : serialize(message, sysid_, compid_, seq_, slot);
+        ++seq_;
+        if (used_ == 0) {
+            due_ = now + deadline_;
+        }
+        used_ += *length;
+        stats_.frames += 1;
+
+        auto result = poll(now);
+        if (!result) {
+            return result;
+        }
+        return flushed + *result;
+    }
+
+    /// @brief Flushes the batch if its deadline has passed.
+    /// @param[in] now Current time.
+    /// @return The number of bytes flushed to the UART,
+    ///         error code and string via std::unexpected if the flush failed.
+    auto poll(Clock::time_point now) -> std::expected<std::size_t, Error> {
+        if (used_ == 0 || now < due_) {
+            return 0;
+        }
+        return flush();
+    }
+
+    /// @brief Writes the whole batch to the UART.
+    /// @note If the UART writes short (e.g. on a timeout), the rest stays at the front of the batch for the next flush.
+    /// @return The number of bytes written,
+    ///         error code and string via std::unexpected if the UART write failed.
+    auto flush() -> std::expected<std::size_t, Error> {
+        auto written = std::size_t{0};
+        while (written < used_) {
+            auto result = uart_.write(std::span(buffer_).subspan(written, used_ - written));
+            stats_.writes += 1;
+            if (!result) {
+                discard(written);
+                return std::unexpected(result.error());
+            }
+            if (*result == 0) {
+                break;
+            }
+            written += *result;
+        }
+        discard(written);
+        return written;
+    }
+
+    /// @brief Bytes waiting in the batch buffer.
+    [[nodiscard]] std::span<const std::uint8_t> pending() const noexcept { return std::span(buffer_).first(used_); }
+
+    /// @brief Sequence number of the next frame.
+    [[nodiscard]] std::uint8_t sequence() const noexcept { return seq_; }
+
+    /// @brief Counters since construction.
+    [[nodiscard]] const LinkWriterStats& stats() const noexcept { return stats_; }
+
+   private:
+    /// @brief Drops written bytes from the front of the batch.
+    void discard(std::size_t written) noexcept {
+        std::ranges::copy(std::span(buffer_).subspan(written, used_ - written), buffer_.begin());
+        used_ -= written;
+        stats_.bytes += written;
+    }
+
+    uart::UART<UARTType>& uart_;
+    std::uint8_t sysid_;
+    std::uint8_t compid_;
+    Clock::duration deadline_;
+    Signer* signer_;
+    std::array<std::uint8_t, Capacity> buffer_{};
+    std::size_t used_ = 0;
+    std::uint8_t seq_ = 0;
+    Clock::time_point due_{};
+    LinkWriterStats stats_{};
+};
+
+}  // namespace mavlink
@@ -0,0 +1,167 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <boost/pfr.hpp>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "mavlink/checksum.hpp"
+#include "mavlink/types.hpp"
+
+namespace mavlink {
+
+/// @brief Compile-time description of a message, as needed to validate its frames.
+struct MessageInfo {
+    std::uint32_t msgid;      ///< Message ID.
+    std::uint8_t crc_extra;   ///< CRC_EXTRA byte seeded into the frame checksum.
+    std::uint8_t min_length;  ///< Payload length of the base fields.
+    std::uint8_t max_length;  ///< Payload length including extension fields.
+    std::optional<std::uint8_t> target_system_offset;     ///< Payload offset of target_system, if the message has one.
+    std::optional<std::uint8_t> target_component_offset;  ///< Payload offset of target_component, if any.
+};
+
+/// @brief What a framer does with frames whose msgid is not in its message table.
+enum class UnknownMessagePolicy {
+    PassThrough,  ///< yield the frame without checking its checksum (e.g. for routing)
+    Drop          ///< discard the frame silently
+};
+
+/// @brief What a framer with a signature verifier does with unsigned frames.
+enum class UnsignedMessagePolicy {
+    Accept,  ///< yield the frame (e.g. during a migration to signed links)
+    Reject   ///< yield MavlinkError::InvalidSignature
+};
+
+/// @brief Sum of the wire sizes of the leading fields of a message.
+/// @tparam MessageT The message type struct.
+/// @param[in] field_count Number of leading fields to include.
+/// @return The payload length in bytes.
+template <typename MessageT>
+consteval std::size_t calculate_payload_length(std::size_t field_count) {
+    return [&]<std::size_t... I>(std::index_sequence<I...>) {
+        auto length = std::size_t{0};
+        ((length += (I < field_count)
+                        ? sizeof(typename UnwrapField<
+                                 std::remove_cvref_t<typename boost::pfr::tuple_element<I, MessageT>::type>>::Type)
+                        : 0),
+         ...);
+        return length;
+    }(std::make_index_sequence<boost::pfr::tuple_size_v<MessageT>>{});
+}
+
+/// @brief Longest Mavlink v2 frame a message serializes to: header, untruncated payload and checksum.
+/// @tparam MessageT The message type struct.
+template <typename MessageT>
+inline constexpr std::size_t MaxFrameLength =
+    HeaderLengthV2 + calculate_payload_length<MessageT>(boost::pfr::tuple_size_v<MessageT>) + ChecksumLength;
+
+/// @brief Longest signed Mavlink v2 frame a message serializes to, including the signature block.
+/// @tparam MessageT The message type struct.
+template <typename MessageT>
+inline constexpr std::size_t MaxSignedFrameLength = MaxFrameLength<MessageT> + SignatureLength;
+
+/// @brief Whether a message's in-memory layout is its little-endian wire layout.
+/// @details Holds on little-endian targets when every field wrapper is as large as its value and sits at its wire
+///          offset (the sum of the preceding field sizes), i.e. each wire offset is a multiple of the field's
+///          alignment, so no padding precedes any field. Tail padding is allowed, since it is past the payload.
+/// @tparam MessageT The message type struct.
+/// @return True if the payload can be copied to and from the struct with a single memcpy.
+template <typename MessageT>
+consteval bool is_wire_compatible() {
+    if constexpr (std::endian::native != std::endian::little || !std::is_trivially_copyable_v<MessageT> ||
+                  !std::is_standard_layout_v<MessageT>) {
+        return false;
+    } else {
+        constexpr auto wire_length = calculate_payload_length<MessageT>(boost::pfr::tuple_size_v<MessageT>);
+        auto compatible = [&]<std::size_t... I>(std::index_sequence<I...>) {
+            return ([&] {
+                using FieldType = std::remove_cvref_t<typename boost::pfr::tuple_element<I, MessageT>::type>;
+                using ValueType = typename UnwrapField<FieldType>::Type;
+                return sizeof(FieldType) == sizeof(ValueType) &&
+                       calculate_payload_length<MessageT>(I) % alignof(FieldType) == 0;
+            }() && ...);
+        }(std::make_index_sequence<boost::pfr::tuple_size_v<MessageT>>{});
+        // the struct is exactly the wire layout rounded up to its alignment, so nothing else hides in it
+        constexpr auto padded_length = (wire_length + alignof(MessageT) - 1) / alignof(MessageT) * alignof(MessageT);
+        return compatible && sizeof(MessageT) == padded_length;
+    }
+}
+
+/// @brief Whether a message's payload is serialized and deserialized with a single memcpy.
+/// @tparam MessageT The message type struct.
+template <typename MessageT>
+inline constexpr bool WireCompatible = is_wire_compatible<MessageT>();
+
+/// @brief Payload offset of a named field.
+/// @tparam MessageT The message type struct.
+/// @param[in] name The field name.
+/// @return The offset in bytes, or std::nullopt if the message has no such field.
+template <typename MessageT>
+consteval std::optional<std::uint8_t> calculate_field_offset(std::string_view name) {
+    auto offset = std::optional<std::uint8_t>{};
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (([&] {
+             if (boost::pfr::get_name<I, MessageT>() == name) {
+                 offset = static_cast<std::uint8_t>(calculate_payload_length<MessageT>(I));
+             }
+         }()),
+         ...);
+    }(std::make_index_sequence<boost::pfr::tuple_size_v<MessageT>>{});
+    return offset;
+}
+
+/// @brief Builds the MessageInfo of a payload type.
+/// @tparam MessageT The message type struct.
+template <typename MessageT>
+consteval MessageInfo make_message_info() {
+    constexpr auto min_length = calculate_payload_length<MessageT>(base_field_count<MessageT>());
+    constexpr auto max_length = calculate_payload_length<MessageT>(boost::pfr::tuple_size_v<MessageT>);
+    static_assert(max_length <= 255, "Mavlink payloads are limited to 255 bytes");
+    return MessageInfo{MessageT::MessageId,
+                       MessageT::CrcExtra(),
+                       static_cast<std::uint8_t>(min_length),
+                       static_cast<std::uint8_t>(max_length),
+                       calculate_field_offset<MessageT>("target_system"),
+                       calculate_field_offset<MessageT>("target_component")};
+}
+
+/// @brief Looks up a message in a table sorted by msgid.
+/// @param[in] messages The table, sorted by msgid.
+/// @param[in] msgid The message ID to look up.
+/// @return The message description, or std::nullopt if the msgid is not in the table.
+[[nodiscard]] constexpr std::optional<MessageInfo> find_message_info(std::span<const MessageInfo> messages,
+                                                                     std::uint32_t msgid) noexcept {
+    auto found = std::ranges::lower_bound(messages, msgid, {}, &MessageInfo::msgid);
+    if (found == messages.end() || found->msgid != msgid) {
+        return std::nullopt;
+    }
+    return *found;
+}
+
+/// @brief Compile-time table of the messages a framer can validate.
+/// @tparam Payloads The payload types (e.g. payloads::Heartbeat) to register.
+template <typename... Payloads>
+struct MessageRegistry {
+    /// @brief Message descriptions, sorted by msgid.
+    static constexpr auto Entries = [] {
+        auto entries = std::array<MessageInfo, sizeof...(Payloads)>{make_message_info<Payloads>()...};
+        std::ranges::sort(entries, {}, &MessageInfo::msgid);
+        return entries;
+    }();
+    static_assert(std::ranges::adjacent_find(Entries, {}, &MessageInfo::msgid) == Entries.end(),
+                  "Each msgid may only be registered once");
+
+    /// @brief Looks up a registered message.
+    /// @param[in] msgid The message ID to look up.
+    /// @return The message description, or std::nullopt if the msgid is not registered.
+    [[nodiscard]] static constexpr std::optional<MessageInfo> find(std::uint32_t msgid) noexcept {
+        return find_message_info(Entries, msgid);
+    }
+};
+
+}  // namespace mavlink
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "mavlink/message_registry.hpp"
+
+namespace mavlink {
+
+/// @brief Set of msgids a framer yields; frames of any other message are skipped unread.
+/// @details A bitmap over the 24-bit msgid space, split into 256-bit pages of which only the pages holding an allowed
+///          msgid are stored. The first page (msgids below 256, which covers Mavlink v1 and most common messages) is
+///          always present and tested directly; the others are found by binary search.
+class MsgidFilter {
+   public:
+    /// @brief Constructs a filter that allows no message.
+    MsgidFilter() = default;
+
+    /// @brief Constructs a filter that allows the listed messages.
+    /// @param[in] msgids The allowed message IDs.
+    MsgidFilter(std::initializer_list<std::uint32_t> msgids) {
+        for (auto msgid : msgids) {
+            allow(msgid);
+        }
+    }
+
+    /// @brief Constructs a filter that allows the listed messages.
+    /// @param[in] msgids The allowed message IDs.
+    explicit MsgidFilter(std::span<const std::uint32_t> msgids) { allow(msgids); }
+
+    /// @brief Constructs a filter that allows the messages of a table.
+    /// @param[in] messages The allowed messages (e.g. MessageRegistry<...>::Entries).
+    explicit MsgidFilter(std::span<const MessageInfo> messages) {
+        for (const auto& info : messages) {
+            allow(info.msgid);
+        }
+    }
+
+    /// @brief Builds a filter that allows the given payload types.
+    /// @tparam Payloads The payload types (e.g. payloads::Attitude) to allow.
+    template <typename... Payloads>
+    [[nodiscard]] static MsgidFilter of() {
+        return MsgidFilter{Payloads::MessageId...};
+    }
+
+    /// @brief Allows a message.
+    /// @param[in] msgid The message ID; only its low 24 bits are used.
+    void allow(std::uint32_t msgid) {
+        auto& page = (msgid & MsgidMask) < PageBits ? first_ : find_or_add(page_of(msgid));
+        page[bit_of(msgid) / 64] |= std::uint64_t{1} << (bit_of(msgid) % 64);
+    }
+
+    /// @brief Allows several messages.
+    /// @param[in] msgids The message IDs.
+    void allow(std::span<const std::uint32_t> msgids) {
+        for (auto msgid : msgids) {
+            allow(msgid);
+        }
+    }
+
+    /// @brief Checks whether a message is allowed.
+    /// @param[in] msgid The message ID.
+    /// @return True if frames of the message are to be yielded.
+    [[nodiscard]] bool contains(std::uint32_t msgid) const noexcept {
+        if (msgid < PageBits) {
+            return test(first_, msgid);
+        }
+        auto found = std::ranges::lower_bound(pages_, page_of(msgid), {}, &std::pair<std::uint32_t, Page>::first);
+        return found != pages_.end() && found->first == page_of(msgid) && test(found->second, msgid);
+    }
+
+   private:
+    static constexpr std::uint32_t MsgidMask = 0xFFFFFF;
+    static constexpr std::uint32_t PageBits = 256;
+    using Page = std::array<std::uint64_t, PageBits / 64>;
+
+    static constexpr std::uint32_t page_of(std::uint32_t msgid) noexcept { return (msgid & MsgidMask) / PageBits; }
+    static constexpr std::uint32_t bit_of(std::uint32_t msgid) noexcept { return msgid % PageBits; }
+    static constexpr bool test(const Page& page, std::uint32_t msgid) noexcept {
+        return (page[bit_of(msgid) / 64] >> (bit_of(msgid) % 64)) & 1;
+    }
+
+    Page& find_or_add(std::uint32_t page) {
+        auto found = std::ranges::lower_bound(pages_, page, {}, &std::pair<std::uint32_t, Page>::first);
+        if (found == pages_.end() || found->first != page) {
+            found = pages_.insert(found, {page, Page{}});
+        }
+        return found->second;
+    }
+
+    Page first_{};                                       ///< msgids 0-255
+    std::vector<std::pair<std::uint32_t, Page>> pages_;  ///< other pages holding an allowed msgid, sorted by page
+};
+
+}  // namespace mavlink
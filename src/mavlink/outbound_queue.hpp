@@ -0,0 +1,302 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <ranges>
+#include <span>
+
+#include "mavlink/framer.hpp"
+#include "mavlink/serializer.hpp"
+#include "mavlink/types.hpp"
+#include "uart/settings.hpp"
+
+namespace mavlink {
+
+/// @brief Priority classes of outgoing frames, highest first.
+enum class OutboundPriority : std::uint8_t {
+    Command,    ///< commands, acknowledgements and heartbeats
+    Control,    ///< setpoints and other frames that must not wait behind telemetry
+    Telemetry,  ///< periodic state (e.g. ATTITUDE), of which only the newest matters
+    Bulk        ///< parameter, mission and log transfers
+};
+
+/// @brief Number of OutboundPriority classes.
+inline constexpr std::size_t OutboundPriorityCount = 4;
+
+/// @brief What a push does with a pending frame of the same message from the same system.
+enum class CoalescePolicy {
+    Keep,    ///< queue the new frame behind it
+    Replace  ///< overwrite it with the new frame, keeping its place in the queue
+};
+
+/// @brief Counters of an OutboundQueue.
+struct OutboundQueueStats {
+    std::uint64_t pushed;     ///< Frames accepted by push.
+    std::uint64_t sent;       ///< Frames handed to the sink.
+    std::uint64_t coalesced;  ///< Pending frames overwritten by a newer one.
+    std::uint64_t evicted;    ///< Lower-priority frames dropped to make room for a higher-priority one.
+    std::uint64_t rejected;   ///< Frames not accepted because the queue was full of equal or higher priority ones.
+    std::uint64_t expired;    ///< Frames dropped because they waited longer than their class's maximum age.
+};
+
+/// @brief Schedules the outgoing frames of one slow link by priority, against the link's line rate.
+/// @note Sending is admitted against a token bucket of line time: it fills at one second per second up to the
+///       burst size, and each frame drains it by the time its characters take on the wire at the link's baud rate.
+///       The highest-priority pending frame always goes first; if it does not fit the budget, nothing is sent until
+///       it does. When the queue is full, a push evicts the oldest frame of the lowest class below its own.
+/// @tparam MaxFrames Number of frame slots.
+template <std::size_t MaxFrames = 64>
+    requires(MaxFrames > 0 && MaxFrames < 0xFFFF)
+class OutboundQueue {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Room for the longest (signed) Mavlink v2 frame.
+    static constexpr std::size_t SlotLength = HeaderLengthV2 + 255 + ChecksumLength + SignatureLength;
+
+    /// @brief Constructor.
+    /// @param[in] baud The link's baud rate.
+    /// @param[in] burst_bytes Bytes that may be sent back to back after the link was idle (at least one full frame).
+    /// @param[in] charsize Data bits per character.
+    /// @param[in] parity Parity of the link.
+    /// @param[in] stopbits Stop bits per character.
+    explicit OutboundQueue(uart::BaudRate baud,
+                           std::size_t burst_bytes = 2 * SlotLength,
+                           uart::CharacterSize charsize = uart::CharacterSize::cs8,
+                           uart::Parity parity = uart::Parity::none,
+                           uart::StopBits stopbits = uart::StopBits::sb1) noexcept
+        : bits_per_second_(uart::bits_per_second(baud)),
+          half_bits_per_character_(uart::half_bits_per_character(charsize, parity, stopbits)),
+          burst_(wire_time(std::max(burst_bytes, SlotLength))),
+          credit_(burst_) {
+        for (auto slot : std::views::iota(std::size_t{0}, MaxFrames)) {
+            slots_[slot].next = static_cast<std::uint16_t>(slot + 1);
+        }
+        slots_[MaxFrames - 1].next = None;
+        max_age_.fill(Clock::duration::max());
+    }
+
+    /// @brief Time a frame occupies the link.
+    /// @param[in] length Frame length in bytes.
+    [[nodiscard]] Clock::duration wire_time(std::size_t length) const noexcept {
+        if (bits_per_second_ == 0) {
+            return Clock::duration::max();
+        }
+        auto nanoseconds = std::uint64_t{length} * half_bits_per_character_ * 500'000'000U / bits_per_second_;
+        return std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds{nanoseconds});
+    }
+
+    /// @brief Sets how long frames of a class may wait before they are dropped as stale.
+    /// @param[in] priority The class.
+    /// @param[in] max_age The maximum age (unlimited by default).
+    void set_max_age(OutboundPriority priority, Clock::duration max_age) noexcept {
+        max_age_[static_cast<std::size_t>(priority)] = max_age;
+    }
+
+    /// @brief Queues a serialized frame.
+    /// @param[in] frame The complete frame, at most SlotLength bytes; a span that is not exactly one frame is rejected.
+    /// @param[in] priority The frame's class.
+    /// @param[in] now Current time.
+    /// @param[in] policy Whether the frame replaces a pending one of the same msgid and sysid in its class.
+    /// @return true if the frame was queued (or replaced a pending one), false if it was rejected.
+    bool push(std::span<const std::uint8_t> frame,
+              OutboundPriority priority,
+              Clock::time_point now,
+              CoalescePolicy policy = CoalescePolicy::Keep) noexcept {
+        if (frame.empty() || (frame[0] != MagicV2 && frame[0] != MagicV1)) {
+            return false;
+        }
+        // the header must be complete and its payload length must account for exactly the bytes given
+        if (auto length = frame_length(frame); !length || *length != frame.size() || *length > SlotLength) {
+            return false;
+        }
+        auto view = parse_frame(frame);
+        auto slot = acquire(priority, view.msgid, view.sysid, now, policy);
+        if (!slot) {
+            return false;
+        }
+        std::ranges::copy(frame, slots_[*slot].bytes.begin());
+        slots_[*slot].length = static_cast<std::uint16_t>(frame.size());
+        return true;
+    }
+
+    /// @brief Serializes a message straight into a queue slot.
+    /// @tparam MessageT The message type struct.
+    /// @param[in] message The message to queue.
+    /// @param[in] sysid System ID of the frame.
+    /// @param[in] compid Component ID of the frame.
+    /// @param[in] seq Sequence number of the frame.
+    /// @param[in] priority The frame's class.
+    /// @param[in] now Current time.
+    /// @param[in] policy Whether the frame replaces a pending one of the same msgid and sysid in its class.
+    /// @return true if the frame was queued (or replaced a pending one), false if it was rejected.
+    template <typename MessageT>
+    bool push(const MessageT& message,
+              std::uint8_t sysid,
+              std::uint8_t compid,
+              std::uint8_t seq,
+              OutboundPriority priority,
+              Clock::time_point now,
+              CoalescePolicy policy = CoalescePolicy::Keep) noexcept {
+        auto slot = acquire(priority, MessageT::MessageId, sysid, now, policy);
+        if (!slot) {
+            return false;
+        }
+        auto length = serialize(message, sysid, compid, seq, std::span(slots_[*slot].bytes));
+        slots_[*slot].length = static_cast<std::uint16_t>(length);
+        return true;
+    }
+
+    /// @brief Hands the frames the line budget admits to the sink, highest priority first.
+    /// @tparam Sink Callable accepting the frame bytes, which are only valid during the call.
+    /// @param[in] now Current time.
+    /// @param[in] sink The sink to invoke for each admitted frame.
+    /// @return The number of frames sent.
+    template <typename Sink>
+    std::size_t send(Clock::time_point now, Sink&& sink) {
+        if (now > last_refill_) {
+            credit_ = (burst_ - credit_ < now - last_refill_) ? burst_ : credit_ + (now - last_refill_);
+        }
+        last_refill_ = std::max(last_refill_, now);
+
+        auto sent = std::size_t{0};
+        while (auto priority = highest_pending(now)) {
+            auto& queue = queues_[*priority];
+            auto& slot = slots_[queue.head];
+            auto cost = wire_time(slot.length);
+            if (cost > credit_) {
+                break;
+            }
+            credit_ -= cost;
+            std::invoke(sink, std::span<const std::uint8_t>(slot.bytes).first(slot.length));
+            release(*priority);
+            ++sent;
+        }
+        stats_.sent += sent;
+        return sent;
+    }
+
+    /// @brief Number of pending frames.
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    /// @brief Number of pending frames of a class.
+    [[nodiscard]] std::size_t size(OutboundPriority priority) const noexcept {
+        return queues_[static_cast<std::size_t>(priority)].size;
+    }
+
+    /// @brief Counters since construction.
+    [[nodiscard]] const OutboundQueueStats& stats() const noexcept { return stats_; }
+
+   private:
+    static constexpr std::uint16_t None = 0xFFFF;
+
+    struct Slot {
+        std::array<std::uint8_t, SlotLength> bytes;
+        std::uint16_t length;
+        std::uint16_t next;
+        std::uint32_t msgid;
+        std::uint8_t sysid;
+        Clock::time_point queued;
+    };
+
+    struct Queue {
+        std::uint16_t head = None;
+        std::uint16_t tail = None;
+        std::size_t size = 0;
+    };
+
+    /// @brief Finds the slot a new frame goes into: a pending frame it replaces, a free slot or an evicted one.
+    std::optional<std::uint16_t> acquire(OutboundPriority priority,
+                                         std::uint32_t msgid,
+                                         std::uint8_t sysid,
+                                         Clock::time_point now,
+                                         CoalescePolicy policy) noexcept {
+        auto index = static_cast<std::size_t>(priority);
+        if (policy == CoalescePolicy::Replace) {
+            for (auto slot = queues_[index].head; slot != None; slot = slots_[slot].next) {
+                if (slots_[slot].msgid == msgid && slots_[slot].sysid == sysid) {
+                    slots_[slot].queued = now;
+                    ++stats_.coalesced;
+                    return slot;
+                }
+            }
+        }
+        if (free_ == None) {
+            auto lowest = OutboundPriorityCount - 1;
+            while (lowest > index && queues_[lowest].size == 0) {
+                --lowest;
+            }
+            if (lowest == index) {
+                ++stats_.rejected;
+                return std::nullopt;
+            }
+            release(lowest);
+            ++stats_.evicted;
+        }
+
+        auto slot = free_;
+        free_ = slots_[slot].next;
+        slots_[slot].next = None;
+        slots_[slot].msgid = msgid;
+        slots_[slot].sysid = sysid;
+        slots_[slot].queued = now;
+        auto& queue = queues_[index];
+        if (queue.tail == None) {
+            queue.head = slot;
+        } else {
+            slots_[queue.tail].next = slot;
+        }
+        queue.tail = slot;
+        ++queue.size;
+        ++size_;
+        ++stats_.pushed;
+        return slot;
+    }
+
+    /// @brief Frees the frame at the head of a class.
+    void release(std::size_t index) noexcept {
+        auto& queue = queues_[index];
+        auto slot = queue.head;
+        queue.head = slots_[slot].next;
+        if (queue.head == None) {
+            queue.tail = None;
+        }
+        slots_[slot].next = free_;
+        free_ = slot;
+        --queue.size;
+        --size_;
+    }
+
+    /// @brief The highest class with a pending frame, after dropping its stale frames.
+    std::optional<std::size_t> highest_pending(Clock::time_point now) noexcept {
+        for (auto index : std::views::iota(std::size_t{0}, OutboundPriorityCount)) {
+            auto& queue = queues_[index];
+            while (queue.head != None && now - slots_[queue.head].queued > max_age_[index]) {
+                release(index);
+                ++stats_.expired;
+            }
+            if (queue.head != None) {
+                return index;
+            }
+        }
+        return std::nullopt;
+    }
+
+    std::uint32_t bits_per_second_;
+    std::uint32_t half_bits_per_character_;
+    Clock::duration burst_;
+    Clock::duration credit_;
+    Clock::time_point last_refill_{};
+    std::array<Slot, MaxFrames> slots_{};
+    std::array<Queue, OutboundPriorityCount> queues_{};
+    std::array<Clock::duration, OutboundPriorityCount> max_age_{};
+    std::uint16_t free_ = 0;
+    std::size_t size_ = 0;
+    OutboundQueueStats stats_{};
+};
+
+}  // namespace mavlink
@@ -28,5 +28,6 @@ struct Attitude_T {
 
 using Attitude = Attitude_T<TxTraits>;
 using LazyAttitude = Attitude_T<RxTraits>;
+using ViewAttitude = Attitude_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
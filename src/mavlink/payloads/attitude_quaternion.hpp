@@ -30,5 +30,6 @@ struct AttitudeQuaternion_T {
 
 using AttitudeQuaternion = AttitudeQuaternion_T<TxTraits>;
 using LazyAttitudeQuaternion = AttitudeQuaternion_T<RxTraits>;
+using ViewAttitudeQuaternion = AttitudeQuaternion_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
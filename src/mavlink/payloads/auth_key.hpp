@@ -24,5 +24,6 @@ struct AuthKey_T {
 
 using AuthKey = AuthKey_T<TxTraits>;
 using LazyAuthKey = AuthKey_T<RxTraits>;
+using ViewAuthKey = AuthKey_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
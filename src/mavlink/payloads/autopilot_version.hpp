@@ -18,6 +18,7 @@ template <typename Traits>
 struct AutopilotVersion_T {
     static constexpr std::uint32_t MessageId = 148;
     static constexpr std::string_view MessageName = "AUTOPILOT_VERSION";
+    static constexpr std::size_t BaseFieldCount = 11;  ///< uid2 is a Mavlink 2 extension field
 
     typename Traits::template Field<std::uint64_t> capabilities;           ///< Bitmap of capabilities
     typename Traits::template Field<std::uint64_t> uid;                    ///< UID if provided by hardware (see uid2)
@@ -44,5 +45,6 @@ struct AutopilotVersion_T {
 
 using AutopilotVersion = AutopilotVersion_T<TxTraits>;
 using LazyAutopilotVersion = AutopilotVersion_T<RxTraits>;
+using ViewAutopilotVersion = AutopilotVersion_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
@@ -32,5 +32,6 @@ struct ChangeOperatorControl_T {
 
 using ChangeOperatorControl = ChangeOperatorControl_T<TxTraits>;
 using LazyChangeOperatorControl = ChangeOperatorControl_T<RxTraits>;
+using ViewChangeOperatorControl = ChangeOperatorControl_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
@@ -26,5 +26,6 @@ struct ChangeOperatorControlAck_T {
 
 using ChangeOperatorControlAck = ChangeOperatorControlAck_T<TxTraits>;
 using LazyChangeOperatorControlAck = ChangeOperatorControlAck_T<RxTraits>;
+using ViewChangeOperatorControlAck = ChangeOperatorControlAck_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
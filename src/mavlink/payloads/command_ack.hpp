@@ -28,5 +28,6 @@ struct CommandAck_T {
 
 using CommandAck = CommandAck_T<TxTraits>;
 using LazyCommandAck = CommandAck_T<RxTraits>;
+using ViewCommandAck = CommandAck_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
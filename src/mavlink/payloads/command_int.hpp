@@ -39,5 +39,6 @@ struct CommandInt_T {
 
 using CommandInt = CommandInt_T<TxTraits>;
 using LazyCommandInt = CommandInt_T<RxTraits>;
+using ViewCommandInt = CommandInt_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
@@ -36,5 +36,6 @@ struct CommandLong_T {
 
 using CommandLong = CommandLong_T<TxTraits>;
 using LazyCommandLong = CommandLong_T<RxTraits>;
+using ViewCommandLong = CommandLong_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "mavlink/message_registry.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/attitude_quaternion.hpp"
+#include "mavlink/payloads/auth_key.hpp"
+#include "mavlink/payloads/autopilot_version.hpp"
+#include "mavlink/payloads/change_operator_control.hpp"
+#include "mavlink/payloads/change_operator_control_ack.hpp"
+#include "mavlink/payloads/command_ack.hpp"
+#include "mavlink/payloads/command_int.hpp"
+#include "mavlink/payloads/command_long.hpp"
+#include "mavlink/payloads/global_position_int.hpp"
+#include "mavlink/payloads/gps_raw_int.hpp"
+#include "mavlink/payloads/gps_status.hpp"
+#include "mavlink/payloads/heartbeat.hpp"
+#include "mavlink/payloads/local_position_ned.hpp"
+#include "mavlink/payloads/param_request_list.hpp"
+#include "mavlink/payloads/param_request_read.hpp"
+#include "mavlink/payloads/param_set.hpp"
+#include "mavlink/payloads/param_value.hpp"
+#include "mavlink/payloads/raw_imu.hpp"
+#include "mavlink/payloads/raw_pressure.hpp"
+#include "mavlink/payloads/rc_channels_raw.hpp"
+#include "mavlink/payloads/rc_channels_scaled.hpp"
+#include "mavlink/payloads/scaled_imu.hpp"
+#include "mavlink/payloads/scaled_pressure.hpp"
+#include "mavlink/payloads/sys_status.hpp"
+#include "mavlink/payloads/system_time.hpp"
+#include "mavlink/payloads/vfr_hud.hpp"
+
+namespace mavlink::payloads {
+
+/// @brief Registry of every message defined in this library, for validating received frames.
+using CommonMessages = MessageRegistry<Heartbeat,
+                                       SysStatus,
+                                       SystemTime,
+                                       ChangeOperatorControl,
+                                       ChangeOperatorControlAck,
+                                       AuthKey,
+                                       ParamRequestRead,
+                                       ParamRequestList,
+                                       ParamValue,
+                                       ParamSet,
+                                       GpsRawInt,
+                                       GpsStatus,
+                                       ScaledImu,
+                                       RawImu,
+                                       RawPressure,
+                                       ScaledPressure,
+                                       Attitude,
+                                       AttitudeQuaternion,
+                                       LocalPositionNed,
+                                       GlobalPositionInt,
+                                       RcChannelsScaled,
+                                       RcChannelsRaw,
+                                       VfrHud,
+                                       CommandInt,
+                                       CommandLong,
+                                       CommandAck,
+                                       AutopilotVersion>;
+
+}  // namespace mavlink::payloads
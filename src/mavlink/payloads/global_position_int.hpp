@@ -37,5 +37,6 @@ struct GlobalPositionInt_T {
 
 using GlobalPositionInt = GlobalPositionInt_T<TxTraits>;
 using LazyGlobalPositionInt = GlobalPositionInt_T<RxTraits>;
+using ViewGlobalPositionInt = GlobalPositionInt_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstddef>
 #include <cstdint>
 #include <string_view>
 
@@ -19,17 +20,13 @@ struct GpsRawInt_T {
     static constexpr std::uint32_t MessageId = 24;
     static constexpr std::string_view MessageName = "GPS_RAW_INT";
 
+    static constexpr std::size_t BaseFieldCount = 10;  ///< alt_ellipsoid to yaw are Mavlink 2 extension fields
+
     typename Traits::template Field<std::uint64_t>
         time_usec;                                      ///< Timestamp (UNIX Epoch time or time since system boot).
     typename Traits::template Field<std::int32_t> lat;  ///< Latitude (WGS84), in 1E7 degrees.
     typename Traits::template Field<std::int32_t> lon;  ///< Longitude (WGS84), in 1E7 degrees.
     typename Traits::template Field<std::int32_t> alt;  ///< Altitude (MSL). Positive for up.
-    typename Traits::template Field<std::int32_t>
-        alt_ellipsoid;  ///< Altitude (above WGS84, EGM96 ellipsoid). Positive for up.
-    typename Traits::template Field<std::uint32_t> h_acc;    ///< Position uncertainty.
-    typename Traits::template Field<std::uint32_t> v_acc;    ///< Altitude uncertainty.
-    typename Traits::template Field<std::uint32_t> vel_acc;  ///< Speed uncertainty.
-    typename Traits::template Field<std::uint32_t> hdg_acc;  ///< Heading / track uncertainty.
     typename Traits::template Field<std::uint16_t>
         eph;  ///< GPS HDOP horizontal dilution of position (unitless). If unknown, set to: UINT16_MAX.
     typename Traits::template Field<std::uint16_t>
@@ -39,12 +36,18 @@ struct GpsRawInt_T {
     typename Traits::template Field<std::uint16_t>
         cog;  ///< Course over ground (NOT heading, but direction of movement) in degrees * 100, 0.0..359.99 degrees. If
               ///< unknown, set to: UINT16_MAX.
-    typename Traits::template Field<std::uint16_t>
-        yaw;  ///< Yaw in earth frame from north. Use 0 if this GPS does not provide yaw. Use 65535 if this GPS is
-              ///< configured to provide yaw and is currently unable to provide it. Use 36000 for north.
     typename Traits::template Field<std::uint8_t> fix_type;  ///< GPS fix type (see GPS_FIX_TYPE enum).
     typename Traits::template Field<std::uint8_t>
         satellites_visible;  ///< Number of satellites visible. If unknown, set to 255.
+    typename Traits::template Field<std::int32_t>
+        alt_ellipsoid;  ///< Altitude (above WGS84, EGM96 ellipsoid). Positive for up.
+    typename Traits::template Field<std::uint32_t> h_acc;    ///< Position uncertainty.
+    typename Traits::template Field<std::uint32_t> v_acc;    ///< Altitude uncertainty.
+    typename Traits::template Field<std::uint32_t> vel_acc;  ///< Speed uncertainty.
+    typename Traits::template Field<std::uint32_t> hdg_acc;  ///< Heading / track uncertainty.
+    typename Traits::template Field<std::uint16_t>
+        yaw;  ///< Yaw in earth frame from north. Use 0 if this GPS does not provide yaw. Use 65535 if this GPS is
+              ///< configured to provide yaw and is currently unable to provide it. Use 36000 for north.
 
     // Calculated CRC Extra
     static constexpr std::uint8_t CrcExtra() { return calculate_crc_extra<GpsRawInt_T<Traits>>(); }
@@ -52,5 +55,6 @@ struct GpsRawInt_T {
 
 using GpsRawInt = GpsRawInt_T<TxTraits>;
 using LazyGpsRawInt = GpsRawInt_T<RxTraits>;
+using ViewGpsRawInt = GpsRawInt_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
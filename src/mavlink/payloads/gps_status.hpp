@@ -34,5 +34,6 @@ struct GpsStatus_T {
 
 using GpsStatus = GpsStatus_T<TxTraits>;
 using LazyGpsStatus = GpsStatus_T<RxTraits>;
+using ViewGpsStatus = GpsStatus_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
@@ -42,5 +42,6 @@ struct Heartbeat_T {
 
 using Heartbeat = Heartbeat_T<TxTraits>;
 using LazyHeartbeat = Heartbeat_T<RxTraits>;
+using ViewHeartbeat = Heartbeat_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
@@ -29,5 +29,6 @@ struct LocalPositionNed_T {
 
 using LocalPositionNed = LocalPositionNed_T<TxTraits>;
 using LazyLocalPositionNed = LocalPositionNed_T<RxTraits>;
+using ViewLocalPositionNed = LocalPositionNed_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
@@ -24,5 +24,6 @@ struct ParamRequestList_T {
 
 using ParamRequestList = ParamRequestList_T<TxTraits>;
 using LazyParamRequestList = ParamRequestList_T<RxTraits>;
+using ViewParamRequestList = ParamRequestList_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
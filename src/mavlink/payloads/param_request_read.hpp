@@ -33,5 +33,6 @@ struct ParamRequestRead_T {
 
 using ParamRequestRead = ParamRequestRead_T<TxTraits>;
 using LazyParamRequestRead = ParamRequestRead_T<RxTraits>;
+using ViewParamRequestRead = ParamRequestRead_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
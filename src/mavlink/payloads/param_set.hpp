@@ -37,5 +37,6 @@ struct ParamSet_T {
 
 using ParamSet = ParamSet_T<TxTraits>;
 using LazyParamSet = ParamSet_T<RxTraits>;
+using ViewParamSet = ParamSet_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
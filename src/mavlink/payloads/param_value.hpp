@@ -35,5 +35,6 @@ struct ParamValue_T {
 
 using ParamValue = ParamValue_T<TxTraits>;
 using LazyParamValue = ParamValue_T<RxTraits>;
+using ViewParamValue = ParamValue_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
@@ -34,5 +34,6 @@ struct RawImu_T {
 
 using RawImu = RawImu_T<TxTraits>;
 using LazyRawImu = RawImu_T<RxTraits>;
+using ViewRawImu = RawImu_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
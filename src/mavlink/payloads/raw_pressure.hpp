@@ -29,5 +29,6 @@ struct RawPressure_T {
 
 using RawPressure = RawPressure_T<TxTraits>;
 using LazyRawPressure = RawPressure_T<RxTraits>;
+using ViewRawPressure = RawPressure_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
@@ -36,5 +36,6 @@ struct RcChannelsRaw_T {
 
 using RcChannelsRaw = RcChannelsRaw_T<TxTraits>;
 using LazyRcChannelsRaw = RcChannelsRaw_T<RxTraits>;
+using ViewRcChannelsRaw = RcChannelsRaw_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
@@ -35,5 +35,6 @@ struct RcChannelsScaled_T {
 
 using RcChannelsScaled = RcChannelsScaled_T<TxTraits>;
 using LazyRcChannelsScaled = RcChannelsScaled_T<RxTraits>;
+using ViewRcChannelsScaled = RcChannelsScaled_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
@@ -32,5 +32,6 @@ struct ScaledImu_T {
 
 using ScaledImu = ScaledImu_T<TxTraits>;
 using LazyScaledImu = ScaledImu_T<RxTraits>;
+using ViewScaledImu = ScaledImu_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
@@ -26,5 +26,6 @@ struct ScaledPressure_T {
 
 using ScaledPressure = ScaledPressure_T<TxTraits>;
 using LazyScaledPressure = ScaledPressure_T<RxTraits>;
+using ViewScaledPressure = ScaledPressure_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
@@ -57,5 +57,6 @@ struct SysStatus_T {
 
 using SysStatus = SysStatus_T<TxTraits>;
 using LazySysStatus = SysStatus_T<RxTraits>;
+using ViewSysStatus = SysStatus_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
@@ -23,5 +23,6 @@ struct SystemTime_T {
 
 using SystemTime = SystemTime_T<TxTraits>;
 using LazySystemTime = SystemTime_T<RxTraits>;
+using ViewSystemTime = SystemTime_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
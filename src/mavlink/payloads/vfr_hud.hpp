@@ -29,5 +29,6 @@ struct VfrHud_T {
 
 using VfrHud = VfrHud_T<TxTraits>;
 using LazyVfrHud = VfrHud_T<RxTraits>;
+using ViewVfrHud = VfrHud_T<ViewTraits>;
 
 }  // namespace mavlink::payloads
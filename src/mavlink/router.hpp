@@ -0,0 +1,136 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <ranges>
+#include <span>
+
+#include "mavlink/message_registry.hpp"
+#include "mavlink/types.hpp"
+
+namespace mavlink {
+
+/// @brief A system/component heard on a link.
+struct Route {
+    std::uint8_t sysid;
+    std::uint8_t compid;
+    std::size_t link;
+};
+
+/// @brief Forwards raw Mavlink frames between links without deserializing them.
+/// @note Routes are learned from the sender of every frame. Frames without a target, or whose target_system is 0, are
+///       broadcast to every other link. Frames for a known system go only to the links it was heard on (narrowed to
+///       the target component's links when that component has been heard too); frames for an unknown system are not
+///       forwarded. A frame is never sent back to the link it came from.
+/// @tparam MaxLinks Maximum number of links.
+/// @tparam MaxRoutes Capacity of the route table; once it is full, further systems and components are not learned.
+template <std::size_t MaxLinks = 32, std::size_t MaxRoutes = 64>
+class Router {
+   public:
+    using LinkSet = std::bitset<MaxLinks>;
+
+    /// @brief Constructor.
+    /// @param[in] link_count Number of links, identified as 0 to link_count - 1 (at most MaxLinks).
+    /// @param[in] messages Message table locating the target fields, sorted by msgid (e.g.
+    ///                     MessageRegistry<...>::Entries); messages not in it are broadcast.
+    explicit Router(std::size_t link_count, std::span<const MessageInfo> messages = {}) noexcept
+        : link_count_(std::min(link_count, MaxLinks)), messages_(messages) {
+        for (auto link : std::views::iota(std::size_t{0}, link_count_)) {
+            all_links_.set(link);
+        }
+    }
+
+    /// @brief Learns the route to the sender of a frame and selects the links to forward it to.
+    /// @param[in] view The received frame.
+    /// @param[in] link The link the frame was received on.
+    /// @return The links to forward the frame to (empty if the link is out of range).
+    [[nodiscard]] LinkSet route(const MessageView& view, std::size_t link) noexcept {
+        if (link >= link_count_) {
+            return {};
+        }
+        learn(view.sysid, view.compid, link);
+
+        auto links = all_links_;
+        if (auto info = find_message_info(messages_, view.msgid)) {
+            if (auto target_system = target_field(view, info->target_system_offset); target_system != 0) {
+                links = links_to(target_system, target_field(view, info->target_component_offset));
+            }
+        }
+        links.reset(link);
+        return links;
+    }
+
+    /// @brief Routes a frame and hands its raw bytes to the sink once per output link.
+    /// @tparam Sink Callable accepting the output link and the frame bytes.
+    /// @param[in] view The received frame.
+    /// @param[in] link The link the frame was received on.
+    /// @param[in] sink The sink to invoke for each output link.
+    /// @return The number of links the frame was forwarded to.
+    template <typename Sink>
+    std::size_t forward(const MessageView& view, std::size_t link, Sink&& sink) {
+        auto links = route(view, link);
+        for (auto out : std::views::iota(std::size_t{0}, link_count_)) {
+            if (links.test(out)) {
+                std::invoke(sink, out, view.frame);
+            }
+        }
+        return links.count();
+    }
+
+    /// @brief Links on which a system, or one of its components, has been heard.
+    /// @param[in] sysid The system ID.
+    /// @param[in] compid The component ID, or 0 for any component.
+    /// @return The component's links if it has been heard, the system's links otherwise.
+    [[nodiscard]] LinkSet links_to(std::uint8_t sysid, std::uint8_t compid = 0) const noexcept {
+        auto system_links = LinkSet{};
+        auto component_links = LinkSet{};
+        for (const auto& route : routes()) {
+            if (route.sysid == sysid) {
+                system_links.set(route.link);
+                if (route.compid == compid) {
+                    component_links.set(route.link);
+                }
+            }
+        }
+        return component_links.any() ? component_links : system_links;
+    }
+
+    /// @brief The learned routes.
+    [[nodiscard]] std::span<const Route> routes() const noexcept { return std::span(routes_).first(route_count_); }
+
+   private:
+    /// @brief Records that a system/component was heard on a link.
+    void learn(std::uint8_t sysid, std::uint8_t compid, std::size_t link) noexcept {
+        if (sysid == 0) {
+            return;  // 0 is the broadcast address, never a sender
+        }
+        auto known = std::ranges::any_of(routes(), [&](const Route& route) {
+            return route.sysid == sysid && route.compid == compid && route.link == link;
+        });
+        if (!known && route_count_ < routes_.size()) {
+            routes_[route_count_++] = Route{sysid, compid, link};
+        }
+    }
+
+    /// @brief Reads a target field of a frame.
+    /// @return The field value, or 0 (broadcast) if the message has no such field or it was truncated away.
+    [[nodiscard]] static std::uint8_t target_field(const MessageView& view,
+                                                   std::optional<std::uint8_t> offset) noexcept {
+        if (!offset || *offset >= view.payload.size()) {
+            return 0;
+        }
+        return view.payload[*offset];
+    }
+
+    std::size_t link_count_;
+    std::span<const MessageInfo> messages_;
+    LinkSet all_links_{};
+    std::array<Route, MaxRoutes> routes_{};
+    std::size_t route_count_ = 0;
+};
+
+}  // namespace mavlink
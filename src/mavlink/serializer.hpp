@@ -2,9 +2,12 @@
 #include <algorithm>
 #include <boost/pfr.hpp>
 #include <cstdint>
+#include <cstring>
 #include <expected>
 #include <span>
 #include "mavlink/checksum.hpp"
+#include "mavlink/message_registry.hpp"
+#include "mavlink/signing.hpp"
 #include "mavlink/types.hpp"
 
 namespace mavlink {
@@ -20,16 +23,48 @@ constexpr const T& get_value(const TxField<T>& val) {
     return val.value;
 }
 
-// Serializes a message into a provided buffer.
-// Returns the number of bytes written or an error.
+// Copies the fields of a message into a payload buffer one at a time, using PFR.
+// Returns the untruncated payload length.
 template <typename MessageT>
-[[nodiscard]] std::expected<std::size_t, MavlinkError> serialize(const MessageT& message,
-                                                                 std::uint8_t sysid,
-                                                                 std::uint8_t compid,
-                                                                 std::uint8_t seq,
-                                                                 std::span<std::uint8_t> buffer) {
-    // Max Mavlink packet size is 280 bytes.
-    if (buffer.size() < 280) {
+std::size_t serialize_payload_fields(const MessageT& message, std::span<std::uint8_t> payload) {
+    auto current_pos = payload.data();
+
+    boost::pfr::for_each_field(message, [&](const auto& field) {
+        const auto& val = get_value(field);
+        using ValType = std::decay_t<decltype(val)>;
+
+        auto val_bytes = reinterpret_cast<const std::uint8_t*>(&val);
+        std::copy(val_bytes, val_bytes + sizeof(ValType), current_pos);
+        current_pos += sizeof(ValType);
+    });
+
+    return static_cast<std::size_t>(current_pos - payload.data());
+}
+
+// Copies the fields of a message into a payload buffer, with a single memcpy if its layout is the wire layout.
+// Returns the untruncated payload length.
+template <typename MessageT>
+std::size_t serialize_payload(const MessageT& message, std::span<std::uint8_t> payload) {
+    if constexpr (WireCompatible<MessageT>) {
+        constexpr auto length = calculate_payload_length<MessageT>(boost::pfr::tuple_size_v<MessageT>);
+        std::memcpy(payload.data(), &message, length);
+        return length;
+    } else {
+        return serialize_payload_fields(message, payload);
+    }
+}
+
+// Serializes a message into a provided buffer, with the given incompatibility flags in its header.
+// The buffer must hold MaxFrameLength<MessageT> bytes, since the payload is written before it is zero-truncated.
+// Returns the number of bytes written (excluding any signature block) or an error.
+template <typename MessageT>
+[[nodiscard]] std::expected<std::size_t, MavlinkError> serialize_frame(const MessageT& message,
+                                                                       std::uint8_t sysid,
+                                                                       std::uint8_t compid,
+                                                                       std::uint8_t seq,
+                                                                       std::uint8_t incompat_flags,
+                                                                       std::span<std::uint8_t> buffer) {
+    if (buffer.size() < MaxFrameLength<MessageT>) {
         return std::unexpected(MavlinkError::BufferOverrun);
     }
 
@@ -46,9 +81,9 @@ template <typename MessageT>
     // MSGID: 7, 8, 9
     // Payload: 10
 
-    ptr[0] = 0xFD;  // STX
-    ptr[2] = 0;     // INC
-    ptr[3] = 0;     // CMP
+    ptr[0] = 0xFD;            // STX
+    ptr[2] = incompat_flags;  // INC
+    ptr[3] = 0;               // CMP
     ptr[4] = seq;
     ptr[5] = sysid;
     ptr[6] = compid;
@@ -58,20 +93,8 @@ template <typename MessageT>
     ptr[8] = (msgid >> 8) & 0xFF;
     ptr[9] = (msgid >> 16) & 0xFF;
 
-    // Payload serialization using PFR
     auto payload_start = ptr + 10;
-    auto current_pos = payload_start;
-
-    boost::pfr::for_each_field(message, [&](const auto& field) {
-        const auto& val = get_value(field);
-        using ValType = std::decay_t<decltype(val)>;
-
-        auto val_bytes = reinterpret_cast<const std::uint8_t*>(&val);
-        std::copy(val_bytes, val_bytes + sizeof(ValType), current_pos);
-        current_pos += sizeof(ValType);
-    });
-
-    auto full_payload_len = static_cast<std::size_t>(current_pos - payload_start);
+    auto full_payload_len = serialize_payload(message, buffer.subspan(10));
 
     // Zero truncation
     auto payload_len = full_payload_len;
@@ -97,4 +120,64 @@ template <typename MessageT>
     return 10 + payload_len + 2;  // Header + Payload + CRC
 }
 
+// Serializes a message into a provided buffer.
+// Returns the number of bytes written or an error.
+template <typename MessageT>
+[[nodiscard]] std::expected<std::size_t, MavlinkError> serialize(const MessageT& message,
+                                                                 std::uint8_t sysid,
+                                                                 std::uint8_t compid,
+                                                                 std::uint8_t seq,
+                                                                 std::span<std::uint8_t> buffer) {
+    return serialize_frame(message, sysid, compid, seq, 0, buffer);
+}
+
+// Serializes a message into a provided buffer as a signed frame.
+// The signer supplies the link ID and timestamp and advances its timestamp.
+// Returns the number of bytes written or an error.
+template <typename MessageT>
+[[nodiscard]] std::expected<std::size_t, MavlinkError> serialize(const MessageT& message,
+                                                                 std::uint8_t sysid,
+                                                                 std::uint8_t compid,
+                                                                 std::uint8_t seq,
+                                                                 std::span<std::uint8_t> buffer,
+                                                                 Signer& signer) {
+    if (buffer.size() < MaxSignedFrameLength<MessageT>) {
+        return std::unexpected(MavlinkError::BufferOverrun);
+    }
+    auto length = serialize_frame(message, sysid, compid, seq, IncompatFlagSigned, buffer);
+    if (!length) {
+        return length;
+    }
+    auto frame = buffer.first(*length + SignatureLength);
+    signer.sign(frame);
+    return frame.size();
+}
+
+// Serializes a message into a buffer sized for it at compile time (e.g. a slot of a batch buffer), so it cannot fail.
+// Returns the number of bytes written; the rest of the buffer is scratch space.
+template <typename MessageT, std::size_t N>
+    requires(N != std::dynamic_extent)
+[[nodiscard]] std::size_t serialize(const MessageT& message,
+                                    std::uint8_t sysid,
+                                    std::uint8_t compid,
+                                    std::uint8_t seq,
+                                    std::span<std::uint8_t, N> buffer) {
+    static_assert(N >= MaxFrameLength<MessageT>, "Buffer is smaller than MaxFrameLength of the message");
+    return *serialize_frame(message, sysid, compid, seq, 0, buffer);
+}
+
+// Serializes a message as a signed frame into a buffer sized for it at compile time, so it cannot fail.
+// Returns the number of bytes written; the rest of the buffer is scratch space.
+template <typename MessageT, std::size_t N>
+    requires(N != std::dynamic_extent)
+[[nodiscard]] std::size_t serialize(const MessageT& message,
+                                    std::uint8_t sysid,
+                                    std::uint8_t compid,
+                                    std::uint8_t seq,
+                                    std::span<std::uint8_t, N> buffer,
+                                    Signer& signer) {
+    static_assert(N >= MaxSignedFrameLength<MessageT>, "Buffer is smaller than MaxSignedFrameLength of the message");
+    return *serialize(message, sysid, compid, seq, std::span<std::uint8_t>(buffer), signer);
+}
+
 }  // namespace mavlink
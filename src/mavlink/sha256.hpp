@@ -0,0 +1,238 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define AVIONICPP_SHA_NI 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace mavlink {
+
+/// @brief Size of a SHA-256 digest in bytes.
+inline constexpr std::size_t Sha256DigestLength = 32;
+/// @brief Size of a SHA-256 message block in bytes.
+inline constexpr std::size_t Sha256BlockLength = 64;
+
+using Sha256Digest = std::array<std::uint8_t, Sha256DigestLength>;
+using Sha256State = std::array<std::uint32_t, 8>;
+using Sha256Block = std::span<const std::uint8_t, Sha256BlockLength>;
+
+/// @brief SHA-256 round constants.
+inline constexpr auto Sha256RoundConstants = std::array<std::uint32_t, 64>{
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2,
+};
+
+/// @brief SHA-256 initial hash value.
+inline constexpr auto Sha256InitialState = Sha256State{
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19,
+};
+
+/// @brief Compresses one message block into the hash state using plain integer arithmetic.
+/// @param[inout] state The hash state.
+/// @param[in] block The message block.
+constexpr void sha256_compress_portable(Sha256State& state, Sha256Block block) noexcept {
+    auto w = std::array<std::uint32_t, 64>{};
+    for (auto i : std::views::iota(std::size_t{0}, std::size_t{16})) {
+        w[i] = (std::uint32_t{block[4 * i]} << 24) | (std::uint32_t{block[4 * i + 1]} << 16) |
+               (std::uint32_t{block[4 * i + 2]} << 8) | std::uint32_t{block[4 * i + 3]};
+    }
+    for (auto i : std::views::iota(std::size_t{16}, w.size())) {
+        auto s0 = std::rotr(w[i - 15], 7) ^ std::rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        auto s1 = std::rotr(w[i - 2], 17) ^ std::rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    auto [a, b, c, d, e, f, g, h] = state;
+    for (auto i : std::views::iota(std::size_t{0}, w.size())) {
+        auto s1 = std::rotr(e, 6) ^ std::rotr(e, 11) ^ std::rotr(e, 25);
+        auto choice = (e & f) ^ (~e & g);
+        auto t1 = h + s1 + choice + Sha256RoundConstants[i] + w[i];
+        auto s0 = std::rotr(a, 2) ^ std::rotr(a, 13) ^ std::rotr(a, 22);
+        auto majority = (a & b) ^ (a & c) ^ (b & c);
+        auto t2 = s0 + majority;
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+#if defined(AVIONICPP_SHA_NI)
+
+/// @brief Reports whether the CPU supports the SHA extensions used by sha256_compress_sha_ni.
+[[nodiscard]] inline bool sha256_sha_ni_supported() noexcept {
+    static const auto supported = [] {
+        auto leaf1 = std::array<unsigned, 4>{};
+        auto leaf7 = std::array<unsigned, 4>{};
+#if defined(_MSC_VER)
+        auto info = std::array<int, 4>{};
+        __cpuid(info.data(), 1);
+        leaf1[2] = static_cast<unsigned>(info[2]);
+        __cpuidex(info.data(), 7, 0);
+        leaf7[1] = static_cast<unsigned>(info[1]);
+#else
+        __get_cpuid(1, &leaf1[0], &leaf1[1], &leaf1[2], &leaf1[3]);
+        __get_cpuid_count(7, 0, &leaf7[0], &leaf7[1], &leaf7[2], &leaf7[3]);
+#endif
+        auto ssse3 = (leaf1[2] & (1U << 9)) != 0;
+        auto sse41 = (leaf1[2] & (1U << 19)) != 0;
+        auto sha = (leaf7[1] & (1U << 29)) != 0;
+        return ssse3 && sse41 && sha;
+    }();
+    return supported;
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+#define AVIONICPP_TARGET_SHA_NI __attribute__((target("sha,ssse3,sse4.1")))
+#else
+#define AVIONICPP_TARGET_SHA_NI
+#endif
+
+/// @brief Compresses one message block into the hash state using the x86 SHA extensions.
+/// @note The state is held as the ABEF/CDGH register pair SHA256RNDS2 expects; each step of the loop runs four rounds
+///       and schedules the next four message words. The caller must check sha256_sha_ni_supported() first.
+/// @param[inout] state The hash state.
+/// @param[in] block The message block.
+AVIONICPP_TARGET_SHA_NI inline void sha256_compress_sha_ni(Sha256State& state, Sha256Block block) noexcept {
+    const auto byte_swap = _mm_set_epi64x(0x0C0D0E0F08090A0BLL, 0x0405060700010203LL);
+
+    auto cdab = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state.data())), 0xB1);
+    auto efgh = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state.data() + 4)), 0x1B);
+    auto abef = _mm_alignr_epi8(cdab, efgh, 8);
+    auto cdgh = _mm_blend_epi16(efgh, cdab, 0xF0);
+    const auto abef_saved = abef;
+    const auto cdgh_saved = cdgh;
+
+    auto w0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block.data())), byte_swap);
+    auto w1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block.data() + 16)), byte_swap);
+    auto w2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block.data() + 32)), byte_swap);
+    auto w3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block.data() + 48)), byte_swap);
+    for (auto i : std::views::iota(std::size_t{0}, std::size_t{16})) {
+        auto message =
+            _mm_add_epi32(w0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(Sha256RoundConstants.data() + 4 * i)));
+        cdgh = _mm_sha256rnds2_epu32(cdgh, abef, message);
+        abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(message, 0x0E));
+
+        auto next = _mm_add_epi32(_mm_sha256msg1_epu32(w0, w1), _mm_alignr_epi8(w3, w2, 4));
+        w0 = w1;
+        w1 = w2;
+        w2 = w3;
+        w3 = _mm_sha256msg2_epu32(next, w3);
+    }
+
+    abef = _mm_add_epi32(abef, abef_saved);
+    cdgh = _mm_add_epi32(cdgh, cdgh_saved);
+    auto feba = _mm_shuffle_epi32(abef, 0x1B);
+    auto dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(state.data()), _mm_blend_epi16(feba, dchg, 0xF0));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(state.data() + 4), _mm_alignr_epi8(dchg, feba, 8));
+}
+
+#undef AVIONICPP_TARGET_SHA_NI
+
+#endif  // AVIONICPP_SHA_NI
+
+/// @brief Compresses one message block with the fastest kernel the CPU supports.
+/// @param[inout] state The hash state.
+/// @param[in] block The message block.
+constexpr void sha256_compress(Sha256State& state, Sha256Block block) noexcept {
+#if defined(AVIONICPP_SHA_NI)
+    if !consteval {
+        if (sha256_sha_ni_supported()) {
+            sha256_compress_sha_ni(state, block);
+            return;
+        }
+    }
+#endif
+    sha256_compress_portable(state, block);
+}
+
+/// @brief Incremental SHA-256 hash.
+/// @tparam Compress The block compression function.
+template <auto Compress = sha256_compress>
+class Sha256 {
+   public:
+    /// @brief Appends bytes to the hashed message.
+    /// @param[in] data The bytes to append.
+    constexpr void update(std::span<const std::uint8_t> data) noexcept {
+        length_ += data.size();
+        if (buffered_ > 0) {
+            auto count = std::min(data.size(), Sha256BlockLength - buffered_);
+            std::ranges::copy(data.first(count), buffer_.begin() + static_cast<std::ptrdiff_t>(buffered_));
+            buffered_ += count;
+            data = data.subspan(count);
+            if (buffered_ < Sha256BlockLength) {
+                return;
+            }
+            Compress(state_, buffer_);
+            buffered_ = 0;
+        }
+        while (data.size() >= Sha256BlockLength) {
+            Compress(state_, data.template first<Sha256BlockLength>());
+            data = data.subspan(Sha256BlockLength);
+        }
+        std::ranges::copy(data, buffer_.begin());
+        buffered_ = data.size();
+    }
+
+    /// @brief Pads the message and returns its digest.
+    /// @return The SHA-256 digest.
+    [[nodiscard]] constexpr Sha256Digest finalize() noexcept {
+        auto bit_length = static_cast<std::uint64_t>(length_) * 8;
+        buffer_[buffered_++] = 0x80;
+        if (buffered_ > Sha256BlockLength - sizeof(bit_length)) {
+            std::ranges::fill(std::span(buffer_).subspan(buffered_), 0);
+            Compress(state_, buffer_);
+            buffered_ = 0;
+        }
+        std::ranges::fill(std::span(buffer_).subspan(buffered_), 0);
+        for (auto i : std::views::iota(std::size_t{0}, sizeof(bit_length))) {
+            buffer_[Sha256BlockLength - 1 - i] = static_cast<std::uint8_t>(bit_length >> (8 * i));
+        }
+        Compress(state_, buffer_);
+
+        auto digest = Sha256Digest{};
+        for (auto i : std::views::iota(std::size_t{0}, digest.size())) {
+            digest[i] = static_cast<std::uint8_t>(state_[i / 4] >> (24 - 8 * (i % 4)));
+        }
+        return digest;
+    }
+
+   private:
+    Sha256State state_ = Sha256InitialState;
+    std::array<std::uint8_t, Sha256BlockLength> buffer_{};
+    std::size_t buffered_ = 0;
+    std::size_t length_ = 0;
+};
+
+}  // namespace mavlink
@@ -0,0 +1,173 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <ranges>
+#include <span>
+#include <string_view>
+
+#include "mavlink/sha256.hpp"
+#include "mavlink/types.hpp"
+
+namespace mavlink {
+
+/// @brief Length of the secret key shared by the signing parties.
+inline constexpr std::size_t SecretKeyLength = 32;
+/// @brief Length of the truncated SHA-256 value at the end of the signature block.
+inline constexpr std::size_t SignatureValueLength = 6;
+/// @brief Length of the 48-bit timestamp in the signature block.
+inline constexpr std::size_t SignatureTimestampLength = 6;
+/// @brief How far a new stream's timestamp may lag behind the local timestamp (one minute, in 10 us units).
+inline constexpr std::uint64_t SigningReplayWindow = 6'000'000;
+
+using SecretKey = std::array<std::uint8_t, SecretKeyLength>;
+using SignatureValue = std::array<std::uint8_t, SignatureValueLength>;
+
+/// @brief Computes the signature of a signed Mavlink v2 frame.
+/// @note The signature is the first 48 bits of SHA-256(secret key + frame), where the frame runs from the start marker
+///       through the link ID and timestamp of its signature block.
+/// @param[in] key The secret key.
+/// @param[in] frame The complete signed frame; its signature value is not read.
+/// @return The signature value.
+[[nodiscard]] constexpr SignatureValue compute_signature(const SecretKey& key,
+                                                         std::span<const std::uint8_t> frame) noexcept {
+    auto hash = Sha256<>{};
+    hash.update(key);
+    hash.update(frame.first(frame.size() - SignatureValueLength));
+    auto digest = hash.finalize();
+    auto signature = SignatureValue{};
+    std::ranges::copy(std::span(digest).first<SignatureValueLength>(), signature.begin());
+    return signature;
+}
+
+/// @brief Reads the 48-bit little endian timestamp of a signed frame.
+/// @param[in] frame The complete signed frame.
+/// @return Time since 2015-01-01 in 10 us units.
+[[nodiscard]] constexpr std::uint64_t signature_timestamp(std::span<const std::uint8_t> frame) noexcept {
+    auto bytes = frame.last(SignatureLength).subspan(1, SignatureTimestampLength);
+    auto timestamp = std::uint64_t{0};
+    for (auto i : std::views::iota(std::size_t{0}, bytes.size())) {
+        timestamp |= std::uint64_t{bytes[i]} << (8 * i);
+    }
+    return timestamp;
+}
+
+/// @brief Signs outgoing Mavlink v2 frames for one link.
+class Signer {
+   public:
+    /// @brief Constructor.
+    /// @param[in] key The secret key.
+    /// @param[in] link_id The link ID written into every signature.
+    /// @param[in] timestamp Initial timestamp (10 us units since 2015-01-01).
+    constexpr Signer(const SecretKey& key, std::uint8_t link_id, std::uint64_t timestamp = 0) noexcept
+        : key_(key), link_id_(link_id), timestamp_(timestamp) {}
+
+    /// @brief Advances the timestamp to the current time; it never moves backward.
+    /// @param[in] timestamp Current time in 10 us units since 2015-01-01.
+    constexpr void set_timestamp(std::uint64_t timestamp) noexcept { timestamp_ = std::max(timestamp_, timestamp); }
+
+    /// @brief Timestamp that the next signed frame will carry.
+    [[nodiscard]] constexpr std::uint64_t timestamp() const noexcept { return timestamp_; }
+
+    /// @brief Fills in the signature block of a frame.
+    /// @note Every frame gets a distinct timestamp, so the timestamp advances by one tick per frame.
+    /// @param[inout] frame The complete frame, with the signed flag set and room for the signature block at the end.
+    constexpr void sign(std::span<std::uint8_t> frame) noexcept {
+        auto block = frame.last(SignatureLength);
+        block[0] = link_id_;
+        for (auto i : std::views::iota(std::size_t{0}, SignatureTimestampLength)) {
+            block[1 + i] = static_cast<std::uint8_t>(timestamp_ >> (8 * i));
+        }
+        ++timestamp_;
+        std::ranges::copy(compute_signature(key_, frame), block.last(SignatureValueLength).begin());
+    }
+
+   private:
+    SecretKey key_;
+    std::uint8_t link_id_;
+    std::uint64_t timestamp_;
+};
+
+/// @brief Last timestamp accepted from one (link, system, component) signing stream.
+struct SigningStream {
+    std::uint8_t link_id;
+    std::uint8_t sysid;
+    std::uint8_t compid;
+    std::uint64_t timestamp;
+};
+
+/// @brief Verifies incoming signed Mavlink v2 frames and rejects replayed ones.
+class SignatureVerifier {
+   public:
+    /// @brief Constructor.
+    /// @param[in] key The secret key.
+    /// @param[in] streams Storage for the replay table (at least one entry); when it is full, the stream heard from
+    ///                    least recently is evicted.
+    /// @param[in] timestamp Initial local timestamp (10 us units since 2015-01-01).
+    constexpr SignatureVerifier(const SecretKey& key,
+                                std::span<SigningStream> streams,
+                                std::uint64_t timestamp = 0) noexcept
+        : key_(key), streams_(streams), timestamp_(timestamp) {}
+
+    /// @brief Advances the local timestamp to the current time; it never moves backward.
+    /// @param[in] timestamp Current time in 10 us units since 2015-01-01.
+    constexpr void set_timestamp(std::uint64_t timestamp) noexcept { timestamp_ = std::max(timestamp_, timestamp); }
+
+    /// @brief Latest timestamp seen, or set locally.
+    [[nodiscard]] constexpr std::uint64_t timestamp() const noexcept { return timestamp_; }
+
+    /// @brief Verifies a signed frame and records its timestamp.
+    /// @note The timestamp of a known stream must increase with every frame. A new stream is accepted if its timestamp
+    ///       lags the local timestamp by no more than SigningReplayWindow. The replay table is only updated for
+    ///       frames whose signature matches.
+    /// @param[in] frame The complete signed frame.
+    /// @return Nothing on success, or a description of why the frame was rejected.
+    [[nodiscard]] constexpr std::expected<void, std::string_view> verify(std::span<const std::uint8_t> frame) noexcept {
+        auto link_id = frame[frame.size() - SignatureLength];
+        auto sysid = frame[5];
+        auto compid = frame[6];
+        auto timestamp = signature_timestamp(frame);
+
+        auto known = std::ranges::find_if(streams_.first(used_), [&](const SigningStream& stream) {
+            return stream.link_id == link_id && stream.sysid == sysid && stream.compid == compid;
+        });
+        auto is_known = known != streams_.begin() + static_cast<std::ptrdiff_t>(used_);
+        if (is_known && timestamp <= known->timestamp) {
+            return std::unexpected("Replayed timestamp");
+        }
+        if (!is_known && timestamp + SigningReplayWindow < timestamp_) {
+            return std::unexpected("Stale timestamp");
+        }
+
+        auto expected = compute_signature(key_, frame);
+        if (!std::ranges::equal(expected, frame.last(SignatureValueLength))) {
+            return std::unexpected("Signature mismatch");
+        }
+
+        if (!is_known) {
+            known = add_stream();
+            *known = SigningStream{link_id, sysid, compid, timestamp};
+        }
+        known->timestamp = timestamp;
+        timestamp_ = std::max(timestamp_, timestamp);
+        return {};
+    }
+
+   private:
+    /// @brief Claims a replay table entry, evicting the stream with the oldest timestamp if the table is full.
+    constexpr std::span<SigningStream>::iterator add_stream() noexcept {
+        if (used_ < streams_.size()) {
+            return streams_.begin() + static_cast<std::ptrdiff_t>(used_++);
+        }
+        return std::ranges::min_element(streams_, {}, &SigningStream::timestamp);
+    }
+
+    SecretKey key_;
+    std::span<SigningStream> streams_;
+    std::size_t used_ = 0;
+    std::uint64_t timestamp_;
+};
+
+}  // namespace mavlink
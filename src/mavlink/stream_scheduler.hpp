@@ -0,0 +1,269 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace mavlink {
+
+/// @brief Timing statistics of one periodic stream.
+struct StreamStats {
+    std::uint64_t fired;                              ///< Times the producer ran.
+    std::uint64_t missed;                             ///< Periods skipped because the scheduler was polled too late.
+    std::uint64_t failed;                             ///< Runs whose producer reported a failure (e.g. a write error).
+    std::chrono::steady_clock::duration jitter_p50;   ///< Median lateness against the nominal schedule.
+    std::chrono::steady_clock::duration jitter_p99;   ///< 99th percentile lateness against the nominal schedule.
+    std::chrono::steady_clock::duration jitter_max;   ///< Largest lateness in the sample window.
+};
+
+/// @brief Runs periodic telemetry producers from a single thread, on a hierarchical timer wheel.
+/// @note Time advances in ticks. The wheel has three levels of 64 slots; a stream due within 64 ticks sits in level
+///       0, one due within 64^2 ticks in level 1 and the rest in level 2, and the upper levels are cascaded down as
+///       the wheel turns, so polling costs one slot per elapsed tick however many streams there are. Streams are
+///       rescheduled on their nominal period (not from when they ran), so they do not drift, and a new stream is given
+///       the phase that coincides with the fewest existing streams, so bursts don't line up. Lateness against the
+///       nominal schedule is kept in a window of recent samples per stream.
+/// @tparam MaxStreams Maximum number of streams.
+/// @tparam JitterSamples Number of lateness samples kept per stream.
+template <std::size_t MaxStreams = 32, std::size_t JitterSamples = 128>
+    requires(MaxStreams > 0 && MaxStreams < 0xFFFF && JitterSamples > 0)
+class StreamScheduler {
+   public:
+    using Clock = std::chrono::steady_clock;
+    /// @brief A producer is called with the current time whenever its stream is due, and returns false if it failed
+    ///        (e.g. could not write its message), which is counted in the stream's stats.
+    using Producer = std::function<bool(Clock::time_point)>;
+
+    /// @brief Constructor.
+    /// @param[in] origin Time of tick 0.
+    /// @param[in] tick Wheel resolution; periods are rounded to whole ticks.
+    explicit StreamScheduler(Clock::time_point origin, Clock::duration tick = std::chrono::milliseconds{1}) noexcept
+        : origin_(origin), tick_(tick) {
+        for (auto& level : wheel_) {
+            level.fill(None);
+        }
+    }
+
+    /// @brief Adds a stream, staggered against the existing ones.
+    /// @param[in] period The stream's period (e.g. 20 ms for 50 Hz); at least one tick.
+    /// @param[in] producer Called whenever the stream is due, e.g. to serialize a message into a LinkWriter.
+    /// @return The stream's ID, or std::nullopt if MaxStreams streams already exist.
+    std::optional<std::size_t> add(Clock::duration period, Producer producer) {
+        if (count_ == MaxStreams) {
+            return std::nullopt;
+        }
+        auto id = static_cast<std::uint16_t>(count_++);
+        auto& stream = streams_[id];
+        stream.producer = std::move(producer);
+        stream.period = std::max(period, tick_);
+        stream.anchor = now_tick_ + 1 + stagger(ticks(stream.period));
+        stream.expiry = stream.anchor;
+        stream.due = origin_ + static_cast<std::int64_t>(stream.anchor) * tick_;
+        insert(id);
+        return id;
+    }
+
+    /// @brief Adds a stream whose producer does not report failures, staggered against the existing ones.
+    /// @tparam Produce Callable accepting the current time and returning nothing.
+    /// @param[in] period The stream's period; at least one tick.
+    /// @param[in] produce Called whenever the stream is due.
+    /// @return The stream's ID, or std::nullopt if MaxStreams streams already exist.
+    template <typename Produce>
+        requires std::is_void_v<std::invoke_result_t<Produce&, Clock::time_point>>
+    std::optional<std::size_t> add(Clock::duration period, Produce produce) {
+        return add(period, Producer{[produce = std::move(produce)](Clock::time_point now) mutable {
+                       std::invoke(produce, now);
+                       return true;
+                   }});
+    }
+
+    /// @brief Adds a stream that serializes a message into an output (e.g. a LinkWriter) whenever it is due.
+    /// @note Writes that fail (e.g. on a closed link) are counted in the stream's stats.
+    /// @tparam Output Type with a write(message, now) member returning a std::expected.
+    /// @tparam Make Callable returning the message to send.
+    /// @param[in] period The stream's period.
+    /// @param[in] output The output, which must outlive the scheduler.
+    /// @param[in] make Produces the message.
+    /// @return The stream's ID, or std::nullopt if MaxStreams streams already exist.
+    template <typename Output, typename Make>
+    std::optional<std::size_t> add(Clock::duration period, Output& output, Make make) {
+        return add(period, Producer{[&output, make = std::move(make)](Clock::time_point now) {
+                       return output.write(std::invoke(make), now).has_value();
+                   }});
+    }
+
+    /// @brief Runs every stream that has come due.
+    /// @param[in] now Current time.
+    /// @return The number of producers run.
+    std::size_t poll(Clock::time_point now) {
+        if (now < origin_) {
+            return 0;
+        }
+        auto target = static_cast<std::uint64_t>((now - origin_) / tick_);
+        auto fired = std::size_t{0};
+        for (; now_tick_ <= target; ++now_tick_) {
+            if ((now_tick_ & SlotMask) == 0) {
+                if (((now_tick_ >> SlotBits) & SlotMask) == 0) {
+                    cascade(2);
+                }
+                cascade(1);
+            }
+            auto& slot = wheel_[0][now_tick_ & SlotMask];
+            auto id = std::exchange(slot, None);
+            while (id != None) {
+                auto next = streams_[id].next;
+                run(id, now);
+                ++fired;
+                id = next;
+            }
+        }
+        return fired;
+    }
+
+    /// @brief Nominal time of the next run of a stream.
+    [[nodiscard]] Clock::time_point next_due(std::size_t stream) const noexcept { return streams_[stream].due; }
+
+    /// @brief Timing statistics of a stream.
+    [[nodiscard]] StreamStats stats(std::size_t stream) const {
+        const auto& source = streams_[stream];
+        auto samples = source.lateness;
+        auto window = std::span(samples).first(std::min<std::uint64_t>(source.fired, JitterSamples));
+        auto percentile = [&](double p) {
+            if (window.empty()) {
+                return Clock::duration::zero();
+            }
+            auto nth = window.begin() + static_cast<std::ptrdiff_t>(p * static_cast<double>(window.size() - 1));
+            std::ranges::nth_element(window, nth);
+            return *nth;
+        };
+        auto p50 = percentile(0.5);
+        auto p99 = percentile(0.99);
+        auto max = window.empty() ? Clock::duration::zero() : std::ranges::max(window);
+        return StreamStats{source.fired, source.missed, source.failed, p50, p99, max};
+    }
+
+    /// @brief Number of streams.
+    [[nodiscard]] std::size_t size() const noexcept { return count_; }
+
+   private:
+    static constexpr std::size_t Levels = 3;
+    static constexpr unsigned SlotBits = 6;
+    static constexpr std::uint64_t SlotMask = (1U << SlotBits) - 1;
+    static constexpr std::uint16_t None = 0xFFFF;
+    /// @brief Phases tried when staggering a new stream.
+    static constexpr std::uint64_t MaxStaggerCandidates = 1024;
+
+    struct Stream {
+        Producer producer;
+        Clock::duration period{};
+        Clock::time_point due{};
+        std::uint64_t anchor = 0;
+        std::uint64_t expiry = 0;
+        std::uint16_t next = None;
+        std::uint64_t fired = 0;
+        std::uint64_t missed = 0;
+        std::uint64_t failed = 0;
+        std::array<Clock::duration, JitterSamples> lateness{};
+    };
+
+    /// @brief Whole ticks in a duration, at least one.
+    [[nodiscard]] std::uint64_t ticks(Clock::duration duration) const noexcept {
+        return std::max<std::uint64_t>(1, static_cast<std::uint64_t>(duration / tick_));
+    }
+
+    /// @brief First tick at or after a time.
+    [[nodiscard]] std::uint64_t tick_at(Clock::time_point time) const noexcept {
+        return static_cast<std::uint64_t>((time - origin_ + tick_ - Clock::duration{1}) / tick_);
+    }
+
+    /// @brief Offset, within one period, of the phase that coincides with the fewest existing streams.
+    /// @note Two periodic streams ever run in the same tick exactly when their phases are congruent modulo the gcd of
+    ///       their periods.
+    [[nodiscard]] std::uint64_t stagger(std::uint64_t period) const noexcept {
+        auto base = now_tick_ + 1;
+        auto best = std::uint64_t{0};
+        auto best_collisions = count_;
+        for (auto offset : std::views::iota(std::uint64_t{0}, std::min(period, MaxStaggerCandidates))) {
+            auto collisions = std::size_t{0};
+            for (const auto& other : std::span(streams_).first(count_ - 1)) {
+                auto gcd = std::gcd(period, ticks(other.period));
+                collisions += ((base + offset) % gcd == other.anchor % gcd) ? 1 : 0;
+            }
+            if (collisions < best_collisions) {
+                best = offset;
+                best_collisions = collisions;
+                if (collisions == 0) {
+                    break;
+                }
+            }
+        }
+        return best;
+    }
+
+    /// @brief Files a stream into the slot of its expiry tick.
+    void insert(std::uint16_t id) noexcept {
+        auto& stream = streams_[id];
+        auto expiry = std::max(stream.expiry, now_tick_);
+        auto delta = expiry - now_tick_;
+        auto level = std::size_t{0};
+        while (level + 1 < Levels && delta >= (std::uint64_t{1} << (SlotBits * (level + 1)))) {
+            ++level;
+        }
+        if (delta >= (std::uint64_t{1} << (SlotBits * Levels))) {
+            expiry = now_tick_ + (std::uint64_t{1} << (SlotBits * Levels)) - 1;  // re-filed when cascaded
+        }
+        auto& slot = wheel_[level][(expiry >> (SlotBits * level)) & SlotMask];
+        stream.next = slot;
+        slot = id;
+    }
+
+    /// @brief Re-files the streams of the current slot of an upper level into the levels below it.
+    void cascade(std::size_t level) noexcept {
+        auto id = std::exchange(wheel_[level][(now_tick_ >> (SlotBits * level)) & SlotMask], None);
+        while (id != None) {
+            auto next = streams_[id].next;
+            insert(id);
+            id = next;
+        }
+    }
+
+    /// @brief Runs a due stream and schedules its next nominal run after now.
+    void run(std::uint16_t id, Clock::time_point now) {
+        auto& stream = streams_[id];
+        if (stream.expiry > now_tick_) {
+            insert(id);  // parked at the edge of the wheel, not due yet
+            return;
+        }
+        stream.lateness[stream.fired % JitterSamples] = now - stream.due;
+        ++stream.fired;
+        if (!std::invoke(stream.producer, now)) {
+            ++stream.failed;
+        }
+
+        stream.due += stream.period;
+        if (stream.due <= now) {
+            auto behind = static_cast<std::uint64_t>((now - stream.due) / stream.period) + 1;
+            stream.due += static_cast<std::int64_t>(behind) * stream.period;
+            stream.missed += behind;
+        }
+        stream.expiry = std::max(tick_at(stream.due), now_tick_ + 1);
+        insert(id);
+    }
+
+    Clock::time_point origin_;
+    Clock::duration tick_;
+    std::uint64_t now_tick_ = 0;
+    std::array<Stream, MaxStreams> streams_{};
+    std::size_t count_ = 0;
+    std::array<std::array<std::uint16_t, std::size_t{1} << SlotBits>, Levels> wheel_{};
+};
+
+}  // namespace mavlink
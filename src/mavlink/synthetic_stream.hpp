@@ -0,0 +1,276 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/pfr.hpp>
+
+#include "mavlink/message_registry.hpp"
+#include "mavlink/payloads/common_messages.hpp"
+#include "mavlink/serializer.hpp"
+
+namespace mavlink {
+
+/// @brief Probabilities of the faults a SyntheticStream injects, each drawn independently for every frame.
+struct SyntheticFaults {
+    double bit_flip = 0.0;         ///< One random bit of the frame is inverted.
+    double dropped_byte = 0.0;     ///< One random byte of the frame is left out.
+    double truncation = 0.0;       ///< The frame is cut off after a random number of bytes.
+    double garbage = 0.0;          ///< A burst of random bytes is sent ahead of the frame.
+    std::size_t max_garbage = 64;  ///< Longest garbage burst, in bytes.
+};
+
+/// @brief What a SyntheticStream has emitted so far.
+struct SyntheticStats {
+    std::uint64_t frames = 0;          ///< Frames emitted, damaged or not.
+    std::uint64_t intact_frames = 0;   ///< Frames emitted without a bit flip, dropped byte or truncation.
+    std::uint64_t bit_flips = 0;       ///< Frames with a bit flipped.
+    std::uint64_t dropped_bytes = 0;   ///< Frames with a byte left out.
+    std::uint64_t truncations = 0;     ///< Frames cut short.
+    std::uint64_t garbage_bursts = 0;  ///< Bursts of random bytes.
+    std::uint64_t garbage_bytes = 0;   ///< Random bytes in all bursts.
+    std::uint64_t bytes = 0;           ///< Bytes emitted in total.
+};
+
+/// @brief Rate at which an autopilot typically streams a message to a ground station.
+/// @param[in] msgid The message ID.
+/// @return The rate in Hz; 0.2 for messages that are normally only sent on request (parameters, commands, ...).
+[[nodiscard]] constexpr double typical_stream_rate(std::uint32_t msgid) noexcept {
+    switch (msgid) {
+        case 30:  // ATTITUDE
+            return 25.0;
+        case 26:  // SCALED_IMU
+        case 27:  // RAW_IMU
+        case 31:  // ATTITUDE_QUATERNION
+        case 32:  // LOCAL_POSITION_NED
+        case 33:  // GLOBAL_POSITION_INT
+            return 10.0;
+        case 24:  // GPS_RAW_INT
+        case 28:  // RAW_PRESSURE
+        case 29:  // SCALED_PRESSURE
+        case 34:  // RC_CHANNELS_SCALED
+        case 35:  // RC_CHANNELS_RAW
+        case 74:  // VFR_HUD
+            return 5.0;
+        case 1:  // SYS_STATUS
+            return 2.0;
+        case 0:   // HEARTBEAT
+        case 2:   // SYSTEM_TIME
+        case 25:  // GPS_STATUS
+            return 1.0;
+        default:
+            return 0.2;
+    }
+}
+
+/// @brief Deterministic generator of Mavlink v2 traffic with injected faults, for load and robustness tests.
+/// @details Each payload type is scheduled at its own rate on a simulated clock (starting at a random phase, so
+///          streams don't line up) and sent with random field values by every simulated system, with per-system
+///          sequence numbers. Faults are then applied to the serialized frames as configured. Random numbers are
+///          taken straight from std::mt19937_64, whose sequence is fixed by the standard, so a seed produces the same
+///          bytes with every compiler and standard library.
+/// @note Neither copyable nor movable.
+/// @tparam Payloads The Tx payload types to send (e.g. payloads::Attitude).
+template <typename... Payloads>
+    requires(sizeof...(Payloads) > 0)
+class SyntheticStream {
+   public:
+    /// @brief Constructor; every payload starts at its typical_stream_rate().
+    /// @param[in] seed Seed of the random number generator.
+    /// @param[in] faults Probabilities of the faults to inject.
+    /// @param[in] systems Number of systems sending, with sysids 1 to systems.
+    explicit SyntheticStream(std::uint64_t seed, SyntheticFaults faults = {}, std::uint8_t systems = 1)
+        : rng_(seed), faults_(faults), systems_(std::max<std::uint8_t>(systems, 1)) {
+        [&]<std::size_t... P>(std::index_sequence<P...>) {
+            (set_rate(P, typical_stream_rate(PayloadAt<P>::MessageId)), ...);
+        }(std::index_sequence_for<Payloads...>{});
+    }
+    SyntheticStream(const SyntheticStream&) = delete;
+    SyntheticStream(SyntheticStream&&) = delete;
+    auto operator=(const SyntheticStream&) = delete;
+    auto operator=(SyntheticStream&&) = delete;
+
+    /// @brief Changes the rate of a payload type.
+    /// @tparam Payload One of Payloads.
+    /// @param[in] hz The new rate; 0 stops the payload.
+    template <typename Payload>
+    void set_rate(double hz) {
+        set_rate(index_of<Payload>(), hz);
+    }
+
+    /// @brief Changes the rate of every payload type.
+    /// @param[in] hz The new rate; 0 stops all payloads.
+    void set_rates(double hz) {
+        for (auto index : std::views::iota(std::size_t{0}, sizeof...(Payloads))) {
+            set_rate(index, hz);
+        }
+    }
+
+    /// @brief Appends the next scheduled message, from every system, to a stream.
+    /// @param[in,out] stream The stream to append to.
+    /// @return false if every payload is stopped.
+    bool next(std::vector<std::uint8_t>& stream) {
+        auto due = std::ranges::min_element(due_us_);
+        if (*due == Stopped) {
+            return false;
+        }
+        auto index = static_cast<std::size_t>(due - due_us_.begin());
+        time_us_ = *due;
+        *due += period_us_[index];
+        [&]<std::size_t... P>(std::index_sequence<P...>) {
+            ((P == index ? emit<PayloadAt<P>>(stream) : void()), ...);
+        }(std::index_sequence_for<Payloads...>{});
+        return true;
+    }
+
+    /// @brief Generates the next part of the stream.
+    /// @param[in] bytes Minimum number of bytes to generate; the last message is completed.
+    /// @return The bytes.
+    [[nodiscard]] std::vector<std::uint8_t> generate(std::size_t bytes) {
+        auto stream = std::vector<std::uint8_t>{};
+        stream.reserve(bytes + FrameCapacity * systems_ + faults_.max_garbage * systems_);
+        while (stream.size() < bytes && next(stream)) {
+        }
+        return stream;
+    }
+
+    /// @brief Simulated time of the latest message, in microseconds since the start of the stream.
+    [[nodiscard]] std::uint64_t time_us() const noexcept { return time_us_; }
+
+    /// @brief What has been emitted so far.
+    [[nodiscard]] const SyntheticStats& stats() const noexcept { return stats_; }
+
+   private:
+    template <std::size_t P>
+    using PayloadAt = std::tuple_element_t<P, std::tuple<Payloads...>>;
+
+    static constexpr std::uint64_t Stopped = std::numeric_limits<std::uint64_t>::max();
+    static constexpr std::size_t FrameCapacity = std::max({MaxFrameLength<Payloads>...});
+    static constexpr std::uint8_t Compid = 1;
+
+    std::mt19937_64 rng_;
+    SyntheticFaults faults_;
+    std::uint8_t systems_;
+    std::array<std::uint64_t, sizeof...(Payloads)> period_us_{};
+    std::array<std::uint64_t, sizeof...(Payloads)> due_us_{};
+    std::array<std::uint8_t, 256> seq_{};
+    std::array<std::uint8_t, FrameCapacity> frame_{};
+    std::uint64_t time_us_ = 0;
+    SyntheticStats stats_{};
+
+    template <typename Payload>
+    static consteval std::size_t index_of() {
+        constexpr auto matches = std::array<bool, sizeof...(Payloads)>{std::is_same_v<Payload, Payloads>...};
+        static_assert(std::ranges::count(matches, true) == 1, "Payload must be one of Payloads");
+        return static_cast<std::size_t>(std::ranges::find(matches, true) - matches.begin());
+    }
+
+    void set_rate(std::size_t index, double hz) {
+        if (hz <= 0.0) {
+            due_us_[index] = Stopped;
+            return;
+        }
+        period_us_[index] = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(1e6 / hz));
+        due_us_[index] = time_us_ + below(period_us_[index]);
+    }
+
+    /// @brief Uniformly distributed integer in [0, bound), bound > 0.
+    std::uint64_t below(std::uint64_t bound) { return rng_() % bound; }
+
+    /// @brief Uniformly distributed double in [0, 1).
+    double unit() { return static_cast<double>(rng_() >> 11) * 0x1.0p-53; }
+
+    bool chance(double probability) { return probability > 0.0 && unit() < probability; }
+
+    template <typename T>
+    void randomize(T& value) {
+        if constexpr (std::is_floating_point_v<T>) {
+            value = static_cast<T>(unit() * 2000.0 - 1000.0);
+        } else if constexpr (std::is_integral_v<T>) {
+            value = static_cast<T>(rng_());
+        } else if constexpr (std::is_same_v<typename T::value_type, char>) {
+            // a NUL-terminated printable string, unless it fills the array
+            auto length = 1 + below(value.size());
+            for (auto index : std::views::iota(std::size_t{0}, value.size())) {
+                value[index] = index < length ? static_cast<char>(' ' + below(95)) : '\0';
+            }
+        } else {
+            for (auto& element : value) {
+                randomize(element);
+            }
+        }
+    }
+
+    template <typename Payload>
+    void emit(std::vector<std::uint8_t>& stream) {
+        // counted wider than std::uint8_t, which would wrap around instead of passing 255 systems
+        for (auto sysid : std::views::iota(1U, systems_ + 1U)) {
+            auto payload = Payload{};
+            boost::pfr::for_each_field(payload, [&](auto& field) { randomize(field.value); });
+            auto length =
+                serialize(payload, static_cast<std::uint8_t>(sysid), Compid, seq_[sysid]++, std::span(frame_));
+            inject(std::span(frame_).first(length), stream);
+        }
+    }
+
+    /// @brief Appends a frame to the stream, with faults drawn at random.
+    void inject(std::span<std::uint8_t> frame, std::vector<std::uint8_t>& stream) {
+        auto start = stream.size();
+        if (chance(faults_.garbage) && faults_.max_garbage > 0) {
+            auto burst = 1 + below(faults_.max_garbage);
+            for ([[maybe_unused]] auto byte : std::views::iota(std::uint64_t{0}, burst)) {
+                stream.push_back(static_cast<std::uint8_t>(rng_()));
+            }
+            ++stats_.garbage_bursts;
+            stats_.garbage_bytes += burst;
+        }
+        auto intact = true;
+        if (chance(faults_.bit_flip)) {
+            auto bit = below(frame.size() * 8);
+            frame[bit / 8] ^= static_cast<std::uint8_t>(1U << (bit % 8));
+            ++stats_.bit_flips;
+            intact = false;
+        }
+        if (chance(faults_.dropped_byte)) {
+            auto dropped = frame.begin() + static_cast<std::ptrdiff_t>(below(frame.size()));
+            std::ranges::copy(dropped + 1, frame.end(), dropped);
+            frame = frame.first(frame.size() - 1);
+            ++stats_.dropped_bytes;
+            intact = false;
+        }
+        if (chance(faults_.truncation) && frame.size() > 1) {
+            frame = frame.first(1 + below(frame.size() - 1));
+            ++stats_.truncations;
+            intact = false;
+        }
+        stream.insert(stream.end(), frame.begin(), frame.end());
+        ++stats_.frames;
+        stats_.intact_frames += intact ? 1 : 0;
+        stats_.bytes += stream.size() - start;
+    }
+};
+
+/// @brief SyntheticStream sending every message of a MessageRegistry.
+/// @tparam Registry A MessageRegistry<...>.
+template <typename Registry>
+struct RegistrySyntheticStream;
+
+/// @brief Specialization unpacking the registry's payload types.
+template <typename... Payloads>
+struct RegistrySyntheticStream<MessageRegistry<Payloads...>> {
+    using Type = SyntheticStream<Payloads...>;
+};
+
+/// @brief SyntheticStream sending every message defined in this library, at typical autopilot rates.
+using CommonSyntheticStream = RegistrySyntheticStream<payloads::CommonMessages>::Type;
+
+}  // namespace mavlink
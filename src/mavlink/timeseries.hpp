@@ -0,0 +1,410 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/pfr.hpp>
+
+#include "mavlink/checksum.hpp"
+#include "mavlink/types.hpp"
+
+namespace mavlink {
+
+/// @brief Samples (or buckets) aggregated into one bucket of the next level of a TimeSeries pyramid.
+inline constexpr std::size_t SeriesFanout = 8;
+
+/// @brief A sample of a time series.
+struct SeriesPoint {
+    std::uint64_t timestamp_us;  ///< Sample timestamp, in microseconds.
+    double value;                ///< Sample value.
+};
+
+/// @brief Aggregate of the samples of a time range.
+struct SeriesBucket {
+    std::uint64_t first_us = 0;                             ///< Timestamp of the first sample.
+    std::uint64_t last_us = 0;                              ///< Timestamp of the last sample.
+    std::uint64_t min_us = 0;                               ///< Timestamp of the (first) smallest sample.
+    std::uint64_t max_us = 0;                               ///< Timestamp of the (first) largest sample.
+    double min = std::numeric_limits<double>::infinity();   ///< Smallest sample.
+    double max = -std::numeric_limits<double>::infinity();  ///< Largest sample.
+    double sum = 0.0;                                       ///< Sum of the samples.
+    std::uint64_t count = 0;                                ///< Number of samples; 0 if the range had none.
+
+    /// @brief Mean of the samples, NaN if there are none.
+    [[nodiscard]] double mean() const noexcept {
+        return count == 0 ? std::numeric_limits<double>::quiet_NaN() : sum / static_cast<double>(count);
+    }
+
+    /// @brief Adds a later sample.
+    void add(std::uint64_t timestamp_us, double value) noexcept {
+        merge(SeriesBucket{timestamp_us, timestamp_us, timestamp_us, timestamp_us, value, value, value, 1});
+    }
+
+    /// @brief Adds the samples of a later bucket.
+    void merge(const SeriesBucket& later) noexcept {
+        if (later.count == 0) {
+            return;
+        }
+        if (count == 0) {
+            first_us = later.first_us;
+        }
+        last_us = later.last_us;
+        if (later.min < min) {
+            min = later.min;
+            min_us = later.min_us;
+        }
+        if (later.max > max) {
+            max = later.max;
+            max_us = later.max_us;
+        }
+        sum += later.sum;
+        count += later.count;
+    }
+};
+
+/// @brief Fixed-capacity time series of one telemetry field, with a min/max/mean pyramid for downsampled queries.
+/// @note Samples are kept in a ring of the given capacity, so the oldest are dropped once it is full. Every
+///       SeriesFanout samples are also aggregated into a bucket of the first pyramid level, every SeriesFanout of
+///       those into one of the second and so on, each level a ring covering the same samples as the first. A range of
+///       samples is thus aggregated from at most 2 * SeriesFanout buckets per level, and a query of n points costs
+///       O(n * (log capacity + SeriesFanout * levels)), however many samples the range holds. Memory is fixed at
+///       construction: 16 bytes per sample for the ring, and at most 2 * 64 / (SeriesFanout - 1) bytes per sample for
+///       the pyramid.
+class TimeSeries {
+   public:
+    /// @brief Constructor.
+    /// @param[in] capacity Number of samples kept (at least 1).
+    explicit TimeSeries(std::size_t capacity) : samples_(std::max<std::size_t>(1, capacity)) {
+        constexpr auto FanoutBits = std::countr_zero(SeriesFanout);
+        for (auto shift = FanoutBits; (std::size_t{1} << shift) <= samples_.size(); shift += FanoutBits) {
+            auto buckets = std::bit_ceil((samples_.size() >> shift) + 2);
+            levels_.push_back(Level{std::vector<SeriesBucket>(buckets), shift, buckets - 1});
+        }
+    }
+
+    /// @brief Appends a sample.
+    /// @param[in] timestamp_us Sample timestamp, in microseconds; not before the latest sample's.
+    /// @param[in] value Sample value.
+    /// @return false if the sample is older than the latest sample, and was dropped.
+    bool push(std::uint64_t timestamp_us, double value) noexcept {
+        if (count_ > 0 && timestamp_us < sample(count_ - 1).timestamp_us) {
+            return false;
+        }
+        samples_[count_ - lap_] = SeriesPoint{timestamp_us, value};
+        for (auto& level : levels_) {
+            auto& bucket = level.buckets[(count_ >> level.shift) & level.mask];
+            if ((count_ & ((std::size_t{1} << level.shift) - 1)) == 0) {
+                bucket = SeriesBucket{};
+            }
+            bucket.add(timestamp_us, value);
+        }
+        if (++count_ - lap_ == samples_.size()) {
+            lap_ = count_;
+        }
+        return true;
+    }
+
+    /// @brief Number of samples kept.
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return std::min(count_, samples_.size()); }
+
+    /// @brief Maximum number of samples kept.
+    [[nodiscard]] auto capacity() const noexcept -> std::size_t { return samples_.size(); }
+
+    /// @brief Number of pyramid levels.
+    [[nodiscard]] auto levels() const noexcept -> std::size_t { return levels_.size(); }
+
+    /// @brief Bytes of memory held by the ring and the pyramid.
+    [[nodiscard]] auto memory() const noexcept -> std::size_t {
+        auto bytes = samples_.size() * sizeof(SeriesPoint);
+        for (const auto& level : levels_) {
+            bytes += level.buckets.size() * sizeof(SeriesBucket);
+        }
+        return bytes;
+    }
+
+    /// @brief The samples kept, oldest first.
+    /// @param[in] index Position of the sample, from 0 (oldest) to size() - 1 (latest).
+    [[nodiscard]] auto operator[](std::size_t index) const noexcept -> const SeriesPoint& {
+        return sample(oldest() + index);
+    }
+
+    /// @brief Aggregates the samples of a time range.
+    /// @param[in] begin_us First timestamp (inclusive).
+    /// @param[in] end_us Last timestamp (exclusive).
+    /// @return The aggregate, with a count of 0 if the range has no samples.
+    [[nodiscard]] auto aggregate(std::uint64_t begin_us, std::uint64_t end_us) const noexcept -> SeriesBucket {
+        auto first = lower_bound(begin_us, oldest());
+        return aggregate_samples(first, lower_bound(end_us, first));
+    }
+
+    /// @brief Downsamples a time range into equal time buckets, e.g. one per pixel of a plot.
+    /// @param[in] begin_us First timestamp (inclusive).
+    /// @param[in] end_us Last timestamp (exclusive).
+    /// @param[out] buckets The buckets; bucket i aggregates the samples of the i-th of buckets.size() equal parts of
+    ///                     the range, with a count of 0 where there are none.
+    void downsample(std::uint64_t begin_us, std::uint64_t end_us, std::span<SeriesBucket> buckets) const noexcept {
+        if (buckets.empty()) {
+            return;
+        }
+        auto first = lower_bound(begin_us, oldest());
+        for (auto bucket : std::views::iota(std::size_t{0}, buckets.size())) {
+            auto last = lower_bound(boundary(begin_us, end_us, buckets.size(), bucket + 1), first);
+            buckets[bucket] = aggregate_samples(first, last);
+            first = last;
+        }
+    }
+
+    /// @brief Picks the samples of a time range that best keep the shape of its plot (Largest-Triangle-Three-Buckets).
+    /// @note Ranges with no more samples than points are returned whole. Otherwise the first and last samples are kept
+    ///       and the range between is split into points - 2 equal time buckets; of each, the smallest and largest
+    ///       samples are the candidates (as in MinMaxLTTB), and the one forming the largest triangle with the sample
+    ///       picked before it and the middle of the next bucket is picked. Empty buckets are skipped, so fewer points
+    ///       may be returned. As the candidates come from the pyramid, the cost does not depend on the samples in the
+    ///       range.
+    /// @param[in] begin_us First timestamp (inclusive).
+    /// @param[in] end_us Last timestamp (exclusive).
+    /// @param[out] points The picked samples, oldest first; at least 3 for a decimation.
+    /// @return The number of points picked.
+    std::size_t lttb(std::uint64_t begin_us, std::uint64_t end_us, std::span<SeriesPoint> points) const {
+        auto first = lower_bound(begin_us, oldest());
+        auto last = lower_bound(end_us, first);
+        if (last - first <= points.size()) {
+            for (auto index : std::views::iota(first, last)) {
+                points[index - first] = sample(index);
+            }
+            return last - first;
+        }
+        if (points.size() < 3) {
+            return 0;
+        }
+
+        auto head = sample(first);
+        auto tail = sample(last - 1);
+        auto buckets = std::vector<SeriesBucket>(points.size() - 2);
+        auto inner = first + 1;
+        for (auto bucket : std::views::iota(std::size_t{0}, buckets.size())) {
+            auto bound = bucket + 1 == buckets.size()
+                             ? last - 1
+                             : std::min(last - 1, lower_bound(boundary(head.timestamp_us + 1, tail.timestamp_us,
+                                                                       buckets.size(), bucket + 1),
+                                                              inner));
+            buckets[bucket] = aggregate_samples(inner, bound);
+            inner = bound;
+        }
+
+        auto picked = std::size_t{0};
+        points[picked++] = head;
+        for (auto bucket : std::views::iota(std::size_t{0}, buckets.size())) {
+            const auto& candidates = buckets[bucket];
+            if (candidates.count == 0) {
+                continue;
+            }
+            auto next = SeriesPoint{tail.timestamp_us, tail.value};
+            for (const auto& later : std::span(buckets).subspan(bucket + 1)) {
+                if (later.count > 0) {
+                    next = SeriesPoint{later.first_us + (later.last_us - later.first_us) / 2, later.mean()};
+                    break;
+                }
+            }
+            auto area = [&](std::uint64_t timestamp_us, double value) {
+                const auto& previous = points[picked - 1];
+                auto dt_next = static_cast<double>(next.timestamp_us) - static_cast<double>(previous.timestamp_us);
+                auto dt = static_cast<double>(timestamp_us) - static_cast<double>(previous.timestamp_us);
+                return std::abs(dt * (next.value - previous.value) - dt_next * (value - previous.value));
+            };
+            points[picked++] = area(candidates.min_us, candidates.min) >= area(candidates.max_us, candidates.max)
+                                   ? SeriesPoint{candidates.min_us, candidates.min}
+                                   : SeriesPoint{candidates.max_us, candidates.max};
+        }
+        points[picked++] = tail;
+        return picked;
+    }
+
+   private:
+    /// @brief Ring of buckets of one pyramid level; bucket b aggregates samples b << shift to ((b + 1) << shift) - 1.
+    /// @note The ring has a power-of-two size, so that buckets are found without a division.
+    struct Level {
+        std::vector<SeriesBucket> buckets;
+        int shift;
+        std::size_t mask;
+    };
+
+    /// @brief Sequence number of the oldest sample kept.
+    [[nodiscard]] std::size_t oldest() const noexcept { return count_ - size(); }
+
+    /// @brief A sample by its sequence number.
+    [[nodiscard]] const SeriesPoint& sample(std::size_t index) const noexcept {
+        return samples_[index >= lap_ ? index - lap_ : index - lap_ + samples_.size()];
+    }
+
+    /// @brief Sequence number of the first sample kept at or after a timestamp.
+    /// @note Gallops forward from a sequence number known not to be past it, so that the consecutive searches of a
+    ///       downsampling cost the logarithm of the samples per bucket rather than of the whole series.
+    [[nodiscard]] std::size_t lower_bound(std::uint64_t timestamp_us, std::size_t from) const noexcept {
+        auto low = from;
+        auto high = from;
+        for (auto step = std::size_t{1}; high < count_ && sample(high).timestamp_us < timestamp_us; step *= 2) {
+            low = high + 1;
+            high += step;
+        }
+        auto indices = std::views::iota(low, std::min(high, count_));
+        return *std::ranges::lower_bound(indices, timestamp_us, std::less{},
+                                         [this](std::size_t index) { return sample(index).timestamp_us; });
+    }
+
+    /// @brief The i-th of the n + 1 equally spaced boundaries of a time range.
+    [[nodiscard]] static std::uint64_t boundary(std::uint64_t begin_us,
+                                                std::uint64_t end_us,
+                                                std::size_t n,
+                                                std::size_t i) noexcept {
+        if (end_us <= begin_us) {
+            return begin_us;
+        }
+        auto length = static_cast<double>(end_us - begin_us);
+        return i == n ? end_us
+                      : begin_us + static_cast<std::uint64_t>(length * static_cast<double>(i) / static_cast<double>(n));
+    }
+
+    /// @brief Aggregates the samples with sequence numbers first to last - 1, from the largest pyramid buckets that
+    ///        fit.
+    [[nodiscard]] SeriesBucket aggregate_samples(std::size_t first, std::size_t last) const noexcept {
+        auto result = SeriesBucket{};
+        while (first < last) {
+            auto level = levels_.size();
+            auto fits = [&](const Level& pyramid) {
+                auto span = std::size_t{1} << pyramid.shift;
+                return (first & (span - 1)) == 0 && last - first >= span;
+            };
+            while (level > 0 && !fits(levels_[level - 1])) {
+                --level;
+            }
+            if (level == 0) {
+                result.add(sample(first).timestamp_us, sample(first).value);
+                ++first;
+            } else {
+                const auto& pyramid = levels_[level - 1];
+                result.merge(pyramid.buckets[(first >> pyramid.shift) & pyramid.mask]);
+                first += std::size_t{1} << pyramid.shift;
+            }
+        }
+        return result;
+    }
+
+    std::vector<SeriesPoint> samples_;
+    std::vector<Level> levels_;
+    std::size_t count_ = 0;  ///< Samples pushed since construction, i.e. sequence number of the next sample.
+    std::size_t lap_ = 0;    ///< Sequence number of the sample in the first slot of the ring's current lap.
+};
+
+/// @brief Identifies the time series of one payload field of one system.
+struct SeriesKey {
+    std::uint32_t msgid;  ///< Message ID.
+    std::uint8_t sysid;   ///< System ID.
+    std::uint16_t field;  ///< Index of the field in the payload.
+
+    auto operator<=>(const SeriesKey&) const = default;
+};
+
+/// @brief In-memory time series of selected telemetry fields, fed with deserialized payloads.
+/// @note Only tracked fields are stored, each in a TimeSeries with its own capacity, so memory is bounded by the sum
+///       of the tracked fields' TimeSeries::memory().
+class TelemetryStore {
+   public:
+    /// @brief Starts storing a field of a payload type from a system; keeps the series if it is already tracked.
+    /// @tparam MessageT The payload type (e.g. payloads::Attitude).
+    /// @tparam I Index of the field in the payload; must be a scalar field.
+    /// @param[in] sysid System ID.
+    /// @param[in] capacity Number of samples kept.
+    /// @return The series.
+    template <typename MessageT, std::size_t I>
+    TimeSeries& track(std::uint8_t sysid, std::size_t capacity) {
+        using FieldType = std::remove_cvref_t<typename boost::pfr::tuple_element<I, MessageT>::type>;
+        static_assert(std::is_arithmetic_v<typename UnwrapField<FieldType>::Type>, "Only scalar fields are stored");
+        return series_.try_emplace(SeriesKey{MessageT::MessageId, sysid, static_cast<std::uint16_t>(I)}, capacity)
+            .first->second;
+    }
+
+    /// @brief Stops storing a field, releasing its memory.
+    void untrack(const SeriesKey& key) { series_.erase(key); }
+
+    /// @brief Stores the tracked fields of a payload.
+    /// @tparam MessageT The payload type (e.g. payloads::LazyAttitude or payloads::ViewAttitude).
+    /// @param[in] sysid System ID of the message.
+    /// @param[in] timestamp_us Message timestamp, in microseconds.
+    /// @param[in] payload The payload.
+    /// @return The number of samples stored.
+    template <typename MessageT>
+    std::size_t add(std::uint8_t sysid, std::uint64_t timestamp_us, const MessageT& payload) {
+        auto stored = std::size_t{0};
+        auto first = series_.lower_bound(SeriesKey{MessageT::MessageId, sysid, 0});
+        for (auto series = first; series != series_.end() && series->first.msgid == MessageT::MessageId &&
+                                  series->first.sysid == sysid;
+             ++series) {
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                ((series->first.field == I ? void(stored += push_field<I>(series->second, timestamp_us, payload))
+                                           : void()),
+                 ...);
+            }(std::make_index_sequence<boost::pfr::tuple_size_v<MessageT>>{});
+        }
+        return stored;
+    }
+
+    /// @brief Finds the series of a field.
+    /// @return The series, or nullptr if the field is not tracked.
+    [[nodiscard]] auto find(const SeriesKey& key) const noexcept -> const TimeSeries* {
+        auto series = series_.find(key);
+        return series == series_.end() ? nullptr : &series->second;
+    }
+
+    /// @brief Finds the series of a field.
+    /// @tparam MessageT The payload type (e.g. payloads::Attitude).
+    /// @tparam I Index of the field in the payload.
+    /// @return The series, or nullptr if the field is not tracked.
+    template <typename MessageT, std::size_t I>
+    [[nodiscard]] auto find(std::uint8_t sysid) const noexcept -> const TimeSeries* {
+        return find(SeriesKey{MessageT::MessageId, sysid, static_cast<std::uint16_t>(I)});
+    }
+
+    /// @brief Number of tracked fields.
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return series_.size(); }
+
+    /// @brief Bytes of memory held by the series.
+    [[nodiscard]] auto memory() const noexcept -> std::size_t {
+        auto bytes = std::size_t{0};
+        for (const auto& [key, series] : series_) {
+            bytes += series.memory();
+        }
+        return bytes;
+    }
+
+   private:
+    /// @brief Pushes a field of a payload, if it is a scalar field.
+    template <std::size_t I, typename MessageT>
+    static bool push_field(TimeSeries& series, std::uint64_t timestamp_us, const MessageT& payload) {
+        const auto& field = boost::pfr::get<I>(payload);
+        using FieldType = std::remove_cvref_t<decltype(field)>;
+        if constexpr (std::is_arithmetic_v<typename UnwrapField<FieldType>::Type>) {
+            if constexpr (IsViewField<FieldType>) {
+                return series.push(timestamp_us, static_cast<double>(field.value()));
+            } else {
+                return series.push(timestamp_us, static_cast<double>(field.value));
+            }
+        } else {
+            return false;
+        }
+    }
+
+    std::map<SeriesKey, TimeSeries> series_;
+};
+
+}  // namespace mavlink
@@ -0,0 +1,654 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "mavlink/framer.hpp"
+#include "mavlink/message_registry.hpp"
+#include "mavlink/types.hpp"
+#include "uart/errno_error.hpp"
+
+namespace mavlink {
+
+/// @brief Length of the big-endian microsecond timestamp written in front of every frame of a tlog.
+inline constexpr std::size_t TlogTimestampLength = 8;
+
+/// @brief Longest tlog record: a timestamp and a signed Mavlink v2 frame with a full payload.
+inline constexpr std::size_t MaxTlogRecordLength =
+    TlogTimestampLength + HeaderLengthV2 + 255 + ChecksumLength + SignatureLength;
+
+/// @brief Index entry of one record of a tlog.
+struct TlogIndexEntry {
+    std::uint64_t offset;        ///< Offset of the record (i.e. of its timestamp) in the tlog.
+    std::uint64_t timestamp_us;  ///< Record timestamp, in microseconds since the Unix epoch.
+    std::uint32_t msgid;         ///< Message ID.
+    std::uint8_t sysid;          ///< System ID.
+    std::uint8_t compid;         ///< Component ID.
+    std::uint16_t length;        ///< Length of the frame, without the timestamp.
+};
+static_assert(std::is_trivially_copyable_v<TlogIndexEntry> && sizeof(TlogIndexEntry) == 24);
+
+/// @brief A record of a tlog.
+struct TlogRecord {
+    std::uint64_t timestamp_us;  ///< Record timestamp, in microseconds since the Unix epoch.
+    MessageView view;            ///< View of the frame, referring into the mapped tlog.
+};
+
+/// @brief Selects records of a tlog; unset fields match every record.
+struct TlogQuery {
+    std::optional<std::uint32_t> msgid{};                                ///< Message ID.
+    std::optional<std::uint8_t> sysid{};                                 ///< System ID.
+    std::uint64_t begin_us = 0;                                          ///< First timestamp (inclusive).
+    std::uint64_t end_us = std::numeric_limits<std::uint64_t>::max();  ///< Last timestamp (exclusive).
+};
+
+namespace detail {
+
+using uart::detail::errno_error;
+
+/// @brief Writes a whole buffer at an offset of a file, continuing after short writes.
+[[nodiscard]] inline bool pwrite_all(int fd, std::span<const std::byte> bytes, off_t offset) noexcept {
+    while (!bytes.empty()) {
+        auto result = ::pwrite(fd, bytes.data(), bytes.size(), offset);
+        if (result <= 0) {
+            return false;
+        }
+        bytes = bytes.subspan(static_cast<std::size_t>(result));
+        offset += result;
+    }
+    return true;
+}
+
+/// @brief Reads a whole buffer from an offset of a file, continuing after short reads.
+[[nodiscard]] inline bool pread_all(int fd, std::span<std::byte> bytes, off_t offset) noexcept {
+    while (!bytes.empty()) {
+        auto result = ::pread(fd, bytes.data(), bytes.size(), offset);
+        if (result <= 0) {
+            return false;
+        }
+        bytes = bytes.subspan(static_cast<std::size_t>(result));
+        offset += result;
+    }
+    return true;
+}
+
+/// @brief Runs a job for each of a number of tasks on a number of threads, the calling one included.
+template <typename Job>
+void run_parallel(std::size_t tasks, std::size_t threads, Job job) {
+    auto next = std::atomic<std::size_t>{0};
+    auto work = [&] {
+        for (auto task = next++; task < tasks; task = next++) {
+            job(task);
+        }
+    };
+    auto workers = std::vector<std::jthread>{};
+    for ([[maybe_unused]] auto thread : std::views::iota(std::size_t{1}, std::min(threads, tasks))) {
+        workers.emplace_back(work);
+    }
+    work();
+}
+
+/// @brief Sorts a range on a number of threads: each sorts a part, then the parts are merged pairwise.
+template <typename Less>
+void parallel_sort(std::span<std::size_t> items, Less less, std::size_t threads) {
+    auto parts = std::max<std::size_t>(1, std::min(threads, items.size() / 65536));
+    auto bound = [&](std::size_t part) {
+        return items.begin() + static_cast<std::ptrdiff_t>(items.size() * part / parts);
+    };
+    run_parallel(parts, parts, [&](std::size_t part) { std::sort(bound(part), bound(part + 1), less); });
+    for (auto width = std::size_t{1}; width < parts; width *= 2) {
+        run_parallel((parts + 2 * width - 1) / (2 * width), parts, [&](std::size_t pair) {
+            auto first = pair * 2 * width;
+            if (first + width < parts) {
+                std::inplace_merge(bound(first), bound(first + width), bound(std::min(first + 2 * width, parts)), less);
+            }
+        });
+    }
+}
+
+}  // namespace detail
+
+/// @brief Reads the big-endian timestamp of a tlog record.
+[[nodiscard]] inline std::uint64_t tlog_timestamp(std::span<const std::uint8_t> tlog, std::uint64_t offset) noexcept {
+    auto timestamp = std::uint64_t{0};
+    std::memcpy(&timestamp, tlog.data() + offset, sizeof(timestamp));
+    if constexpr (std::endian::native == std::endian::little) {
+        timestamp = std::byteswap(timestamp);
+    }
+    return timestamp;
+}
+
+/// @brief Checks that a valid record starts at an offset of a tlog.
+/// @param[in] tlog The tlog.
+/// @param[in] offset Offset of the record.
+/// @param[in] options Message table for checksum validation.
+/// @return The frame of the record, or std::nullopt if there is no valid record (or only a cut-off one).
+[[nodiscard]] inline std::optional<MessageView> tlog_record_at(std::span<const std::uint8_t> tlog,
+                                                               std::uint64_t offset,
+                                                               const FramerOptions& options) noexcept {
+    if (offset + TlogTimestampLength >= tlog.size()) {
+        return std::nullopt;
+    }
+    auto frame = tlog.subspan(offset + TlogTimestampLength);
+    if (frame[0] != MagicV2 && frame[0] != MagicV1) {
+        return std::nullopt;
+    }
+    auto length = frame_length(frame);
+    if (!length || *length > frame.size()) {
+        return std::nullopt;
+    }
+    auto result = validate_frame(frame.first(*length), options);
+    if (!result || !result->has_value()) {
+        return std::nullopt;
+    }
+    return **result;
+}
+
+/// @brief Finds the first record of a tlog at or after an offset, e.g. to resynchronize after corrupt bytes.
+/// @note A candidate is the start of a frame whose checksum (CRC_EXTRA included) validates against the message table.
+///       A frame of a message not in the table cannot be checked, so it is only taken if the next record also starts
+///       with a start-of-frame marker (or the tlog ends there); this keeps 0xFD and 0xFE payload bytes from being
+///       mistaken for record boundaries.
+/// @param[in] tlog The tlog.
+/// @param[in] from Offset to search from.
+/// @param[in] options Message table for checksum validation.
+/// @return Offset of the record, or std::nullopt if there is none.
+[[nodiscard]] inline std::optional<std::uint64_t> find_tlog_record(std::span<const std::uint8_t> tlog,
+                                                                   std::uint64_t from,
+                                                                   const FramerOptions& options) noexcept {
+    auto offset = from;
+    while (offset + TlogTimestampLength < tlog.size()) {
+        offset += find_start_marker(tlog.subspan(offset + TlogTimestampLength));
+        auto view = tlog_record_at(tlog, offset, options);
+        if (view) {
+            auto next = offset + TlogTimestampLength + view->frame.size();
+            if (find_message_info(options.messages, view->msgid) || next + TlogTimestampLength >= tlog.size() ||
+                tlog[next + TlogTimestampLength] == MagicV2 || tlog[next + TlogTimestampLength] == MagicV1) {
+                return offset;
+            }
+        }
+        ++offset;
+    }
+    return std::nullopt;
+}
+
+/// @brief Indexes the records of a tlog one after the other, resynchronizing after corrupt bytes.
+/// @param[in] tlog The tlog.
+/// @param[in] begin Offset of the first record.
+/// @param[in] end Records starting at or after this offset are left out.
+/// @param[in] options Message table for checksum validation.
+/// @param[out] entries The index entries are appended to this.
+/// @return Offset of the first record left out, or of a record cut off by the end of the tlog.
+inline std::uint64_t scan_tlog_records(std::span<const std::uint8_t> tlog,
+                                       std::uint64_t begin,
+                                       std::uint64_t end,
+                                       const FramerOptions& options,
+                                       std::vector<TlogIndexEntry>& entries) {
+    auto offset = begin;
+    while (offset < end && offset + TlogTimestampLength < tlog.size()) {
+        if (auto view = tlog_record_at(tlog, offset, options)) {
+            auto length = view->frame.size();
+            entries.push_back(TlogIndexEntry{offset, tlog_timestamp(tlog, offset), view->msgid, view->sysid,
+                                             view->compid, static_cast<std::uint16_t>(length)});
+            offset += TlogTimestampLength + length;
+            continue;
+        }
+        auto next = find_tlog_record(tlog, offset + 1, options);
+        if (!next) {
+            break;  // garbage or a cut-off record (probably still being written) up to the end
+        }
+        offset = *next;
+    }
+    return std::min<std::uint64_t>(offset, tlog.size());
+}
+
+/// @brief Result of scanning a tlog.
+struct TlogScan {
+    std::vector<TlogIndexEntry> entries;  ///< Index entries of the records, in file order.
+    std::uint64_t end;                    ///< Offset the scan stopped at: the end of the tlog or a cut-off record.
+};
+
+/// @brief Indexes the records of a tlog from an offset on, on a number of threads.
+/// @note The tlog is split into chunks, which the threads take in turn. Every chunk but the first starts at the first
+///       record find_tlog_record finds in it, and ends with the record that crosses into the next chunk. The chunks
+///       are then joined in file order: where a chunk's scan did not start on the record boundary the previous chunk
+///       ended at (a corrupt stretch, or a false start-of-frame), the bytes are rescanned one record after the other
+///       until the two scans meet, so the result is the same as that of a single-threaded scan. The entries stay in
+///       file order, which is what the stored index and appends rely on; TlogReader merges them into timestamp order
+///       for queries.
+/// @param[in] tlog The tlog.
+/// @param[in] from Offset of the first record.
+/// @param[in] options Message table for checksum validation.
+/// @param[in] threads Number of threads, the calling one included.
+/// @return The index entries and the offset the scan stopped at.
+[[nodiscard]] inline TlogScan scan_tlog(std::span<const std::uint8_t> tlog,
+                                        std::uint64_t from,
+                                        const FramerOptions& options,
+                                        std::size_t threads = 1) {
+    constexpr auto MinChunkLength = std::size_t{1} << 20;
+    constexpr auto ChunksPerThread = std::size_t{4};
+
+    struct Chunk {
+        std::uint64_t begin;
+        std::uint64_t end;
+        std::uint64_t stop;
+        std::vector<TlogIndexEntry> entries;
+    };
+    auto length = tlog.size() - std::min<std::uint64_t>(from, tlog.size());
+    auto count = (threads <= 1) ? std::size_t{1}
+                                : std::clamp<std::size_t>(length / MinChunkLength, 1, threads * ChunksPerThread);
+    auto chunks = std::vector<Chunk>(count);
+    for (auto index : std::views::iota(std::size_t{0}, count)) {
+        chunks[index].begin = from + length * index / count;
+        chunks[index].end = from + length * (index + 1) / count;
+    }
+
+    detail::run_parallel(count, threads, [&](std::size_t index) {
+        auto& chunk = chunks[index];
+        auto first = (index == 0) ? std::optional{chunk.begin} : find_tlog_record(tlog, chunk.begin, options);
+        if (first && *first < chunk.end) {
+            chunk.entries.reserve((chunk.end - chunk.begin) / 32);
+            chunk.stop = scan_tlog_records(tlog, *first, chunk.end, options, chunk.entries);
+        }
+    });
+
+    auto scan = TlogScan{{}, from};
+    auto total = std::size_t{0};
+    for (const auto& chunk : chunks) {
+        total += chunk.entries.size();
+    }
+    scan.entries.reserve(total);
+    for (const auto& chunk : chunks) {
+        auto next = std::ranges::lower_bound(chunk.entries, scan.end, std::less{}, &TlogIndexEntry::offset);
+        while (next != chunk.entries.end() && next->offset != scan.end) {
+            auto stop = scan_tlog_records(tlog, scan.end, next->offset, options, scan.entries);
+            if (stop < next->offset) {
+                return scan;  // nothing valid up to the end of the tlog
+            }
+            scan.end = stop;
+            next = std::ranges::lower_bound(next, chunk.entries.end(), scan.end, std::less{}, &TlogIndexEntry::offset);
+        }
+        if (next != chunk.entries.end()) {
+            scan.entries.insert(scan.entries.end(), next, chunk.entries.end());
+            scan.end = chunk.stop;
+        } else if (scan.end < chunk.end) {
+            scan.end = scan_tlog_records(tlog, scan.end, chunk.end, options, scan.entries);
+        }
+    }
+    return scan;
+}
+
+/// @brief Reads a Mavlink telemetry log (.tlog), memory-mapped, through an index of its records.
+/// @note A tlog is a sequence of records, each an 8-byte big-endian timestamp (microseconds since the Unix epoch)
+///       followed by a raw frame. Opening a tlog indexes it in one pass (split over threads with scan_tlog) and
+///       stores the index next to it (at the tlog path with ".idx" appended), so later opens only load the index and
+///       index the records appended since. Bytes that do not start a frame (and, if a message table is given, frames
+///       of known messages whose checksum fails) are skipped; a record cut off by the end of the file is left for the
+///       next open. If the index file cannot be written, the index is only kept in memory. Queries by msgid
+///       binary-search a copy of the index sorted by msgid and timestamp, so they never touch the records they skip; if
+///       the timestamps of the tlog are not monotonic (clock steps, concatenated captures), queries without a msgid go
+///       through a copy sorted by timestamp, so every query visits records in timestamp order.
+class TlogReader {
+   public:
+    using Error = std::pair<int, std::string>;
+
+    /// @brief Constructor.
+    /// @param[in] path Path of the tlog.
+    /// @param[in] messages Messages whose checksum is validated while indexing, sorted by msgid (e.g.
+    ///                     MessageRegistry<...>::Entries); must outlive the reader.
+    explicit TlogReader(std::string_view path, std::span<const MessageInfo> messages = {}) noexcept
+        : path_(path), index_path_(std::string(path) + ".idx"), options_{messages} {}
+    ~TlogReader() { close(); }
+    TlogReader(const TlogReader&) = delete;
+    TlogReader(TlogReader&&) = delete;
+    auto operator=(const TlogReader&) = delete;
+    auto operator=(TlogReader&&) = delete;
+
+    /// @brief Maps the tlog and loads, extends or builds its index; will close the tlog if already open.
+    /// @note Opening again picks up records appended since.
+    /// @param[in] threads Number of threads indexing the tlog (0 for one per hardware thread).
+    /// @return true if the tlog is open,
+    ///         error code and string via std::unexpected if it could not be opened or mapped
+    [[nodiscard]] auto open(std::size_t threads = 0) -> std::expected<bool, Error> {
+        if (threads == 0) {
+            threads = std::max(1U, std::thread::hardware_concurrency());
+        }
+        close();
+        auto fd = ::open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return detail::errno_error();
+        }
+        struct stat status {};
+        if (::fstat(fd, &status) != 0) {
+            auto error = detail::errno_error();
+            ::close(fd);
+            return error;
+        }
+        size_ = static_cast<std::size_t>(status.st_size);
+        if (size_ > 0) {
+            auto* map = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map == MAP_FAILED) {
+                auto error = detail::errno_error();
+                ::close(fd);
+                return error;
+            }
+            map_ = static_cast<const std::uint8_t*>(map);
+        }
+        ::close(fd);  // the mapping keeps the file
+
+        auto loaded = load_index();
+        auto stored_entries = entries_.size();
+        auto stored_covered = covered_;
+        index_from(covered_, threads);
+        if (!loaded) {
+            store_index(0);
+        } else if (covered_ != stored_covered) {
+            store_index(stored_entries);
+        }
+
+        by_message_.resize(entries_.size());
+        std::ranges::copy(std::views::iota(std::size_t{0}, entries_.size()), by_message_.begin());
+        auto key = [this](std::size_t entry) {
+            return std::tuple{entries_[entry].msgid, entries_[entry].timestamp_us, entry};
+        };
+        detail::parallel_sort(
+            by_message_, [&](std::size_t lhs, std::size_t rhs) { return key(lhs) < key(rhs); }, threads);
+        in_time_order_ = std::ranges::is_sorted(entries_, std::less{}, &TlogIndexEntry::timestamp_us);
+        if (!in_time_order_) {
+            // clock steps or concatenated captures: merge the records into timestamp order, ties in file order
+            by_time_.resize(entries_.size());
+            std::ranges::copy(std::views::iota(std::size_t{0}, entries_.size()), by_time_.begin());
+            auto time_key = [this](std::size_t entry) { return std::pair{entries_[entry].timestamp_us, entry}; };
+            detail::parallel_sort(
+                by_time_, [&](std::size_t lhs, std::size_t rhs) { return time_key(lhs) < time_key(rhs); }, threads);
+        }
+        isopen_ = true;
+        return true;
+    }
+
+    [[nodiscard]] auto is_open() const noexcept -> bool { return isopen_; }
+
+    /// @brief Unmaps the tlog and drops its index from memory.
+    void close() noexcept {
+        if (map_ != nullptr) {
+            ::munmap(const_cast<std::uint8_t*>(map_), size_);
+        }
+        map_ = nullptr;
+        size_ = 0;
+        covered_ = 0;
+        entries_.clear();
+        by_message_.clear();
+        by_time_.clear();
+        isopen_ = false;
+    }
+
+    /// @brief Path of the index file.
+    [[nodiscard]] auto index_path() const noexcept -> std::string_view { return index_path_; }
+
+    /// @brief The mapped tlog.
+    [[nodiscard]] auto bytes() const noexcept -> std::span<const std::uint8_t> { return {map_, size_}; }
+
+    /// @brief The index, in file order.
+    [[nodiscard]] auto index() const noexcept -> std::span<const TlogIndexEntry> { return entries_; }
+
+    /// @brief Number of indexed records.
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return entries_.size(); }
+
+    /// @brief Reads the record of an index entry.
+    [[nodiscard]] auto record(const TlogIndexEntry& entry) const noexcept -> TlogRecord {
+        auto frame = bytes().subspan(entry.offset + TlogTimestampLength, entry.length);
+        return TlogRecord{entry.timestamp_us, parse_frame(frame)};
+    }
+
+    /// @brief Invokes the visitor for every record the query selects.
+    /// @note Records are visited in timestamp order; records with the same timestamp in file order.
+    /// @tparam Visitor Callable accepting a TlogRecord.
+    /// @param[in] query The records to select.
+    /// @param[in] visitor The visitor to invoke with each record.
+    /// @return The number of records visited.
+    template <typename Visitor>
+    std::size_t query(const TlogQuery& query, Visitor&& visitor) const {
+        auto visited = std::size_t{0};
+        auto visit = [&](const TlogIndexEntry& entry) {
+            if ((query.sysid && entry.sysid != *query.sysid) || entry.timestamp_us < query.begin_us ||
+                entry.timestamp_us >= query.end_us) {
+                return;
+            }
+            std::invoke(visitor, record(entry));
+            ++visited;
+        };
+
+        if (query.msgid) {
+            auto key = [this](std::size_t entry) {
+                return std::pair{entries_[entry].msgid, entries_[entry].timestamp_us};
+            };
+            auto first =
+                std::ranges::lower_bound(by_message_, std::pair{*query.msgid, query.begin_us}, std::less{}, key);
+            auto last = std::ranges::lower_bound(first, by_message_.end(), std::pair{*query.msgid, query.end_us},
+                                                 std::less{}, key);
+            for (auto entry : std::ranges::subrange(first, last)) {
+                visit(entries_[entry]);
+            }
+        } else if (in_time_order_) {
+            auto first = std::ranges::lower_bound(entries_, query.begin_us, std::less{}, &TlogIndexEntry::timestamp_us);
+            auto last = std::ranges::lower_bound(first, entries_.end(), query.end_us, std::less{},
+                                                 &TlogIndexEntry::timestamp_us);
+            std::ranges::for_each(first, last, visit);
+        } else {
+            auto key = [this](std::size_t entry) { return entries_[entry].timestamp_us; };
+            auto first = std::ranges::lower_bound(by_time_, query.begin_us, std::less{}, key);
+            auto last = std::ranges::lower_bound(first, by_time_.end(), query.end_us, std::less{}, key);
+            for (auto entry : std::ranges::subrange(first, last)) {
+                visit(entries_[entry]);
+            }
+        }
+        return visited;
+    }
+
+   private:
+    /// @brief Header of an index file, followed by the index entries in file order.
+    struct IndexHeader {
+        std::array<char, 8> magic;
+        std::uint32_t entry_size;
+        std::uint32_t reserved;
+        std::uint64_t count;    ///< Number of entries.
+        std::uint64_t covered;  ///< Bytes of the tlog the entries cover.
+    };
+    static constexpr std::array<char, 8> IndexMagic{'M', 'A', 'V', 'T', 'L', 'I', 'D', 'X'};
+
+    /// @brief Indexes the records from an offset to the end of the tlog.
+    void index_from(std::uint64_t offset, std::size_t threads) {
+        ::madvise(const_cast<std::uint8_t*>(map_), size_, MADV_SEQUENTIAL);
+        auto scan = scan_tlog(bytes(), offset, options_, threads);
+        if (entries_.empty()) {
+            entries_ = std::move(scan.entries);
+        } else {
+            entries_.insert(entries_.end(), scan.entries.begin(), scan.entries.end());
+        }
+        covered_ = scan.end;
+        ::madvise(const_cast<std::uint8_t*>(map_), size_, MADV_NORMAL);
+    }
+
+    /// @brief Loads the index file, if it matches the tlog.
+    /// @return true if the index was loaded.
+    bool load_index() {
+        auto fd = ::open(index_path_.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return false;
+        }
+        auto header = IndexHeader{};
+        struct stat status {};
+        auto valid = ::fstat(fd, &status) == 0 &&
+                     detail::pread_all(fd, std::as_writable_bytes(std::span(&header, 1)), 0) &&
+                     header.magic == IndexMagic && header.entry_size == sizeof(TlogIndexEntry) &&
+                     header.covered <= size_ &&
+                     static_cast<std::size_t>(status.st_size) >= sizeof(header) + header.count * sizeof(TlogIndexEntry);
+        if (valid) {
+            entries_.resize(header.count);
+            valid = detail::pread_all(fd, std::as_writable_bytes(std::span(entries_)), sizeof(header));
+        }
+        ::close(fd);
+
+        // a tlog that was replaced rather than appended to no longer has the indexed records where they were
+        auto matches = [this](const TlogIndexEntry& entry) {
+            if (entry.offset + TlogTimestampLength + entry.length > size_) {
+                return false;
+            }
+            auto view = record(entry).view;
+            return (map_[entry.offset + TlogTimestampLength] == MagicV2 ||
+                    map_[entry.offset + TlogTimestampLength] == MagicV1) &&
+                   view.msgid == entry.msgid && view.sysid == entry.sysid;
+        };
+        if (!valid || (!entries_.empty() && (!matches(entries_.front()) || !matches(entries_.back())))) {
+            entries_.clear();
+            return false;
+        }
+        covered_ = header.covered;
+        return true;
+    }
+
+    /// @brief Writes the index file, or appends to it the entries from first on.
+    void store_index(std::size_t first) noexcept {
+        auto flags = O_WRONLY | O_CLOEXEC | (first == 0 ? O_CREAT | O_TRUNC : 0);
+        auto fd = ::open(index_path_.c_str(), flags, 0644);
+        if (fd < 0) {
+            return;
+        }
+        auto header = IndexHeader{IndexMagic, sizeof(TlogIndexEntry), 0, entries_.size(), covered_};
+        auto entries = std::as_bytes(std::span(entries_).subspan(first));
+        auto offset = static_cast<off_t>(sizeof(header) + first * sizeof(TlogIndexEntry));
+        auto written = detail::pwrite_all(fd, entries, offset);
+        // the header goes last, so an interrupted append leaves the old header, which covers only the old entries
+        if (!written || !detail::pwrite_all(fd, std::as_bytes(std::span(&header, 1)), 0)) {
+            [[maybe_unused]] auto truncated = ::ftruncate(fd, 0);
+        }
+        ::close(fd);
+    }
+
+    std::string path_;
+    std::string index_path_;
+    FramerOptions options_;
+    const std::uint8_t* map_ = nullptr;
+    std::size_t size_ = 0;
+    std::uint64_t covered_ = 0;
+    std::vector<TlogIndexEntry> entries_;
+    std::vector<std::size_t> by_message_;  ///< Positions in entries_, sorted by msgid and timestamp.
+    std::vector<std::size_t> by_time_;     ///< Positions in entries_, sorted by timestamp, if entries_ is not.
+    bool in_time_order_ = true;
+    bool isopen_ = false;
+};
+
+/// @brief Appends records to a Mavlink telemetry log (.tlog), e.g. while capturing a live link.
+/// @note Each record is handed to the OS in a single append, so a reader never sees a timestamp without its frame
+///       unless the disk fills up; TlogReader picks up the appended records the next time it opens the tlog.
+class TlogWriter {
+   public:
+    using Clock = std::chrono::system_clock;
+    using Error = std::pair<int, std::string>;
+
+    /// @brief Constructor.
+    /// @param[in] path Path of the tlog, which is created if it does not exist.
+    explicit TlogWriter(std::string_view path) noexcept : path_(path) {}
+    ~TlogWriter() { close(); }
+    TlogWriter(const TlogWriter&) = delete;
+    TlogWriter(TlogWriter&&) = delete;
+    auto operator=(const TlogWriter&) = delete;
+    auto operator=(TlogWriter&&) = delete;
+
+    /// @brief Opens the tlog for appending; will close it if already open.
+    /// @return true if the tlog is open,
+    ///         error code and string via std::unexpected if it could not be opened
+    [[nodiscard]] auto open() -> std::expected<bool, Error> {
+        close();
+        handle_ = ::open(path_.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+        if (handle_ < 0) {
+            return detail::errno_error();
+        }
+        return true;
+    }
+
+    [[nodiscard]] auto is_open() const noexcept -> bool { return handle_ >= 0; }
+
+    void close() noexcept {
+        if (handle_ >= 0) {
+            ::close(handle_);
+        }
+        handle_ = -1;
+    }
+
+    /// @brief Appends a record.
+    /// @param[in] frame The complete frame.
+    /// @param[in] timestamp_us Record timestamp, in microseconds since the Unix epoch.
+    /// @return The number of bytes appended,
+    ///         error code and string via std::unexpected if the frame is too long or the write failed
+    auto write(std::span<const std::uint8_t> frame, std::uint64_t timestamp_us) -> std::expected<std::size_t, Error> {
+        if (frame.size() + TlogTimestampLength > MaxTlogRecordLength) {
+            return std::unexpected(Error{EINVAL, "Frame too long"});
+        }
+        auto record = std::array<std::uint8_t, MaxTlogRecordLength>{};
+        if constexpr (std::endian::native == std::endian::little) {
+            timestamp_us = std::byteswap(timestamp_us);
+        }
+        std::memcpy(record.data(), &timestamp_us, TlogTimestampLength);
+        std::ranges::copy(frame, record.begin() + TlogTimestampLength);
+
+        auto pending = std::span(record).first(TlogTimestampLength + frame.size());
+        while (!pending.empty()) {
+            auto result = ::write(handle_, pending.data(), pending.size());
+            if (result < 0) {
+                return detail::errno_error();
+            }
+            pending = pending.subspan(static_cast<std::size_t>(result));
+        }
+        return TlogTimestampLength + frame.size();
+    }
+
+    /// @brief Appends a record.
+    /// @param[in] frame The complete frame.
+    /// @param[in] time Record time.
+    /// @return The number of bytes appended,
+    ///         error code and string via std::unexpected if the frame is too long or the write failed
+    auto write(std::span<const std::uint8_t> frame, Clock::time_point time) -> std::expected<std::size_t, Error> {
+        auto timestamp = std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count();
+        return write(frame, static_cast<std::uint64_t>(timestamp));
+    }
+
+    /// @brief Appends the frame of a received message.
+    /// @param[in] view The message, e.g. as yielded by a Framer.
+    /// @param[in] time Record time.
+    /// @return The number of bytes appended,
+    ///         error code and string via std::unexpected if the write failed
+    auto write(const MessageView& view, Clock::time_point time) -> std::expected<std::size_t, Error> {
+        return write(view.frame, time);
+    }
+
+   private:
+    std::string path_;
+    int handle_{-1};
+};
+
+}  // namespace mavlink
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <expected>
 #include <optional>
 #include <span>
@@ -19,6 +21,21 @@ enum class MavlinkError {
     ProtocolViolation
 };
 
+/// @brief Start-of-frame marker for Mavlink v1 frames.
+inline constexpr std::uint8_t MagicV1 = 0xFE;
+/// @brief Start-of-frame marker for Mavlink v2 frames.
+inline constexpr std::uint8_t MagicV2 = 0xFD;
+/// @brief Header length (including the start marker) of a Mavlink v1 frame.
+inline constexpr std::size_t HeaderLengthV1 = 6;
+/// @brief Header length (including the start marker) of a Mavlink v2 frame.
+inline constexpr std::size_t HeaderLengthV2 = 10;
+/// @brief Length of the trailing X.25 checksum.
+inline constexpr std::size_t ChecksumLength = 2;
+/// @brief Length of the optional Mavlink v2 signature block.
+inline constexpr std::size_t SignatureLength = 13;
+/// @brief Incompatibility flag marking a signed Mavlink v2 frame.
+inline constexpr std::uint8_t IncompatFlagSigned = 0x01;
+
 /// @brief Represents a parsed Mavlink message view with zero-copy payload.
 struct MessageView {
     std::uint32_t msgid;                    ///< Message ID.
@@ -26,6 +43,9 @@ struct MessageView {
     std::uint8_t compid;                    ///< Component ID.
     std::uint8_t seq;                       ///< Sequence number.
     std::span<const std::uint8_t> payload;  ///< Payload view.
+    std::span<const std::uint8_t> frame;    ///< Raw frame, from the start marker through the checksum or signature.
+    std::uint8_t incompat_flags;            ///< Incompatibility flags (always 0 for Mavlink v1).
+    std::uint8_t compat_flags;              ///< Compatibility flags (always 0 for Mavlink v1).
 };
 
 // --- Traits for Payload Fields ---
@@ -46,6 +66,47 @@ struct RxField {
     T value;
 };
 
+/// @brief Wrapper for lazily decoded Rx fields, viewing the field's bytes in a received payload.
+/// @note The view is only valid while the payload it was bound to is (e.g. until the framer reuses its buffer).
+/// @tparam T The type of the field.
+template <typename T>
+struct ViewField {
+    using ValueType = T;
+    std::span<const std::uint8_t> bytes;  ///< Bytes of the field present in the payload (fewer if zero-truncated).
+
+    /// @brief Decodes the field with an unaligned load.
+    /// @return The field value, with zero for bytes cut off by zero truncation.
+    [[nodiscard]] T value() const noexcept {
+        auto val = T{};
+        if (bytes.size() == sizeof(T)) {
+            std::memcpy(&val, bytes.data(), sizeof(T));
+        } else if constexpr (sizeof(T) > 1) {
+            // a one-byte field is either present or cut off whole, and the bounds check cannot see that
+            if (!bytes.empty()) {
+                std::memcpy(&val, bytes.data(), bytes.size());
+            }
+        }
+        return val;
+    }
+};
+
+/// @brief Whether a field type is a ViewField.
+/// @tparam T The field type.
+template <typename T>
+inline constexpr bool IsViewField = false;
+
+/// @brief Specialization for ViewField.
+template <typename T>
+inline constexpr bool IsViewField<ViewField<T>> = true;
+
+/// @brief Column of one field of a batch of decoded payloads.
+/// @tparam T The type of the field.
+template <typename T>
+struct ColumnField {
+    using ValueType = T;
+    std::vector<T> values;  ///< The field of every payload of the batch, in order.
+};
+
 /// @brief Traits for Tx payload fields.
 struct TxTraits {
     template <typename T>
@@ -58,4 +119,16 @@ struct RxTraits {
     using Field = RxField<T>;
 };
 
+/// @brief Traits for lazily decoded Rx payload fields, viewing a received payload.
+struct ViewTraits {
+    template <typename T>
+    using Field = ViewField<T>;
+};
+
+/// @brief Traits for columnar (struct-of-arrays) batches of decoded payloads.
+struct ColumnTraits {
+    template <typename T>
+    using Field = ColumnField<T>;
+};
+
 }  // namespace mavlink
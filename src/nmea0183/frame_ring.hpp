@@ -0,0 +1,106 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <span>
+
+#include "types.hpp"
+
+namespace nmea0183 {
+
+/// @brief One sentence buffer of a FrameRing.
+struct FrameSlot {
+    /// @brief Room for an 82-character sentence with margin for longer proprietary ones.
+    static constexpr std::size_t Capacity = 128;
+
+    std::array<char, Capacity> bytes{};
+    std::atomic<bool> held{false};  ///< true while a MessageView into the slot is out with a consumer
+};
+
+/// @brief Fixed ring of sentence slots that keeps MessageViews valid until they are released.
+/// @details A framer created with create_framer(FrameRing&) receives each sentence into the ring's active slot. When
+///          it yields a view, the slot is held and the framer moves on to the next free slot, so the view stays valid
+///          until release() is called with it, possibly from another thread. When every other slot is held, the
+///          framer yields a buffer overrun error instead of the sentence, and the sentence is lost.
+/// @note The framer side (hold) must run on one thread; release may be called from any thread. A consumer releasing
+///       a view must be done with its fields, since the slot is reused right away.
+/// @note Neither copyable nor movable; the framer keeps a pointer to the active slot span.
+class FrameRing {
+   public:
+    /// @brief Constructor.
+    /// @param[in] slots Storage for the sentences; at least two slots, the active one and one held.
+    template <std::size_t Extent>
+        requires(Extent != std::dynamic_extent && Extent >= 2)
+    explicit FrameRing(std::span<FrameSlot, Extent> slots) noexcept : slots_(slots), active_(slots_.front().bytes) {}
+
+    /// @brief Constructor.
+    /// @param[in] slots Storage for the sentences; at least two slots, the active one and one held.
+    template <std::size_t N>
+        requires(N >= 2)
+    explicit FrameRing(std::array<FrameSlot, N>& slots) noexcept : FrameRing(std::span<FrameSlot, N>(slots)) {}
+    FrameRing(const FrameRing&) = delete;
+    FrameRing(FrameRing&&) = delete;
+    auto operator=(const FrameRing&) = delete;
+    auto operator=(FrameRing&&) = delete;
+
+    /// @brief The working buffer of the framer, pointing at the active slot.
+    [[nodiscard]] std::span<char>* active() noexcept { return &active_; }
+
+    /// @brief Holds the active slot for a view into it and moves the active slot on to a free one.
+    /// @param[in] view A view yielded by the framer. A view without fields refers to no bytes and is not held.
+    /// @return false if no other slot is free.
+    [[nodiscard]] bool hold(const MessageView& view) noexcept {
+        if (anchor(view) == nullptr) {
+            return true;
+        }
+        for (auto step = std::size_t{1}; step < slots_.size(); ++step) {
+            auto index = (active_index_ + step) % slots_.size();
+            if (!slots_[index].held.load(std::memory_order_acquire)) {
+                slots_[active_index_].held.store(true, std::memory_order_relaxed);
+                active_index_ = index;
+                active_ = slots_[active_index_].bytes;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Gives the slot of a held view back to the framer; the view and copies of it become invalid.
+    /// @param[in] view A view yielded by the framer.
+    void release(const MessageView& view) noexcept {
+        auto* bytes = anchor(view);
+        auto slot = std::ranges::find_if(slots_, [&](const FrameSlot& s) {
+            return !std::less{}(bytes, s.bytes.data()) && std::less{}(bytes, s.bytes.data() + s.bytes.size());
+        });
+        if (bytes != nullptr && slot != slots_.end()) {
+            slot->held.store(false, std::memory_order_release);
+        }
+    }
+
+    /// @brief Number of slots held by consumers.
+    [[nodiscard]] std::size_t held() const noexcept {
+        return static_cast<std::size_t>(
+            std::ranges::count_if(slots_, [](const FrameSlot& s) { return s.held.load(std::memory_order_acquire); }));
+    }
+
+    /// @brief Number of slots, including the active one.
+    [[nodiscard]] std::size_t size() const noexcept { return slots_.size(); }
+
+   private:
+    // The first byte a view refers to: the address field, or the first data field of a sentence without one.
+    static const char* anchor(const MessageView& view) noexcept {
+        if (!view.talker_id.empty()) {
+            return view.talker_id.data();
+        }
+        return view.field_count > 0 ? view.fields[0].data() : nullptr;
+    }
+
+    std::span<FrameSlot> slots_;
+    std::size_t active_index_ = 0;
+    std::span<char> active_;
+};
+
+}  // namespace nmea0183
@@ -3,13 +3,18 @@
 #include <array>
 #include <charconv>
 #include <coroutine>
+#include <cstddef>
 #include <expected>
+#include <memory>
+#include <memory_resource>
+#include <new>
 #include <optional>
 #include <span>
 #include <string_view>
 #include <system_error>
 #include <utility>
 
+#include "frame_ring.hpp"
 #include "types.hpp"
 
 namespace nmea0183 {
@@ -69,6 +74,31 @@ struct Framer {
         }
 
         InputAwaiter await_transform(InputAwaiter);
+
+        /// @brief Allocates the coroutine frame from the memory resource passed to create_framer, which is stored
+        ///        behind the frame for operator delete.
+        static void* operator new(std::size_t size,
+                                  std::allocator_arg_t,
+                                  std::pmr::memory_resource* resource,
+                                  std::span<char>*,
+                                  FrameRing*) {
+            auto* frame = resource->allocate(resource_offset(size) + sizeof(resource), alignof(std::max_align_t));
+            ::new (static_cast<std::byte*>(frame) + resource_offset(size)) std::pmr::memory_resource*(resource);
+            return frame;
+        }
+
+        static void operator delete(void* frame, std::size_t size) noexcept {
+            auto* resource =
+                *std::launder(reinterpret_cast<std::pmr::memory_resource**>(static_cast<std::byte*>(frame) +
+                                                                          resource_offset(size)));
+            resource->deallocate(frame, resource_offset(size) + sizeof(resource), alignof(std::max_align_t));
+        }
+
+        /// @brief Offset of the memory resource pointer behind a coroutine frame of the given size.
+        static constexpr std::size_t resource_offset(std::size_t size) noexcept {
+            constexpr auto Alignment = alignof(std::pmr::memory_resource*);
+            return (size + Alignment - 1) / Alignment * Alignment;
+        }
     };
 };
 
@@ -119,17 +149,24 @@ constexpr std::string_view MSG_PROTOCOL = "Protocol violation: unexpected newlin
 constexpr std::string_view MSG_BAD_CRLF = "Protocol violation: missing CRLF";
 constexpr std::string_view MSG_INV_CHAR = "Invalid hex character in checksum";
 constexpr std::string_view MSG_MISMATCH = "Checksum mismatch";
+constexpr std::string_view MSG_RING_FULL = "Buffer overrun: every slot of the frame ring is held";
 }  // namespace
 
 /**
- * @brief Creates a coroutine-based NMEA parser state machine.
+ * @brief Creates a coroutine-based NMEA parser state machine whose coroutine frame is allocated from a memory resource.
+ * @param[in] resource The memory resource (e.g. a std::pmr::unsynchronized_pool_resource shared by the framers of
+ *            every connection); it must outlive the framer.
  * @param[in] active_buffer_ptr Pointer to a span used as a working buffer.
+ * @param[in] ring Optional ring owning the working buffer, whose slot is held for each yielded view.
  * @return A Framer instance.
  *
  * Yields a std::expected, containing either the payload (on success) or an
  * error code and message (on failure).
  */
-inline Framer create_framer(std::span<char>* active_buffer_ptr) {
+inline Framer create_framer(std::allocator_arg_t,
+                            [[maybe_unused]] std::pmr::memory_resource* resource,
+                            std::span<char>* active_buffer_ptr,
+                            FrameRing* ring = nullptr) {
     // --- Parser State Variables ---
     auto buffer_idx = size_t{0};
     auto calculated_checksum = uint8_t{0};
@@ -224,10 +261,44 @@ inline Framer create_framer(std::span<char>* active_buffer_ptr) {
                 continue;
             }
 
+            if (ring != nullptr && !ring->hold(view)) {
+                co_yield std::make_pair((int)ErrorCode::BUFFER_OVERRUN, MSG_RING_FULL);
+                continue;
+            }
+
             // SUCCESS: Yield the parsed view
             co_yield view;
         }
     }
 }
 
+/**
+ * @brief Creates a coroutine-based NMEA parser state machine, allocated from std::pmr::get_default_resource().
+ * @param[in] active_buffer_ptr Pointer to a span used as a working buffer.
+ * @param[in] ring Optional ring owning the working buffer, whose slot is held for each yielded view.
+ * @return A Framer instance.
+ */
+inline Framer create_framer(std::span<char>* active_buffer_ptr, FrameRing* ring = nullptr) {
+    return create_framer(std::allocator_arg, std::pmr::get_default_resource(), active_buffer_ptr, ring);
+}
+
+/**
+ * @brief Creates a framer receiving into a FrameRing, whose views stay valid until released to the ring.
+ * @param[in] ring The ring of sentence buffers; must outlive the framer.
+ * @return A Framer instance.
+ */
+inline Framer create_framer(FrameRing& ring) {
+    return create_framer(ring.active(), &ring);
+}
+
+/**
+ * @brief Creates a framer receiving into a FrameRing, with its coroutine frame allocated from a memory resource.
+ * @param[in] resource The memory resource; must outlive the framer.
+ * @param[in] ring The ring of sentence buffers; must outlive the framer.
+ * @return A Framer instance.
+ */
+inline Framer create_framer(std::allocator_arg_t, std::pmr::memory_resource* resource, FrameRing& ring) {
+    return create_framer(std::allocator_arg, resource, ring.active(), &ring);
+}
+
 }  // namespace nmea0183
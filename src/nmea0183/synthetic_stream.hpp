@@ -0,0 +1,272 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <random>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/pfr.hpp>
+
+#include "nmea0183/payloads/dtm.hpp"
+#include "nmea0183/payloads/gbs.hpp"
+#include "nmea0183/payloads/gga.hpp"
+#include "nmea0183/payloads/gll.hpp"
+#include "nmea0183/payloads/gns.hpp"
+#include "nmea0183/payloads/gsa.hpp"
+#include "nmea0183/payloads/gst.hpp"
+#include "nmea0183/payloads/hdt.hpp"
+#include "nmea0183/payloads/rmc.hpp"
+#include "nmea0183/payloads/rot.hpp"
+#include "nmea0183/payloads/vtg.hpp"
+#include "nmea0183/payloads/zda.hpp"
+#include "serializer.hpp"
+#include "types.hpp"
+
+namespace nmea0183 {
+
+/// @brief Probabilities of the faults a SyntheticStream injects, each drawn independently for every sentence.
+struct SyntheticFaults {
+    double bit_flip = 0.0;         ///< One random bit of the sentence is inverted.
+    double dropped_byte = 0.0;     ///< One random byte of the sentence is left out.
+    double truncation = 0.0;       ///< The sentence is cut off after a random number of bytes.
+    double garbage = 0.0;          ///< A burst of random bytes is sent ahead of the sentence.
+    std::size_t max_garbage = 64;  ///< Longest garbage burst, in bytes.
+};
+
+/// @brief What a SyntheticStream has emitted so far.
+struct SyntheticStats {
+    std::uint64_t sentences = 0;         ///< Sentences emitted, damaged or not.
+    std::uint64_t intact_sentences = 0;  ///< Sentences emitted without a bit flip, dropped byte or truncation.
+    std::uint64_t bit_flips = 0;         ///< Sentences with a bit flipped.
+    std::uint64_t dropped_bytes = 0;     ///< Sentences with a byte left out.
+    std::uint64_t truncations = 0;       ///< Sentences cut short.
+    std::uint64_t garbage_bursts = 0;    ///< Bursts of random bytes.
+    std::uint64_t garbage_bytes = 0;     ///< Random bytes in all bursts.
+    std::uint64_t bytes = 0;             ///< Bytes emitted in total.
+};
+
+/// @brief Rate at which a sentence is typically output.
+/// @param[in] message_type The sentence type (e.g. "GGA").
+/// @return The rate in Hz: 10 for heading sentences from a gyro or dual-antenna compass, 1 for GNSS sentences.
+[[nodiscard]] constexpr double typical_sentence_rate(std::string_view message_type) noexcept {
+    return (message_type == "HDT" || message_type == "ROT") ? 10.0 : 1.0;
+}
+
+/// @brief Deterministic generator of NMEA 0183 traffic with injected faults, for load and robustness tests.
+/// @details Each sentence type is scheduled at its own rate on a simulated clock (starting at a random phase) and
+///          sent with random field values that fit the field's width and precision; a few fields are left empty, as
+///          receivers do. Faults are then applied to the serialized sentences as configured. Random numbers are taken
+///          straight from std::mt19937_64, whose sequence is fixed by the standard, so a seed produces the same
+///          bytes with every compiler and standard library.
+/// @note Neither copyable nor movable.
+/// @tparam TalkerID The talker ID of every sentence (e.g. "GP").
+/// @tparam Payloads The Tx payload types to send (e.g. payloads::GGA).
+template <FixedString TalkerID, typename... Payloads>
+    requires(sizeof...(Payloads) > 0)
+class SyntheticStream {
+   public:
+    /// @brief Constructor; every sentence starts at its typical_sentence_rate().
+    /// @param[in] seed Seed of the random number generator.
+    /// @param[in] faults Probabilities of the faults to inject.
+    explicit SyntheticStream(std::uint64_t seed, SyntheticFaults faults = {}) : rng_(seed), faults_(faults) {
+        [&]<std::size_t... P>(std::index_sequence<P...>) {
+            (set_rate(P, typical_sentence_rate(PayloadAt<P>::MessageId)), ...);
+        }(std::index_sequence_for<Payloads...>{});
+    }
+    SyntheticStream(const SyntheticStream&) = delete;
+    SyntheticStream(SyntheticStream&&) = delete;
+    auto operator=(const SyntheticStream&) = delete;
+    auto operator=(SyntheticStream&&) = delete;
+
+    /// @brief Changes the rate of a sentence type.
+    /// @tparam Payload One of Payloads.
+    /// @param[in] hz The new rate; 0 stops the sentence.
+    template <typename Payload>
+    void set_rate(double hz) {
+        set_rate(index_of<Payload>(), hz);
+    }
+
+    /// @brief Changes the rate of every sentence type.
+    /// @param[in] hz The new rate; 0 stops all sentences.
+    void set_rates(double hz) {
+        for (auto index : std::views::iota(std::size_t{0}, sizeof...(Payloads))) {
+            set_rate(index, hz);
+        }
+    }
+
+    /// @brief Appends the next scheduled sentence to a stream.
+    /// @param[in,out] stream The stream to append to.
+    /// @return false if every sentence is stopped.
+    bool next(std::vector<char>& stream) {
+        auto due = std::ranges::min_element(due_us_);
+        if (*due == Stopped) {
+            return false;
+        }
+        auto index = static_cast<std::size_t>(due - due_us_.begin());
+        time_us_ = *due;
+        *due += period_us_[index];
+        [&]<std::size_t... P>(std::index_sequence<P...>) {
+            ((P == index ? emit<PayloadAt<P>>(stream) : void()), ...);
+        }(std::index_sequence_for<Payloads...>{});
+        return true;
+    }
+
+    /// @brief Generates the next part of the stream.
+    /// @param[in] bytes Minimum number of bytes to generate; the last sentence is completed.
+    /// @return The bytes.
+    [[nodiscard]] std::vector<char> generate(std::size_t bytes) {
+        auto stream = std::vector<char>{};
+        stream.reserve(bytes + SentenceCapacity + faults_.max_garbage);
+        while (stream.size() < bytes && next(stream)) {
+        }
+        return stream;
+    }
+
+    /// @brief Simulated time of the latest sentence, in microseconds since the start of the stream.
+    [[nodiscard]] std::uint64_t time_us() const noexcept { return time_us_; }
+
+    /// @brief What has been emitted so far.
+    [[nodiscard]] const SyntheticStats& stats() const noexcept { return stats_; }
+
+   private:
+    template <std::size_t P>
+    using PayloadAt = std::tuple_element_t<P, std::tuple<Payloads...>>;
+
+    static constexpr std::uint64_t Stopped = std::numeric_limits<std::uint64_t>::max();
+    static constexpr std::size_t SentenceCapacity = 256;
+    /// @brief Probability of a field being left empty.
+    static constexpr double EmptyField = 0.05;
+    /// @brief Values of single character fields: the letters and digits of the indicators in enumerations.hpp.
+    static constexpr std::string_view Indicators = "ACDEFKMNPRSTUVW012345678";
+    static constexpr std::array<std::string_view, 3> Strings = {"W84", "P90", "999"};
+
+    std::mt19937_64 rng_;
+    SyntheticFaults faults_;
+    std::array<std::uint64_t, sizeof...(Payloads)> period_us_{};
+    std::array<std::uint64_t, sizeof...(Payloads)> due_us_{};
+    std::array<char, SentenceCapacity> sentence_{};
+    std::uint64_t time_us_ = 0;
+    SyntheticStats stats_{};
+
+    template <typename Payload>
+    static consteval std::size_t index_of() {
+        constexpr auto matches = std::array<bool, sizeof...(Payloads)>{std::is_same_v<Payload, Payloads>...};
+        static_assert(std::ranges::count(matches, true) == 1, "Payload must be one of Payloads");
+        return static_cast<std::size_t>(std::ranges::find(matches, true) - matches.begin());
+    }
+
+    void set_rate(std::size_t index, double hz) {
+        if (hz <= 0.0) {
+            due_us_[index] = Stopped;
+            return;
+        }
+        period_us_[index] = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(1e6 / hz));
+        due_us_[index] = time_us_ + below(period_us_[index]);
+    }
+
+    /// @brief Uniformly distributed integer in [0, bound), bound > 0.
+    std::uint64_t below(std::uint64_t bound) { return rng_() % bound; }
+
+    /// @brief Uniformly distributed double in [0, 1).
+    double unit() { return static_cast<double>(rng_() >> 11) * 0x1.0p-53; }
+
+    bool chance(double probability) { return probability > 0.0 && unit() < probability; }
+
+    static constexpr double power_of_ten(int exponent) {
+        auto power = 1.0;
+        for ([[maybe_unused]] auto digit : std::views::iota(0, exponent)) {
+            power *= 10.0;
+        }
+        return power;
+    }
+
+    template <typename T, std::uint8_t P, std::uint8_t W>
+    void randomize(TxField<T, P, W>& field) {
+        if (chance(EmptyField)) {
+            field.value = std::nullopt;
+        } else if constexpr (std::is_same_v<T, std::string_view>) {
+            field.value = Strings[below(Strings.size())];
+        } else if constexpr (std::is_same_v<T, char> || std::is_enum_v<T>) {
+            field.value = static_cast<T>(Indicators[below(Indicators.size())]);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            // as many integer digits as the width leaves next to the decimals, or 2 for an unpadded field, which
+            // keeps the longest sentences within the 82 characters allowed
+            constexpr auto digits = (W > P + 1) ? W - P - 1 : 2;
+            field.value = static_cast<T>(unit() * power_of_ten(digits));
+        } else {
+            constexpr auto bound = (W > 0) ? power_of_ten(W) : 100.0;
+            field.value = static_cast<T>(below(static_cast<std::uint64_t>(bound)));
+        }
+    }
+
+    template <typename Payload>
+    void emit(std::vector<char>& stream) {
+        auto message = Message<TalkerID, Payload>{};
+        boost::pfr::for_each_field(message.payload, [&](auto& field) { randomize(field); });
+        auto length = static_cast<std::size_t>(serialize(message, sentence_));
+        inject(std::span(sentence_).first(length), stream);
+    }
+
+    /// @brief Appends a sentence to the stream, with faults drawn at random.
+    void inject(std::span<char> sentence, std::vector<char>& stream) {
+        auto start = stream.size();
+        if (chance(faults_.garbage) && faults_.max_garbage > 0) {
+            auto burst = 1 + below(faults_.max_garbage);
+            for ([[maybe_unused]] auto byte : std::views::iota(std::uint64_t{0}, burst)) {
+                stream.push_back(static_cast<char>(rng_()));
+            }
+            ++stats_.garbage_bursts;
+            stats_.garbage_bytes += burst;
+        }
+        auto intact = true;
+        if (chance(faults_.bit_flip)) {
+            auto bit = below(sentence.size() * 8);
+            sentence[bit / 8] = static_cast<char>(sentence[bit / 8] ^ (1U << (bit % 8)));
+            ++stats_.bit_flips;
+            intact = false;
+        }
+        if (chance(faults_.dropped_byte)) {
+            auto dropped = sentence.begin() + static_cast<std::ptrdiff_t>(below(sentence.size()));
+            std::ranges::copy(dropped + 1, sentence.end(), dropped);
+            sentence = sentence.first(sentence.size() - 1);
+            ++stats_.dropped_bytes;
+            intact = false;
+        }
+        if (chance(faults_.truncation) && sentence.size() > 1) {
+            sentence = sentence.first(1 + below(sentence.size() - 1));
+            ++stats_.truncations;
+            intact = false;
+        }
+        stream.insert(stream.end(), sentence.begin(), sentence.end());
+        ++stats_.sentences;
+        stats_.intact_sentences += intact ? 1 : 0;
+        stats_.bytes += stream.size() - start;
+    }
+};
+
+/// @brief SyntheticStream sending every sentence defined in this library, as a GNSS receiver with a heading sensor.
+using GnssSyntheticStream = SyntheticStream<"GP",
+                                            payloads::DTM,
+                                            payloads::GBS,
+                                            payloads::GGA,
+                                            payloads::GLL,
+                                            payloads::GNS,
+                                            payloads::GSA,
+                                            payloads::GST,
+                                            payloads::HDT,
+                                            payloads::RMC,
+                                            payloads::ROT,
+                                            payloads::VTG,
+                                            payloads::ZDA>;
+
+}  // namespace nmea0183
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cerrno>
+#include <cstring>
+#include <expected>
+#include <string>
+#include <utility>
+
+namespace uart::detail {
+
+/// @brief The current errno as an error of the std::expected results used throughout the library.
+[[nodiscard]] inline auto errno_error() -> std::unexpected<std::pair<int, std::string>> {
+    return std::unexpected<std::pair<int, std::string>>{std::make_pair(errno, std::strerror(errno))};
+}
+
+}  // namespace uart::detail
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+
+#include "errno_error.hpp"
+
+namespace uart {
+
+/// @brief Endpoint of a socket transport, parsed from a device name of the form "<scheme>:<host>:<port>".
+/// @note The schemes are those of MAVProxy and pymavlink: "udpin" (listen, answer the last sender), "udpout" (send to
+///       the host), "tcpin" (listen and accept one client at a time) and "tcp" (connect to the host). IPv6 hosts are
+///       written in brackets, e.g. "udpin:[::]:14550".
+struct SocketEndpoint {
+    std::string scheme;
+    std::string host;
+    std::string port;
+};
+
+/// @brief A resolved socket address.
+struct SocketAddress {
+    sockaddr_storage address{};
+    socklen_t length{0};
+};
+
+namespace detail {
+
+/// @brief Splits a device name into its scheme, host and port.
+/// @return The endpoint,
+///         EINVAL and a message via std::unexpected if the device name is malformed
+[[nodiscard]] inline auto parse_endpoint(std::string_view devicename)
+    -> std::expected<SocketEndpoint, std::pair<int, std::string>> {
+    auto scheme_end = devicename.find(':');
+    auto port_start = devicename.rfind(':');
+    if (scheme_end == std::string_view::npos || port_start == scheme_end || port_start + 1 == devicename.size()) {
+        return std::unexpected<std::pair<int, std::string>>{
+            std::make_pair(EINVAL, "Expected <scheme>:<host>:<port>, got " + std::string(devicename))};
+    }
+    auto host = devicename.substr(scheme_end + 1, port_start - scheme_end - 1);
+    if (host.size() >= 2 && host.front() == '[' && host.back() == ']') {
+        host = host.substr(1, host.size() - 2);
+    }
+    return SocketEndpoint{std::string(devicename.substr(0, scheme_end)), std::string(host),
+                          std::string(devicename.substr(port_start + 1))};
+}
+
+/// @brief Resolves the host and port of an endpoint.
+/// @param[in] endpoint The endpoint.
+/// @param[in] socktype SOCK_DGRAM or SOCK_STREAM.
+/// @param[in] passive true for an address to bind to, false for one to connect or send to.
+/// @return The first address found,
+///         EINVAL and the resolver's message via std::unexpected if it could not be resolved
+[[nodiscard]] inline auto resolve(const SocketEndpoint& endpoint, int socktype, bool passive)
+    -> std::expected<SocketAddress, std::pair<int, std::string>> {
+    auto hints = addrinfo{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = socktype;
+    hints.ai_flags = passive ? AI_PASSIVE : 0;
+    addrinfo* found = nullptr;
+    auto result = ::getaddrinfo(endpoint.host.empty() ? nullptr : endpoint.host.c_str(), endpoint.port.c_str(),
+                                &hints, &found);
+    if (result != 0 || found == nullptr) {
+        return std::unexpected<std::pair<int, std::string>>{std::make_pair(EINVAL, ::gai_strerror(result))};
+    }
+    auto address = SocketAddress{};
+    std::memcpy(&address.address, found->ai_addr, found->ai_addrlen);
+    address.length = found->ai_addrlen;
+    ::freeaddrinfo(found);
+    return address;
+}
+
+/// @brief Waits until a socket is readable.
+/// @param[in] handle The socket.
+/// @param[in] timeout How long to wait; 0 to only check.
+/// @return true if the socket is readable, false if the timeout passed,
+///         error code and string via std::unexpected if polling failed
+[[nodiscard]] inline auto wait_readable(int handle, std::chrono::milliseconds timeout)
+    -> std::expected<bool, std::pair<int, std::string>> {
+    auto request = pollfd{handle, POLLIN, 0};
+    auto result = ::poll(&request, 1, static_cast<int>(timeout.count()));
+    if (result < 0) {
+        return errno == EINTR ? std::expected<bool, std::pair<int, std::string>>{false} : errno_error();
+    }
+    return result > 0;
+}
+
+/// @brief Local port a socket is bound to.
+/// @return The port, or 0 if the socket is not bound.
+[[nodiscard]] inline auto local_port(int handle) noexcept -> std::uint16_t {
+    auto address = sockaddr_storage{};
+    auto length = socklen_t{sizeof(address)};
+    if (handle < 0 || ::getsockname(handle, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+        return 0;
+    }
+    if (address.ss_family == AF_INET6) {
+        return ntohs(reinterpret_cast<const sockaddr_in6*>(&address)->sin6_port);
+    }
+    return ntohs(reinterpret_cast<const sockaddr_in*>(&address)->sin_port);
+}
+
+}  // namespace detail
+
+}  // namespace uart
@@ -0,0 +1,190 @@
+#include "posixtcp.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "posixsocket.hpp"
+
+namespace uart {
+
+namespace {
+
+// MSG_NOSIGNAL is Linux and the BSDs; macOS has the SO_NOSIGPIPE socket option instead
+#ifdef MSG_NOSIGNAL
+constexpr int SendFlags = MSG_NOSIGNAL;
+#else
+constexpr int SendFlags = 0;
+#endif
+
+// keeps the socket out of child processes and, without MSG_NOSIGNAL, writes to a closed connection from raising SIGPIPE
+void set_socket_options(int handle) {
+    ::fcntl(handle, F_SETFD, FD_CLOEXEC);
+#ifdef SO_NOSIGPIPE
+    auto nosigpipe = 1;
+    ::setsockopt(handle, SOL_SOCKET, SO_NOSIGPIPE, &nosigpipe, sizeof(nosigpipe));
+#endif
+}
+
+// frames are small and latency matters more than segment count
+void set_nodelay(int handle) {
+    auto nodelay = 1;
+    ::setsockopt(handle, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+}
+
+}  // namespace
+
+auto PosixTCP::open() -> std::expected<bool, std::pair<int, std::string>> {
+    if (isopen_) {
+        close();
+    }
+    auto endpoint = detail::parse_endpoint(devicename_);
+    if (!endpoint) {
+        return std::unexpected(endpoint.error());
+    }
+    if (endpoint->scheme != "tcp" && endpoint->scheme != "tcpin") {
+        return std::unexpected<std::pair<int, std::string>>{
+            std::make_pair(EINVAL, "Expected tcp or tcpin, got " + endpoint->scheme)};
+    }
+    auto listening = endpoint->scheme == "tcpin";
+    auto address = detail::resolve(*endpoint, SOCK_STREAM, listening);
+    if (!address) {
+        return std::unexpected(address.error());
+    }
+
+    auto handle = ::socket(address->address.ss_family, SOCK_STREAM, 0);
+    if (handle < 0) {
+        return detail::errno_error();
+    }
+    set_socket_options(handle);
+    const auto* sockaddress = reinterpret_cast<const sockaddr*>(&address->address);
+    if (listening) {
+        auto reuse = 1;
+        ::setsockopt(handle, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        if (::bind(handle, sockaddress, address->length) != 0 || ::listen(handle, 1) != 0) {
+            auto error = detail::errno_error();
+            ::close(handle);
+            return error;
+        }
+        listenerhandle_ = handle;
+    } else {
+        if (::connect(handle, sockaddress, address->length) != 0) {
+            auto error = detail::errno_error();
+            ::close(handle);
+            return error;
+        }
+        set_nodelay(handle);
+        connectionhandle_ = handle;
+    }
+    isopen_ = true;
+    return true;
+}
+
+void PosixTCP::close() {
+    if (isopen_) {
+        disconnect();
+        if (listenerhandle_ >= 0) {
+            ::close(listenerhandle_);
+            listenerhandle_ = -1;
+        }
+        isopen_ = false;
+    }
+}
+
+void PosixTCP::disconnect() {
+    if (connectionhandle_ >= 0) {
+        ::close(connectionhandle_);
+        connectionhandle_ = -1;
+    }
+}
+
+auto PosixTCP::accept(std::chrono::milliseconds timeout) -> std::expected<bool, std::pair<int, std::string>> {
+    if (connectionhandle_ >= 0 || listenerhandle_ < 0) {
+        return connectionhandle_ >= 0;
+    }
+    auto ready = detail::wait_readable(listenerhandle_, timeout);
+    if (!ready || !*ready) {
+        return ready;
+    }
+    auto handle = ::accept(listenerhandle_, nullptr, nullptr);
+    if (handle < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ECONNABORTED || errno == EINTR) {
+            return false;
+        }
+        return detail::errno_error();
+    }
+    set_socket_options(handle);
+    set_nodelay(handle);
+    connectionhandle_ = handle;
+    return true;
+}
+
+auto PosixTCP::read_bytes(std::span<std::byte> buffer) -> std::expected<std::size_t, std::pair<int, std::string>> {
+    if (!isopen_) {
+        return std::unexpected<std::pair<int, std::string>>{std::make_pair(EBADF, std::strerror(EBADF))};
+    }
+    auto start = std::chrono::steady_clock::now();
+    auto connected = accept(timeout_);
+    if (!connected) {
+        return std::unexpected(connected.error());
+    }
+    if (!*connected) {
+        return 0;
+    }
+    auto remaining = std::max(timeout_ - std::chrono::duration_cast<std::chrono::milliseconds>(
+                                             std::chrono::steady_clock::now() - start),
+                              std::chrono::milliseconds{0});
+    auto ready = detail::wait_readable(connectionhandle_, remaining);
+    if (!ready) {
+        return std::unexpected(ready.error());
+    }
+    if (!*ready) {
+        return 0;
+    }
+    auto result = ::recv(connectionhandle_, buffer.data(), buffer.size(), MSG_DONTWAIT);
+    if (result < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+            return 0;
+        }
+        auto error = detail::errno_error();
+        disconnect();
+        return error;
+    }
+    if (result == 0 && !buffer.empty()) {
+        // orderly shutdown by the peer: a "tcpin" server goes back to waiting for the next client
+        disconnect();
+        if (listenerhandle_ >= 0) {
+            return 0;
+        }
+        return std::unexpected<std::pair<int, std::string>>{std::make_pair(ECONNRESET, "Connection closed by peer")};
+    }
+    return static_cast<std::size_t>(result);
+}
+
+auto PosixTCP::write_bytes(std::span<const std::byte> buffer)
+    -> std::expected<std::size_t, std::pair<int, std::string>> {
+    if (!isopen_) {
+        return std::unexpected<std::pair<int, std::string>>{std::make_pair(EBADF, std::strerror(EBADF))};
+    }
+    auto connected = accept(std::chrono::milliseconds{0});
+    if (!connected) {
+        return std::unexpected(connected.error());
+    }
+    if (!*connected) {
+        return std::unexpected<std::pair<int, std::string>>{std::make_pair(ENOTCONN, "No client connected")};
+    }
+    auto result = ::send(connectionhandle_, buffer.data(), buffer.size(), SendFlags);
+    if (result < 0) {
+        auto error = detail::errno_error();
+        disconnect();
+        return error;
+    }
+    return static_cast<std::size_t>(result);
+}
+
+}  // namespace uart
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "posixsocket.hpp"
+
+namespace uart {
+
+/// @brief MAVLink over TCP, with the read/write interface of PosixUART so that it plugs into UART<PosixTCP>.
+/// @note "tcp:<host>:<port>" connects to the address, e.g. to SITL's console port; "tcpin:<host>:<port>" listens on it
+///       and serves one client at a time, accepting it on the first read or write after it connects and returning to
+///       listening once it disconnects.
+class PosixTCP {
+   public:
+    using native_handle_type = int;
+
+    PosixTCP(std::string_view devicename) noexcept : devicename_(devicename) {}
+    ~PosixTCP() { close(); }
+    PosixTCP(const PosixTCP&) = delete;
+    PosixTCP(PosixTCP&&) = delete;
+    auto operator=(const PosixTCP&) = delete;
+    auto operator=(PosixTCP&&) = delete;
+
+    /// @return OS-native handle to the connected socket, -1 while "tcpin" waits for a client
+    [[nodiscard]] auto native_handle() const noexcept -> native_handle_type { return connectionhandle_; }
+
+    [[nodiscard]] auto devicename() const noexcept -> std::string_view { return devicename_; }
+
+    /// @return Local port, e.g. the one picked for "tcpin:127.0.0.1:0"; 0 if closed
+    [[nodiscard]] auto port() const noexcept -> std::uint16_t {
+        return detail::local_port(listenerhandle_ >= 0 ? listenerhandle_ : connectionhandle_);
+    }
+
+    /// @return true while there is a connected peer
+    [[nodiscard]] auto is_connected() const noexcept -> bool { return connectionhandle_ >= 0; }
+
+    [[nodiscard]] auto timeout() const noexcept -> std::chrono::milliseconds { return timeout_; }
+
+    /// @brief How long a read waits for data (or for a client, with "tcpin"); 0 returns immediately.
+    auto set_timeout(std::chrono::milliseconds timeout_ms) -> std::expected<bool, std::pair<int, std::string>> {
+        timeout_ = std::max(timeout_ms, std::chrono::milliseconds{0});
+        return true;
+    }
+
+    /// @brief Will close the socket if already open
+    /// @return true if the socket is successfully connected or listening,
+    ///         error code and string via std::unexpected if the device name is malformed or opening failed
+    [[nodiscard]] auto open() -> std::expected<bool, std::pair<int, std::string>>;
+
+    [[nodiscard]] auto is_open() const noexcept -> bool { return isopen_; }
+
+    void close();
+
+    /// @param buffer [out] range type into which read data will be stored
+    /// @param readsize maximum number of bytes to return (also limited by buffer size)
+    /// @return number of bytes read into buffer if successful, 0 if nothing arrived within the timeout,
+    ///         error code and string via std::unexpected if read failed or a "tcp" peer closed the connection
+    [[nodiscard]] auto read(std::ranges::sized_range auto& buffer, std::size_t readsize)
+        -> std::expected<std::size_t, std::pair<int, std::string>> {
+        auto count = std::min(std::ranges::size(buffer), readsize);
+        return read_bytes(std::as_writable_bytes(std::span(std::ranges::data(buffer), count)));
+    }
+
+    /// @param buffer range type with data to be written
+    /// @return number of bytes written if successful,
+    ///         error code and string via std::unexpected if write failed or there is no client
+    [[nodiscard]] auto write(const std::ranges::sized_range auto& buffer)
+        -> std::expected<std::size_t, std::pair<int, std::string>> {
+        return write_bytes(std::as_bytes(std::span(std::ranges::cdata(buffer), std::ranges::size(buffer))));
+    }
+
+   private:
+    int listenerhandle_{-1};
+    int connectionhandle_{-1};
+    const std::string devicename_;
+    std::chrono::milliseconds timeout_{0};
+    bool isopen_{false};
+
+    auto read_bytes(std::span<std::byte> buffer) -> std::expected<std::size_t, std::pair<int, std::string>>;
+    auto write_bytes(std::span<const std::byte> buffer) -> std::expected<std::size_t, std::pair<int, std::string>>;
+
+    /// @brief Accepts a waiting client if listening and not connected.
+    /// @return true if connected afterwards
+    auto accept(std::chrono::milliseconds timeout) -> std::expected<bool, std::pair<int, std::string>>;
+
+    void disconnect();
+};
+
+}  // namespace uart
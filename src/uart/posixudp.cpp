@@ -0,0 +1,179 @@
+#include "posixudp.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "posixsocket.hpp"
+
+namespace uart {
+
+namespace {
+
+// large enough to absorb a burst while the reader is busy with the previous batch
+constexpr int ReceiveBufferSize = 1 << 20;
+
+}  // namespace
+
+auto PosixUDP::open() -> std::expected<bool, std::pair<int, std::string>> {
+    if (isopen_) {
+        close();
+    }
+    auto endpoint = detail::parse_endpoint(devicename_);
+    if (!endpoint) {
+        return std::unexpected(endpoint.error());
+    }
+    if (endpoint->scheme != "udpin" && endpoint->scheme != "udpout") {
+        return std::unexpected<std::pair<int, std::string>>{
+            std::make_pair(EINVAL, "Expected udpin or udpout, got " + endpoint->scheme)};
+    }
+    listening_ = endpoint->scheme == "udpin";
+    auto address = detail::resolve(*endpoint, SOCK_DGRAM, listening_);
+    if (!address) {
+        return std::unexpected(address.error());
+    }
+
+    sockethandle_ = ::socket(address->address.ss_family, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (sockethandle_ < 0) {
+        return detail::errno_error();
+    }
+    auto size = ReceiveBufferSize;
+    ::setsockopt(sockethandle_, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+    if (listening_) {
+        auto reuse = 1;
+        ::setsockopt(sockethandle_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        if (::bind(sockethandle_, reinterpret_cast<const sockaddr*>(&address->address), address->length) != 0) {
+            auto error = detail::errno_error();
+            ::close(sockethandle_);
+            sockethandle_ = -1;
+            return error;
+        }
+        peer_ = SocketAddress{};
+    } else {
+        peer_ = *address;
+    }
+
+    datagrams_.resize(UdpBatchSize * UdpDatagramSize);
+    received_ = current_ = offset_ = 0;
+    isopen_ = true;
+    return true;
+}
+
+void PosixUDP::close() {
+    if (isopen_) {
+        ::close(sockethandle_);
+        sockethandle_ = -1;
+        isopen_ = false;
+        peer_ = SocketAddress{};
+        received_ = current_ = offset_ = 0;
+    }
+}
+
+auto PosixUDP::read_bytes(std::span<std::byte> buffer) -> std::expected<std::size_t, std::pair<int, std::string>> {
+    if (!isopen_) {
+        return std::unexpected<std::pair<int, std::string>>{std::make_pair(EBADF, std::strerror(EBADF))};
+    }
+    if (current_ == received_) {
+        auto fetched = receive();
+        if (!fetched || *fetched == 0) {
+            return fetched;
+        }
+    }
+    // hand out as much of the batch as fits; the framers treat the datagrams as one byte stream
+    auto copied = std::size_t{0};
+    while (copied < buffer.size() && current_ < received_) {
+        auto datagram =
+            std::span(datagrams_).subspan(current_ * UdpDatagramSize + offset_, lengths_[current_] - offset_);
+        auto count = std::min(datagram.size(), buffer.size() - copied);
+        std::memcpy(buffer.data() + copied, datagram.data(), count);
+        copied += count;
+        offset_ += count;
+        if (offset_ == lengths_[current_]) {
+            ++current_;
+            offset_ = 0;
+        }
+    }
+    return copied;
+}
+
+auto PosixUDP::receive() -> std::expected<std::size_t, std::pair<int, std::string>> {
+    received_ = current_ = offset_ = 0;
+    auto ready = detail::wait_readable(sockethandle_, timeout_);
+    if (!ready) {
+        return std::unexpected(ready.error());
+    }
+    if (!*ready) {
+        return 0;
+    }
+
+    auto messages = std::array<mmsghdr, UdpBatchSize>{};
+    auto vectors = std::array<iovec, UdpBatchSize>{};
+    auto senders = std::array<sockaddr_storage, UdpBatchSize>{};
+    for (auto slot = std::size_t{0}; slot < UdpBatchSize; ++slot) {
+        vectors[slot] = iovec{datagrams_.data() + slot * UdpDatagramSize, UdpDatagramSize};
+        messages[slot].msg_hdr.msg_iov = &vectors[slot];
+        messages[slot].msg_hdr.msg_iovlen = 1;
+        messages[slot].msg_hdr.msg_name = &senders[slot];
+        messages[slot].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+    }
+    auto result = ::recvmmsg(sockethandle_, messages.data(), UdpBatchSize, MSG_DONTWAIT, nullptr);
+    if (result < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+            return 0;
+        }
+        return detail::errno_error();
+    }
+    received_ = static_cast<std::size_t>(result);
+    for (auto slot = std::size_t{0}; slot < received_; ++slot) {
+        lengths_[slot] = std::min<std::size_t>(messages[slot].msg_len, UdpDatagramSize);
+    }
+    if (listening_ && received_ > 0) {
+        std::memcpy(&peer_.address, &senders[received_ - 1], sizeof(sockaddr_storage));
+        peer_.length = messages[received_ - 1].msg_hdr.msg_namelen;
+    }
+    return received_;
+}
+
+auto PosixUDP::write_datagrams(std::span<const std::span<const std::byte>> datagrams)
+    -> std::expected<std::size_t, std::pair<int, std::string>> {
+    if (!isopen_) {
+        return std::unexpected<std::pair<int, std::string>>{std::make_pair(EBADF, std::strerror(EBADF))};
+    }
+    if (!has_peer()) {
+        return std::unexpected<std::pair<int, std::string>>{std::make_pair(EDESTADDRREQ, "No datagram received yet")};
+    }
+    auto messages = std::array<mmsghdr, UdpBatchSize>{};
+    auto vectors = std::array<iovec, UdpBatchSize>{};
+    auto sent = std::size_t{0};
+    while (sent < datagrams.size()) {
+        auto batch = std::min(datagrams.size() - sent, UdpBatchSize);
+        for (auto slot = std::size_t{0}; slot < batch; ++slot) {
+            const auto& datagram = datagrams[sent + slot];
+            vectors[slot] = iovec{const_cast<std::byte*>(datagram.data()), datagram.size()};
+            messages[slot].msg_hdr = msghdr{};
+            messages[slot].msg_hdr.msg_iov = &vectors[slot];
+            messages[slot].msg_hdr.msg_iovlen = 1;
+            messages[slot].msg_hdr.msg_name = &peer_.address;
+            messages[slot].msg_hdr.msg_namelen = peer_.length;
+        }
+        auto result = ::sendmmsg(sockethandle_, messages.data(), static_cast<unsigned int>(batch), 0);
+        if (result < 0) {
+            if (sent > 0) {
+                break;
+            }
+            return detail::errno_error();
+        }
+        sent += static_cast<std::size_t>(result);
+        if (static_cast<std::size_t>(result) < batch) {
+            break;
+        }
+    }
+    return sent;
+}
+
+}  // namespace uart
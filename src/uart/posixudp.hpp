@@ -0,0 +1,123 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <sys/socket.h>
+
+#include "posixsocket.hpp"
+
+namespace uart {
+
+/// @brief Datagrams fetched by one recvmmsg, or sent by one sendmmsg.
+inline constexpr std::size_t UdpBatchSize = 32;
+
+/// @brief Largest datagram received; bigger ones are truncated. MAVLink 2 frames are at most 280 bytes.
+inline constexpr std::size_t UdpDatagramSize = 2048;
+
+/// @brief MAVLink over UDP, with the read/write interface of PosixUART so that it plugs into UART<PosixUDP>.
+/// @note "udpin:<host>:<port>" binds to the address and sends to whoever sent the latest datagram, as a ground station
+///       does; "udpout:<host>:<port>" sends to the address, as a vehicle does. Reads drain a batch of datagrams fetched
+///       with a single recvmmsg, so a busy link costs one system call per UdpBatchSize datagrams rather than one per
+///       datagram; write_datagrams() batches the other way with sendmmsg.
+class PosixUDP {
+   public:
+    using native_handle_type = int;
+
+    PosixUDP(std::string_view devicename) noexcept : devicename_(devicename) {}
+    ~PosixUDP() { close(); }
+    PosixUDP(const PosixUDP&) = delete;
+    PosixUDP(PosixUDP&&) = delete;
+    auto operator=(const PosixUDP&) = delete;
+    auto operator=(PosixUDP&&) = delete;
+
+    /// @return OS-native handle to the underlying socket
+    [[nodiscard]] auto native_handle() const noexcept -> native_handle_type { return sockethandle_; }
+
+    [[nodiscard]] auto devicename() const noexcept -> std::string_view { return devicename_; }
+
+    /// @return Local port of the socket, e.g. the one picked for "udpin:127.0.0.1:0"; 0 if closed
+    [[nodiscard]] auto port() const noexcept -> std::uint16_t { return detail::local_port(sockethandle_); }
+
+    /// @return true once there is an address to send to: always for "udpout", after the first datagram for "udpin"
+    [[nodiscard]] auto has_peer() const noexcept -> bool { return peer_.length != 0; }
+
+    [[nodiscard]] auto timeout() const noexcept -> std::chrono::milliseconds { return timeout_; }
+
+    /// @brief How long a read waits for a datagram; 0 returns immediately.
+    auto set_timeout(std::chrono::milliseconds timeout_ms) -> std::expected<bool, std::pair<int, std::string>> {
+        timeout_ = std::max(timeout_ms, std::chrono::milliseconds{0});
+        return true;
+    }
+
+    /// @brief Will close the socket if already open
+    /// @return true if the socket is successfully opened and bound or connected,
+    ///         error code and string via std::unexpected if the device name is malformed or opening failed
+    [[nodiscard]] auto open() -> std::expected<bool, std::pair<int, std::string>>;
+
+    [[nodiscard]] auto is_open() const noexcept -> bool { return isopen_; }
+
+    void close();
+
+    /// @param buffer [out] range type into which read data will be stored
+    /// @param readsize maximum number of bytes to return (also limited by buffer size)
+    /// @return number of bytes read into buffer if successful, 0 if no datagram arrived within the timeout,
+    ///         error code and string via std::unexpected if read failed
+    /// @note Bytes are returned in datagram order; a datagram larger than the buffer is returned over several reads.
+    [[nodiscard]] auto read(std::ranges::sized_range auto& buffer, std::size_t readsize)
+        -> std::expected<std::size_t, std::pair<int, std::string>> {
+        auto count = std::min(std::ranges::size(buffer), readsize);
+        return read_bytes(std::as_writable_bytes(std::span(std::ranges::data(buffer), count)));
+    }
+
+    /// @param buffer range type with data to be written, sent as one datagram
+    /// @return number of bytes written if successful,
+    ///         error code and string via std::unexpected if write failed or there is no peer yet
+    [[nodiscard]] auto write(const std::ranges::sized_range auto& buffer)
+        -> std::expected<std::size_t, std::pair<int, std::string>> {
+        auto datagram = std::as_bytes(std::span(std::ranges::cdata(buffer), std::ranges::size(buffer)));
+        auto sent = write_datagrams(std::span(&datagram, 1));
+        if (!sent) {
+            return std::unexpected(sent.error());
+        }
+        return *sent == 1 ? datagram.size() : 0;
+    }
+
+    /// @brief Sends each buffer as its own datagram, UdpBatchSize per system call.
+    /// @param datagrams The datagrams to send.
+    /// @return number of datagrams sent if successful,
+    ///         error code and string via std::unexpected if nothing could be sent or there is no peer yet
+    [[nodiscard]] auto write_datagrams(std::span<const std::span<const std::byte>> datagrams)
+        -> std::expected<std::size_t, std::pair<int, std::string>>;
+
+   private:
+    int sockethandle_{-1};
+    const std::string devicename_;
+    std::chrono::milliseconds timeout_{0};
+    bool isopen_{false};
+    bool listening_{false};
+    SocketAddress peer_{};
+
+    std::vector<std::byte> datagrams_;
+    std::array<std::size_t, UdpBatchSize> lengths_{};
+    std::size_t received_{0};
+    std::size_t current_{0};
+    std::size_t offset_{0};
+
+    auto read_bytes(std::span<std::byte> buffer) -> std::expected<std::size_t, std::pair<int, std::string>>;
+
+    /// @brief Fetches the next batch of datagrams once the last one is drained.
+    /// @return number of datagrams fetched, 0 if none arrived within the timeout
+    auto receive() -> std::expected<std::size_t, std::pair<int, std::string>>;
+};
+
+}  // namespace uart
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace uart {
 
 enum class BaudRate {
@@ -40,4 +42,81 @@ enum class Parity { none = 0, even, odd, mark, space };
 
 enum class StopBits { sb1 = 0, sb1_5, sb2 };
 
+/// @return the line rate of a baud rate setting in bits per second
+[[nodiscard]] constexpr auto bits_per_second(BaudRate baud) noexcept -> std::uint32_t {
+    switch (baud) {
+        case BaudRate::b0:
+            return 0;
+        case BaudRate::b50:
+            return 50;
+        case BaudRate::b75:
+            return 75;
+        case BaudRate::b110:
+            return 110;
+        case BaudRate::b134:
+            return 134;
+        case BaudRate::b150:
+            return 150;
+        case BaudRate::b200:
+            return 200;
+        case BaudRate::b300:
+            return 300;
+        case BaudRate::b600:
+            return 600;
+        case BaudRate::b1200:
+            return 1'200;
+        case BaudRate::b1800:
+            return 1'800;
+        case BaudRate::b2400:
+            return 2'400;
+        case BaudRate::b4800:
+            return 4'800;
+        case BaudRate::b9600:
+            return 9'600;
+        case BaudRate::b14400:
+            return 14'400;
+        case BaudRate::b19200:
+            return 19'200;
+        case BaudRate::b38400:
+            return 38'400;
+        case BaudRate::b56000:
+            return 56'000;
+        case BaudRate::b57600:
+            return 57'600;
+        case BaudRate::b115200:
+            return 115'200;
+        case BaudRate::b128000:
+            return 128'000;
+        case BaudRate::b230400:
+            return 230'400;
+        case BaudRate::b256000:
+            return 256'000;
+        case BaudRate::b460800:
+            return 460'800;
+        case BaudRate::b921600:
+            return 921'600;
+        case BaudRate::b1000000:
+            return 1'000'000;
+        case BaudRate::b2000000:
+            return 2'000'000;
+        case BaudRate::b3000000:
+            return 3'000'000;
+        case BaudRate::b4000000:
+            return 4'000'000;
+    }
+    return 0;
+}
+
+/// @return the number of bit periods one character occupies on the line, in halves of a bit (for 1.5 stop bits):
+///         start bit, data bits, parity bit and stop bits
+[[nodiscard]] constexpr auto half_bits_per_character(CharacterSize charsize,
+                                                     Parity parity = Parity::none,
+                                                     StopBits stopbits = StopBits::sb1) noexcept -> std::uint32_t {
+    constexpr std::uint32_t databits[] = {5, 6, 7, 8, 16};
+    auto bits = 2 * (1 + databits[static_cast<int>(charsize)]);
+    bits += (parity == Parity::none) ? 0 : 2;
+    bits += (stopbits == StopBits::sb1) ? 2 : (stopbits == StopBits::sb1_5) ? 3 : 4;
+    return bits;
+}
+
 }  // namespace uart
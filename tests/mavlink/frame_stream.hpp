@@ -0,0 +1,18 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mavlink/serializer.hpp"
+
+/// @brief Appends a message, serialized from system 1, component 1, to a byte stream.
+template <typename MessageT>
+void append_frame(std::vector<std::uint8_t>& stream, const MessageT& message, std::uint8_t seq) {
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto len = mavlink::serialize(message, 1, 1, seq, buffer);
+    REQUIRE(len.has_value());
+    stream.insert(stream.end(), buffer.begin(), buffer.begin() + *len);
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <filesystem>
+#include <initializer_list>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <unistd.h>
+
+/// @brief A file path in the temporary directory, unique to the process and the test, removed along with its sidecar
+///        files (the path with a suffix appended, e.g. a tlog's ".idx") before and at the end of the test.
+struct TemporaryFile {
+    std::filesystem::path path;
+    std::vector<std::filesystem::path> sidecars;
+
+    /// @brief Constructor.
+    /// @param[in] extension Extension of the file, e.g. ".tlog".
+    /// @param[in] sidecar_suffixes Suffixes appended to the path to name the sidecar files.
+    explicit TemporaryFile(std::string_view extension, std::initializer_list<std::string_view> sidecar_suffixes = {})
+        : path(std::filesystem::temp_directory_path() /
+               ("avionicpp_test_" + std::to_string(::getpid()) + "_" + std::to_string(std::random_device{}()) +
+                std::string(extension))) {
+        for (auto suffix : sidecar_suffixes) {
+            sidecars.emplace_back(path.string() + std::string(suffix));
+        }
+        remove();
+    }
+    ~TemporaryFile() { remove(); }
+    TemporaryFile(const TemporaryFile&) = delete;
+    TemporaryFile(TemporaryFile&&) = delete;
+    auto operator=(const TemporaryFile&) = delete;
+    auto operator=(TemporaryFile&&) = delete;
+
+    void remove() const {
+        std::filesystem::remove(path);
+        for (const auto& sidecar : sidecars) {
+            std::filesystem::remove(sidecar);
+        }
+    }
+};
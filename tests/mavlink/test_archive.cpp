@@ -0,0 +1,238 @@
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mavlink/archive.hpp"
+#include "mavlink/columns.hpp"
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/global_position_int.hpp"
+#include "mavlink/payloads/heartbeat.hpp"
+#include "mavlink/payloads/param_value.hpp"
+#include "mavlink/serializer.hpp"
+#include "temporary_file.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+/// @brief A simulated flight: frames of slowly changing ATTITUDE and GLOBAL_POSITION_INT at 10 Hz and a HEARTBEAT at
+///        1 Hz from two systems, back to back, with the views over them.
+struct Flight {
+    std::vector<std::uint8_t> stream;
+    std::vector<MessageView> views;
+    std::vector<std::uint64_t> timestamps;
+
+    explicit Flight(std::uint32_t ticks) {
+        auto rng = std::mt19937{3};
+        auto noise = std::normal_distribution<float>{0.0f, 0.001f};
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto offsets = std::vector<std::size_t>{};
+        auto append = [&](auto length, std::uint64_t timestamp) {
+            offsets.push_back(stream.size());
+            stream.insert(stream.end(), buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(*length));
+            timestamps.push_back(timestamp);
+        };
+        for (auto tick : std::views::iota(0U, ticks)) {
+            auto timestamp = std::uint64_t{1'700'000'000'000'000} + tick * 100'000ULL;
+            for (auto sysid : {std::uint8_t{1}, std::uint8_t{2}}) {
+                auto att = Attitude{};
+                att.time_boot_ms.value = tick * 100;
+                att.roll.value = 0.1f * std::sin(static_cast<float>(tick) / 50.0f) + noise(rng);
+                att.pitch.value = 0.05f;
+                att.yaw.value = static_cast<float>(tick) / 1000.0f;
+                append(serialize(att, sysid, 1, 0, buffer), timestamp);
+
+                auto pos = GlobalPositionInt{};
+                pos.time_boot_ms.value = tick * 100;
+                pos.lat.value = 473'977'420 + static_cast<std::int32_t>(tick);
+                pos.lon.value = 85'455'940 - static_cast<std::int32_t>(tick / 3);
+                pos.alt.value = 500'000;
+                pos.hdg.value = static_cast<std::uint16_t>(9000 + tick % 7);
+                append(serialize(pos, sysid, 1, 0, buffer), timestamp + 10);
+
+                if (tick % 10 == 0) {
+                    auto heartbeat = Heartbeat{};
+                    heartbeat.type.value = 2;
+                    heartbeat.system_status.value = tick < ticks / 2 ? 3 : 4;
+                    append(serialize(heartbeat, sysid, static_cast<std::uint8_t>(tick % 20 == 0 ? 1 : 191), 0, buffer),
+                           timestamp + 20);
+                }
+            }
+        }
+        for (auto offset : offsets) {
+            auto frame = std::span<const std::uint8_t>(stream).subspan(offset);
+            views.push_back(parse_frame(frame.first(*frame_length(frame))));
+        }
+    }
+};
+
+}  // namespace
+
+SCENARIO("Mavlink archive columns", "[mavlink][archive]") {
+    GIVEN("Columns of every element type with random, constant and slowly changing values") {
+        auto rng = std::mt19937{5};
+        auto check = [&]<typename E>(E, std::size_t width) {
+            auto elements = std::vector<E>(120 * width);
+            for (auto element : std::views::iota(std::size_t{0}, elements.size())) {
+                if constexpr (std::is_floating_point_v<E>) {
+                    elements[element] = element < 40 * width ? static_cast<E>(rng()) / 3 : E{1.5};
+                } else {
+                    elements[element] =
+                        element < 40 * width ? static_cast<E>(rng()) : static_cast<E>(element / width / 7);
+                }
+            }
+            elements.back() = std::numeric_limits<E>::lowest();
+            for (auto encoding :
+                 {ArchiveEncoding::Delta, ArchiveEncoding::DeltaRuns, ArchiveEncoding::Xor, ArchiveEncoding::XorRuns}) {
+                auto encoded = encode_archive_column(std::span<const E>(elements), width, encoding);
+                auto decoded = std::vector<E>(elements.size());
+                CHECK(decode_archive_column(std::span<const std::uint8_t>(encoded), width, encoding,
+                                            std::span<E>(decoded)));
+                CHECK(decoded == elements);
+                CHECK_FALSE(decode_archive_column(std::span<const std::uint8_t>(encoded), width, encoding,
+                                                  std::span<E>(decoded).first(decoded.size() - width)));
+                encoded.pop_back();
+                CHECK_FALSE(decode_archive_column(std::span<const std::uint8_t>(encoded), width, encoding,
+                                                  std::span<E>(decoded)));
+            }
+        };
+
+        THEN("every encoding decodes to the elements it encoded, and only from the whole column") {
+            check(std::int8_t{}, 1);
+            check(std::uint16_t{}, 3);
+            check(std::int32_t{}, 1);
+            check(std::uint64_t{}, 2);
+            check(float{}, 1);
+            check(double{}, 4);
+            check(char{}, 16);
+        }
+    }
+
+    GIVEN("A column that hardly changes") {
+        auto elements = std::vector<std::uint32_t>(1000, 42);
+        elements[500] = 43;
+
+        THEN("the run encodings store it in a few bytes") {
+            auto [encoding, encoded] = encode_archive_column(std::span<const std::uint32_t>(elements), 1);
+            CHECK(encoding == ArchiveEncoding::DeltaRuns);
+            CHECK(encoded.size() < 16);
+        }
+    }
+}
+
+SCENARIO("Mavlink archive reading and writing", "[mavlink][archive]") {
+    GIVEN("An archive of a simulated flight from two systems") {
+        auto flight = Flight{600};
+        auto archive = TemporaryFile{".mavarch"};
+        auto writer = ArchiveWriter<Attitude, GlobalPositionInt, Heartbeat>{};
+        for (auto message : std::views::iota(std::size_t{0}, flight.views.size())) {
+            REQUIRE(writer.add(flight.views[message], flight.timestamps[message]));
+        }
+        auto written = writer.write(archive.path.string());
+        REQUIRE(written.has_value());
+
+        auto reader = ArchiveReader{archive.path.string()};
+        REQUIRE(reader.open().has_value());
+
+        THEN("there is a table per msgid and sysid") {
+            CHECK(reader.tables().size() == 6);
+            REQUIRE(reader.find_table(Heartbeat::MessageId, 2) != nullptr);
+            CHECK(reader.find_table(Heartbeat::MessageId, 2)->rows == 60);
+            CHECK(reader.find_table(Attitude::MessageId, 3) == nullptr);
+        }
+
+        THEN("every field reads back as the columns decoded from the frames") {
+            for (auto sysid : {std::uint8_t{1}, std::uint8_t{2}}) {
+                auto of_system = flight.views | std::views::filter([&](const MessageView& view) {
+                                     return view.sysid == sysid;
+                                 });
+                auto attitudes = reader.read<Attitude>(*reader.find_table(Attitude::MessageId, sysid));
+                auto expected_attitudes = decode_columns<Attitude>(of_system);
+                REQUIRE(attitudes.has_value());
+                CHECK(attitudes->time_boot_ms.values == expected_attitudes.time_boot_ms.values);
+                CHECK(attitudes->roll.values == expected_attitudes.roll.values);
+                CHECK(attitudes->pitch.values == expected_attitudes.pitch.values);
+                CHECK(attitudes->yaw.values == expected_attitudes.yaw.values);
+
+                auto positions =
+                    reader.read<GlobalPositionInt>(*reader.find_table(GlobalPositionInt::MessageId, sysid));
+                auto expected_positions = decode_columns<GlobalPositionInt>(of_system);
+                REQUIRE(positions.has_value());
+                CHECK(positions->lat.values == expected_positions.lat.values);
+                CHECK(positions->lon.values == expected_positions.lon.values);
+                CHECK(positions->hdg.values == expected_positions.hdg.values);
+
+                auto heartbeats = reader.read<Heartbeat>(*reader.find_table(Heartbeat::MessageId, sysid));
+                REQUIRE(heartbeats.has_value());
+                CHECK(heartbeats->system_status.values ==
+                      decode_columns<Heartbeat>(of_system).system_status.values);
+            }
+        }
+
+        THEN("timestamps and compids are kept per message") {
+            const auto& table = *reader.find_table(Heartbeat::MessageId, 1);
+            auto timestamps = reader.timestamps(table);
+            auto compids = reader.compids(table);
+            REQUIRE(timestamps.has_value());
+            REQUIRE(compids.has_value());
+            CHECK(timestamps->at(1) == 1'700'000'000'000'000 + 1'000'000 + 20);
+            CHECK(compids->at(0) == 1);
+            CHECK(compids->at(1) == 191);
+        }
+
+        THEN("one field is read without the others") {
+            auto lat = reader.field<GlobalPositionInt, 1>(*reader.find_table(GlobalPositionInt::MessageId, 1));
+            REQUIRE(lat.has_value());
+            CHECK(lat->size() == 600);
+            CHECK(lat->back() == 473'977'420 + 599);
+            CHECK(reader.field<Attitude, 1>(*reader.find_table(GlobalPositionInt::MessageId, 1)).error() ==
+                  MavlinkError::ProtocolViolation);
+        }
+
+        THEN("a table whose row count does not match its columns is rejected before anything is allocated") {
+            for (auto rows : {std::uint64_t{61}, std::uint64_t{1} << 60, std::numeric_limits<std::uint64_t>::max()}) {
+                auto corrupt = *reader.find_table(Heartbeat::MessageId, 1);
+                corrupt.rows = rows;
+                CHECK(reader.timestamps(corrupt).error() == MavlinkError::ParseError);
+                CHECK(reader.read<Heartbeat>(corrupt).error() == MavlinkError::ParseError);
+                CHECK(reader.field<Heartbeat, 4>(corrupt).error() == MavlinkError::ParseError);
+            }
+        }
+
+        THEN("the archive is a fraction of the size of the frames") { CHECK(*written * 4 < flight.stream.size()); }
+    }
+
+    GIVEN("Messages that are not archived") {
+        auto writer = ArchiveWriter<Attitude>{};
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto length = serialize(ParamValue{}, 1, 1, 0, buffer);
+
+        THEN("they are not added") {
+            CHECK_FALSE(writer.add(parse_frame(std::span<const std::uint8_t>(buffer).first(*length)), 0));
+            CHECK(writer.size() == 0);
+        }
+    }
+
+    GIVEN("A file that is not an archive") {
+        auto archive = TemporaryFile{".mavarch"};
+        std::ofstream(archive.path, std::ios::binary) << "MAVARCHV but then nothing sensible";
+
+        THEN("it does not open") {
+            auto reader = ArchiveReader{archive.path.string()};
+            auto opened = reader.open();
+            REQUIRE_FALSE(opened.has_value());
+            CHECK(opened.error().first == EINVAL);
+        }
+    }
+}
@@ -4,7 +4,9 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "mavlink/checksum.hpp"
+#include "mavlink/payloads/autopilot_version.hpp"
 #include "mavlink/payloads/heartbeat.hpp"
+#include "mavlink/payloads/param_value.hpp"
 #include "mavlink/types.hpp"
 
 using namespace mavlink;
@@ -60,4 +62,18 @@ SCENARIO("CRC Extra Calculation", "[mavlink][checksum]") {
             CHECK(crc == 124);
         }
     }
+
+    GIVEN("A ParamValue message definition with a char array field") {
+        THEN("the calculated CRC Extra matches the known value (220)") {
+            constexpr std::uint8_t crc = mavlink::payloads::ParamValue::CrcExtra();
+            CHECK(crc == 220);
+        }
+    }
+
+    GIVEN("An AutopilotVersion message definition with array and extension fields") {
+        THEN("the calculated CRC Extra matches the known value (178)") {
+            constexpr std::uint8_t crc = mavlink::payloads::AutopilotVersion::CrcExtra();
+            CHECK(crc == 178);
+        }
+    }
 }
@@ -0,0 +1,148 @@
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mavlink/columns.hpp"
+#include "mavlink/deserializer.hpp"
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/heartbeat.hpp"
+#include "mavlink/payloads/param_value.hpp"
+#include "mavlink/payloads/raw_imu.hpp"
+#include "mavlink/serializer.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+/// @brief Serialized frames and the views over them.
+struct Frames {
+    std::deque<std::array<std::uint8_t, 280>> buffers;  // a deque keeps the frames in place as it grows
+    std::vector<MessageView> views;
+
+    template <typename MessageT>
+    void add(const MessageT& message) {
+        auto& buffer = buffers.emplace_back();
+        auto length = serialize(message, 1, 1, 0, buffer);
+        REQUIRE(length.has_value());
+        views.push_back(parse_frame(std::span<const std::uint8_t>(buffer).first(*length)));
+    }
+};
+
+}  // namespace
+
+SCENARIO("Columnar Mavlink payload decoding", "[mavlink][columns]") {
+    GIVEN("Attitude and RawImu messages interleaved with Heartbeats, some zero-truncated") {
+        auto rng = std::mt19937{7};
+        auto real = std::uniform_real_distribution<float>{-3.0f, 3.0f};
+        auto frames = Frames{};
+        for (auto i : std::views::iota(0U, 37U)) {
+            auto att = Attitude{};
+            att.time_boot_ms.value = i;
+            att.roll.value = real(rng);
+            att.yaw.value = real(rng);
+            att.yawspeed.value = (i % 3 == 0) ? 0.0f : real(rng);
+            frames.add(att);
+
+            auto imu = RawImu{};
+            imu.time_usec.value = 0x0123456789ABCDEFULL + i;
+            imu.xacc.value = static_cast<std::int16_t>(rng());
+            imu.zgyro.value = -static_cast<std::int16_t>(i);
+            imu.zmag.value = (i % 2 == 0) ? 0 : static_cast<std::int16_t>(rng());
+            frames.add(imu);
+
+            frames.add(Heartbeat{});
+        }
+
+        WHEN("they are decoded into columns") {
+            auto attitudes = decode_columns<Attitude>(frames.views);
+            auto imus = decode_columns<LazyRawImu>(frames.views);
+
+            THEN("every column holds the field of each message of the type, as deserialize decodes it") {
+                REQUIRE(attitudes.roll.values.size() == 37);
+                REQUIRE(imus.time_usec.values.size() == 37);
+                auto row = std::size_t{0};
+                for (const auto& view : frames.views | std::views::filter([](const MessageView& view) {
+                                            return view.msgid == Attitude::MessageId;
+                                        })) {
+                    auto att = deserialize<LazyAttitude>(view);
+                    CHECK(attitudes.time_boot_ms.values[row] == att->time_boot_ms.value);
+                    CHECK(attitudes.roll.values[row] == att->roll.value);
+                    CHECK(attitudes.pitch.values[row] == 0.0f);
+                    CHECK(attitudes.yaw.values[row] == att->yaw.value);
+                    CHECK(attitudes.yawspeed.values[row] == att->yawspeed.value);
+                    ++row;
+                }
+                row = 0;
+                for (const auto& view : frames.views | std::views::filter([](const MessageView& view) {
+                                            return view.msgid == RawImu::MessageId;
+                                        })) {
+                    auto imu = deserialize<LazyRawImu>(view);
+                    CHECK(imus.time_usec.values[row] == imu->time_usec.value);
+                    CHECK(imus.xacc.values[row] == imu->xacc.value);
+                    CHECK(imus.zgyro.values[row] == imu->zgyro.value);
+                    CHECK(imus.zmag.values[row] == imu->zmag.value);
+                    ++row;
+                }
+            }
+
+            THEN("decoding more appends to the columns") {
+                CHECK(decode_columns<Attitude>(std::span(frames.views).first(6), attitudes) == 2);
+                CHECK(attitudes.roll.values.size() == 39);
+                CHECK(attitudes.time_boot_ms.values.back() == 1);
+            }
+        }
+    }
+
+    GIVEN("Messages with array fields") {
+        auto frames = Frames{};
+        auto param = ParamValue{};
+        param.param_id.value = {'R', 'A', 'T', 'E'};
+        param.param_value.value = 2.5f;
+        frames.add(param);
+
+        THEN("array fields get a column of arrays") {
+            auto params = decode_columns<ParamValue>(frames.views);
+            REQUIRE(params.param_id.values.size() == 1);
+            CHECK(params.param_id.values[0][3] == 'E');
+            CHECK(params.param_value.values[0] == 2.5f);
+        }
+    }
+
+#if defined(AVIONICPP_COLUMNS_AVX2)
+    GIVEN("A block of random rows") {
+        auto rng = std::mt19937{11};
+        constexpr auto stride = std::size_t{23};
+        auto block = std::vector<std::uint8_t>(37 * stride + ColumnBlockSlack);
+        for (auto& b : block) {
+            b = static_cast<std::uint8_t>(rng());
+        }
+
+        THEN("the AVX2 kernel gathers what the scalar kernel does, for every field width and row count") {
+            auto check = [&]<typename T>(T) {
+                for (auto rows : {std::size_t{1}, std::size_t{16}, std::size_t{37}}) {
+                    for (auto offset : {std::size_t{0}, std::size_t{5}, stride - sizeof(T)}) {
+                        auto scalar = std::vector<T>(rows);
+                        auto simd = std::vector<T>(rows);
+                        gather_column_scalar<T>(block, stride, offset, scalar);
+                        if (columns_avx2_supported()) {
+                            gather_column_avx2<T>(block, stride, offset, simd);
+                            CHECK(scalar == simd);
+                        }
+                    }
+                }
+            };
+            check(std::int16_t{});
+            check(std::uint32_t{});
+            check(std::uint64_t{});
+        }
+    }
+#endif
+}
@@ -0,0 +1,109 @@
+#include <array>
+#include <cstdint>
+#include <random>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mavlink/checksum.hpp"
+#include "mavlink/crc_kernels.hpp"
+
+using namespace mavlink;
+
+namespace {
+
+std::uint16_t crc_bytewise(std::uint16_t crc, std::span<const std::uint8_t> data) {
+    for (auto b : data) {
+        crc_accumulate(b, crc);
+    }
+    return crc;
+}
+
+}  // namespace
+
+SCENARIO("X.25 CRC kernels", "[mavlink][checksum]") {
+    GIVEN("The standard check input \"123456789\"") {
+        constexpr auto check = std::string_view{"123456789"};
+        auto bytes = std::vector<std::uint8_t>(check.begin(), check.end());
+
+        THEN("every kernel produces the CRC-16/MCRF4XX check value 0x6F91") {
+            auto crc = std::uint16_t{0xFFFF};
+            crc_accumulate_table(crc, bytes);
+            CHECK(crc == 0x6F91);
+
+            crc = 0xFFFF;
+            crc_accumulate_sliced<4>(crc, bytes);
+            CHECK(crc == 0x6F91);
+
+            crc = 0xFFFF;
+            crc_accumulate_sliced<8>(crc, bytes);
+            CHECK(crc == 0x6F91);
+
+            crc = 0xFFFF;
+            crc_accumulate_buffer(crc, check.data(), check.size());
+            CHECK(crc == 0x6F91);
+        }
+    }
+
+    GIVEN("Random buffers of every length up to a full Mavlink frame") {
+        auto rng = std::mt19937{42};
+        auto data = std::vector<std::uint8_t>(300);
+        for (auto& b : data) {
+            b = static_cast<std::uint8_t>(rng());
+        }
+
+        THEN("every kernel matches the bytewise reference for any length and initial value") {
+            for (auto length : std::views::iota(std::size_t{0}, data.size())) {
+                auto bytes = std::span<const std::uint8_t>(data).first(length);
+                auto init = static_cast<std::uint16_t>(rng());
+                auto expected = crc_bytewise(init, bytes);
+
+                auto table = init;
+                crc_accumulate_table(table, bytes);
+                auto slice4 = init;
+                crc_accumulate_sliced<4>(slice4, bytes);
+                auto slice8 = init;
+                crc_accumulate_sliced<8>(slice8, bytes);
+                auto buffer = init;
+                crc_accumulate_buffer(buffer, reinterpret_cast<const char*>(bytes.data()), bytes.size());
+
+                REQUIRE(table == expected);
+                REQUIRE(slice4 == expected);
+                REQUIRE(slice8 == expected);
+                REQUIRE(buffer == expected);
+#if defined(AVIONICPP_CRC_CLMUL)
+                if (crc_clmul_supported()) {
+                    auto clmul = init;
+                    crc_accumulate_clmul(clmul, bytes);
+                    REQUIRE(clmul == expected);
+                }
+#endif
+            }
+        }
+    }
+
+    GIVEN("A constant-evaluated sliced CRC") {
+        constexpr auto crc = [] {
+            constexpr auto bytes = std::array<std::uint8_t, 9>{'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+            auto value = std::uint16_t{0xFFFF};
+            crc_accumulate_sliced<8>(value, bytes);
+            return value;
+        }();
+
+        THEN("it matches the check value") { STATIC_CHECK(crc == 0x6F91); }
+    }
+
+    GIVEN("A constant-evaluated buffer CRC") {
+        constexpr auto crc = [] {
+            constexpr auto check = std::string_view{"123456789"};
+            auto value = std::uint16_t{0xFFFF};
+            crc_accumulate_buffer(value, check.data(), check.size());
+            return value;
+        }();
+
+        THEN("it matches the check value") { STATIC_CHECK(crc == 0x6F91); }
+    }
+}
@@ -0,0 +1,98 @@
+#include <array>
+#include <cstdint>
+#include <expected>
+#include <type_traits>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mavlink/dispatcher.hpp"
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/command_long.hpp"
+#include "mavlink/payloads/heartbeat.hpp"
+#include "mavlink/serializer.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+using namespace mavlink::enumerations;
+
+namespace {
+
+using TestDispatcher = Dispatcher<LazyCommandLong, LazyHeartbeat, LazyAttitude>;
+
+}  // namespace
+
+SCENARIO("Mavlink message dispatch", "[mavlink][dispatcher]") {
+    GIVEN("A dispatcher for three payload types and a serialized Attitude") {
+        auto att = Attitude{};
+        att.time_boot_ms.value = 4242;
+        att.yaw.value = 1.5f;
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto len = serialize(att, 1, 1, 0, buffer);
+        REQUIRE(len.has_value());
+        auto view = parse_frame(std::span<const std::uint8_t>(buffer).first(*len));
+
+        WHEN("the view is dispatched") {
+            auto attitudes = 0;
+            auto others = 0;
+            auto time_boot_ms = std::uint32_t{0};
+            auto yaw = 0.0f;
+            auto matched = TestDispatcher::dispatch(view, [&](const auto& result) {
+                using PayloadType = typename std::remove_cvref_t<decltype(result)>::value_type;
+                if constexpr (std::is_same_v<PayloadType, LazyAttitude>) {
+                    REQUIRE(result.has_value());
+                    time_boot_ms = result->time_boot_ms.value;
+                    yaw = result->yaw.value;
+                    ++attitudes;
+                } else {
+                    ++others;
+                }
+            });
+
+            THEN("the visitor receives the deserialized Attitude") {
+                CHECK(matched);
+                CHECK(attitudes == 1);
+                CHECK(others == 0);
+                CHECK(time_boot_ms == 4242);
+                CHECK(yaw == 1.5f);
+            }
+        }
+
+        WHEN("a view with an unregistered msgid is dispatched") {
+            view.msgid = 12345;
+            auto visited = false;
+            auto matched = TestDispatcher::dispatch(view, [&]([[maybe_unused]] const auto& result) { visited = true; });
+
+            THEN("the visitor is not invoked") {
+                CHECK_FALSE(matched);
+                CHECK_FALSE(visited);
+            }
+        }
+    }
+
+    GIVEN("A serialized Heartbeat") {
+        auto hb = Heartbeat{};
+        hb.custom_mode.value = 0xDEADBEEF;
+        hb.type.value = MavType::QUADROTOR;
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto len = serialize(hb, 1, 1, 0, buffer);
+        REQUIRE(len.has_value());
+        auto view = parse_frame(std::span<const std::uint8_t>(buffer).first(*len));
+
+        THEN("it reaches the Heartbeat handler whatever the registration order") {
+            auto custom_mode = std::uint32_t{0};
+            auto visitor = [&](const auto& result) {
+                if constexpr (std::is_same_v<typename std::remove_cvref_t<decltype(result)>::value_type,
+                                             LazyHeartbeat>) {
+                    custom_mode = result->custom_mode.value;
+                }
+            };
+            CHECK(TestDispatcher::dispatch(view, visitor));
+            CHECK(custom_mode == 0xDEADBEEF);
+            custom_mode = 0;
+            CHECK(Dispatcher<LazyHeartbeat>::dispatch(view, visitor));
+            CHECK(custom_mode == 0xDEADBEEF);
+        }
+    }
+}
@@ -0,0 +1,202 @@
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "frame_stream.hpp"
+#include "mavlink/frame_ring.hpp"
+#include "mavlink/deserializer.hpp"
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/common_messages.hpp"
+#include "mavlink/payloads/heartbeat.hpp"
+#include "mavlink/serializer.hpp"
+#include "mavlink/synthetic_stream.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+Attitude make_attitude(float roll) {
+    auto att = Attitude{};
+    att.time_boot_ms.value = 12345678;
+    att.roll.value = roll;
+    return att;
+}
+
+// Three frames, with the roll of each Attitude telling them apart.
+std::vector<std::uint8_t> make_stream() {
+    auto stream = std::vector<std::uint8_t>{};
+    append_frame(stream, make_attitude(1.0f), 0);
+    append_frame(stream, Heartbeat{}, 1);
+    append_frame(stream, make_attitude(2.0f), 2);
+    return stream;
+}
+
+}  // namespace
+
+SCENARIO("Mavlink frame ring", "[mavlink][framer][ring]") {
+    GIVEN("Slot storage of various sizes") {
+        THEN("a ring needs at least two slots, known at compile time") {
+            STATIC_CHECK(std::is_constructible_v<FrameRing, std::array<FrameSlot, 2>&>);
+            STATIC_CHECK(std::is_constructible_v<FrameRing, std::span<FrameSlot, 2>>);
+            STATIC_CHECK_FALSE(std::is_constructible_v<FrameRing, std::array<FrameSlot, 1>&>);
+            STATIC_CHECK_FALSE(std::is_constructible_v<FrameRing, std::array<FrameSlot, 0>&>);
+            STATIC_CHECK_FALSE(std::is_constructible_v<FrameRing, std::span<FrameSlot, 1>>);
+            STATIC_CHECK_FALSE(std::is_constructible_v<FrameRing, std::span<FrameSlot>>);
+        }
+    }
+
+    GIVEN("A framer receiving into a ring of four slots") {
+        auto slots = std::array<FrameSlot, 4>{};
+        auto ring = FrameRing{slots};
+        auto framer = create_framer(ring, FramerOptions{CommonMessages::Entries});
+        const auto stream = make_stream();
+
+        WHEN("three frames are pushed byte by byte and none is released") {
+            auto views = std::vector<MessageView>{};
+            for (auto b : stream) {
+                if (auto result = framer.push_byte(b)) {
+                    REQUIRE(result->has_value());
+                    views.push_back(result->value());
+                }
+            }
+
+            THEN("every view is still intact after the following frames were received") {
+                REQUIRE(views.size() == 3);
+                CHECK(ring.held() == 3);
+                CHECK(views[0].seq == 0);
+                CHECK(views[1].msgid == Heartbeat::MessageId);
+                CHECK(deserialize<Attitude>(views[0])->roll.value == 1.0f);
+                CHECK(deserialize<Attitude>(views[2])->roll.value == 2.0f);
+                CHECK(std::ranges::equal(views[0].frame, std::span(stream).first(views[0].frame.size())));
+            }
+
+            THEN("a fourth frame does not fit until a view is released") {
+                auto results = std::vector<Framer::ParseResult>{};
+                framer.push_bytes(stream, [&](const Framer::ParseResult& result) { results.push_back(result); });
+                REQUIRE(results.size() == 3);
+                REQUIRE_FALSE(results[0].has_value());
+                CHECK(results[0].error().first == MavlinkError::BufferOverrun);
+
+                ring.release(views[1]);
+                CHECK(ring.held() == 2);
+                results.clear();
+                framer.push_bytes(stream, [&](const Framer::ParseResult& result) { results.push_back(result); });
+                REQUIRE(results.size() == 3);
+                CHECK(results[0].has_value());
+                CHECK_FALSE(results[1].has_value());
+                CHECK(deserialize<Attitude>(views[0])->roll.value == 1.0f);
+            }
+        }
+
+        WHEN("frames are validated in place from a chunk that is then overwritten") {
+            auto chunk = stream;
+            auto views = std::vector<MessageView>{};
+            framer.push_bytes(chunk, [&](const Framer::ParseResult& result) {
+                REQUIRE(result.has_value());
+                views.push_back(*result);
+            });
+            std::ranges::fill(chunk, std::uint8_t{0});
+
+            THEN("the views point into the ring and keep their bytes") {
+                REQUIRE(views.size() == 3);
+                CHECK(views[0].frame.data() == slots[0].bytes.data());
+                CHECK(deserialize<Attitude>(views[0])->roll.value == 1.0f);
+                CHECK(deserialize<Attitude>(views[2])->roll.value == 2.0f);
+                CHECK(views[2].payload.data() == views[2].frame.data() + HeaderLengthV2);
+            }
+
+            THEN("released slots are reused") {
+                for (const auto& view : views) {
+                    ring.release(view);
+                }
+                CHECK(ring.held() == 0);
+                auto count = 0;
+                for (auto round = 0; round < 4; ++round) {
+                    framer.push_bytes(stream, [&](const Framer::ParseResult& result) {
+                        REQUIRE(result.has_value());
+                        ring.release(*result);
+                        ++count;
+                    });
+                }
+                CHECK(count == 12);
+            }
+        }
+    }
+
+    GIVEN("A framer on one thread handing views to a consumer on another, without copying") {
+        auto slots = std::array<FrameSlot, 8>{};
+        auto ring = FrameRing{slots};
+        auto framer = create_framer(ring, FramerOptions{CommonMessages::Entries});
+        auto generator = CommonSyntheticStream{3};
+        const auto stream = generator.generate(1 << 18);
+
+        auto mutex = std::mutex{};
+        auto ready = std::condition_variable{};
+        auto queue = std::deque<MessageView>{};
+        auto done = false;
+        auto received = std::size_t{0};
+        auto intact = std::size_t{0};
+
+        auto consumer = std::thread([&] {
+            // re-frames every view to check that its bytes were not overwritten while it was held
+            auto buffer = std::array<std::uint8_t, 280>{};
+            auto buffer_span = std::span<std::uint8_t>(buffer);
+            auto checker = create_framer(&buffer_span, FramerOptions{CommonMessages::Entries});
+            while (true) {
+                auto lock = std::unique_lock(mutex);
+                ready.wait(lock, [&] { return done || !queue.empty(); });
+                if (queue.empty()) {
+                    break;
+                }
+                auto view = queue.front();
+                queue.pop_front();
+                lock.unlock();
+
+                checker.push_bytes(view.frame,
+                                   [&](const Framer::ParseResult& result) { intact += result.has_value(); });
+                ++received;
+                ring.release(view);
+            }
+        });
+
+        auto full = std::size_t{0};
+        auto remaining = std::span<const std::uint8_t>(stream);
+        while (!remaining.empty()) {
+            auto chunk = remaining.first(std::min<std::size_t>(remaining.size(), 256));
+            framer.push_bytes(chunk, [&](const Framer::ParseResult& result) {
+                if (!result) {
+                    ++full;
+                    return;
+                }
+                auto lock = std::lock_guard(mutex);
+                queue.push_back(*result);
+                ready.notify_one();
+            });
+            remaining = remaining.subspan(chunk.size());
+        }
+        {
+            auto lock = std::lock_guard(mutex);
+            done = true;
+            ready.notify_one();
+        }
+        consumer.join();
+
+        THEN("every frame either reached the consumer intact or was refused for lack of a free slot") {
+            CHECK(received > 0);
+            CHECK(intact == received);
+            CHECK(received + full == generator.stats().frames);
+            CHECK(ring.held() == 0);
+        }
+    }
+}
@@ -0,0 +1,464 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "frame_stream.hpp"
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/common_messages.hpp"
+#include "mavlink/payloads/heartbeat.hpp"
+#include "mavlink/serializer.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+Heartbeat make_heartbeat() {
+    auto hb = Heartbeat{};
+    hb.custom_mode.value = 0xDEADBEEF;
+    hb.type.value = MavType::QUADROTOR;
+    hb.mavlink_version.value = 3;
+    return hb;
+}
+
+Attitude make_attitude() {
+    auto att = Attitude{};
+    att.time_boot_ms.value = 12345678;
+    att.roll.value = 1.0f;
+    att.yaw.value = 0.5f;
+    att.yawspeed.value = 0.1f;
+    return att;
+}
+
+// Memory resource counting the blocks it hands out from an upstream resource.
+class CountingResource : public std::pmr::memory_resource {
+   public:
+    explicit CountingResource(std::pmr::memory_resource* upstream) : upstream_(upstream) {}
+
+    std::size_t allocations = 0;
+    std::size_t deallocations = 0;
+
+   private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocations;
+        return upstream_->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        ++deallocations;
+        upstream_->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    std::pmr::memory_resource* upstream_;
+};
+
+}  // namespace
+
+SCENARIO("Mavlink byte-at-a-time framing", "[mavlink][framer]") {
+    GIVEN("A framer and a serialized Heartbeat") {
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto buffer_span = std::span<std::uint8_t>(buffer);
+        auto framer = create_framer(&buffer_span);
+
+        auto stream = std::vector<std::uint8_t>{0x00, 0x11};
+        append_frame(stream, make_heartbeat(), 7);
+
+        WHEN("the bytes are pushed one at a time") {
+            auto results = std::vector<Framer::ParseResult>{};
+            for (auto b : stream) {
+                if (auto result = framer.push_byte(b)) {
+                    results.push_back(*result);
+                }
+            }
+
+            THEN("exactly one view is yielded with the header fields") {
+                REQUIRE(results.size() == 1);
+                REQUIRE(results[0].has_value());
+                CHECK(results[0]->msgid == Heartbeat::MessageId);
+                CHECK(results[0]->seq == 7);
+                CHECK(results[0]->sysid == 1);
+                CHECK(results[0]->compid == 1);
+                CHECK(results[0]->payload.size() == 9);
+            }
+
+            THEN("the view exposes the raw frame bytes") {
+                REQUIRE(results.size() == 1);
+                REQUIRE(results[0].has_value());
+                CHECK(std::ranges::equal(results[0]->frame, std::span(stream).subspan(2)));
+                CHECK(results[0]->incompat_flags == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("Mavlink bulk framing", "[mavlink][framer]") {
+    GIVEN("A framer and a stream of frames separated by noise") {
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto buffer_span = std::span<std::uint8_t>(buffer);
+        auto framer = create_framer(&buffer_span);
+
+        auto stream = std::vector<std::uint8_t>{0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09};
+        append_frame(stream, make_heartbeat(), 0);
+        append_frame(stream, make_attitude(), 1);
+        stream.insert(stream.end(), {0x55, 0xAA});
+        append_frame(stream, make_heartbeat(), 2);
+
+        WHEN("the whole stream is pushed as one chunk") {
+            auto msgids = std::vector<std::uint32_t>{};
+            auto seqs = std::vector<std::uint8_t>{};
+            framer.push_bytes(stream, [&](const Framer::ParseResult& result) {
+                REQUIRE(result.has_value());
+                msgids.push_back(result->msgid);
+                seqs.push_back(result->seq);
+            });
+
+            THEN("every frame is yielded in order") {
+                CHECK(msgids == std::vector<std::uint32_t>{Heartbeat::MessageId, Attitude::MessageId,
+                                                           Heartbeat::MessageId});
+                CHECK(seqs == std::vector<std::uint8_t>{0, 1, 2});
+            }
+        }
+
+        WHEN("the stream is pushed in small chunks that split frames") {
+            auto payload_sizes = std::vector<std::size_t>{};
+            auto remaining = std::span<const std::uint8_t>(stream);
+            while (!remaining.empty()) {
+                auto n = std::min<std::size_t>(remaining.size(), 13);
+                framer.push_bytes(remaining.first(n), [&](const Framer::ParseResult& result) {
+                    REQUIRE(result.has_value());
+                    payload_sizes.push_back(result->payload.size());
+                });
+                remaining = remaining.subspan(n);
+            }
+
+            THEN("every frame is reassembled exactly once") {
+                CHECK(payload_sizes == std::vector<std::size_t>{9, 28, 9});
+            }
+        }
+
+        WHEN("bulk and byte-at-a-time pushes are mixed") {
+            auto count = 0;
+            auto half = stream.size() / 2;
+            for (auto b : std::span<const std::uint8_t>(stream).first(half)) {
+                if (auto result = framer.push_byte(b); result && result->has_value()) {
+                    ++count;
+                }
+            }
+            framer.push_bytes(std::span<const std::uint8_t>(stream).subspan(half),
+                              [&](const Framer::ParseResult& result) { count += result.has_value() ? 1 : 0; });
+
+            THEN("no frame is lost or duplicated") { CHECK(count == 3); }
+        }
+    }
+
+    GIVEN("A Mavlink v1 frame") {
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto buffer_span = std::span<std::uint8_t>(buffer);
+        auto framer = create_framer(&buffer_span);
+
+        // HEARTBEAT, seq 3, sys 2, comp 1, payload 9 bytes
+        auto stream = std::vector<std::uint8_t>{0xFE, 9, 3, 2, 1, 0, 0, 0, 0, 0, 2, 3, 0x51, 4, 3, 0x12, 0x34};
+
+        WHEN("it is pushed as one chunk") {
+            auto views = std::vector<MessageView>{};
+            framer.push_bytes(stream, [&](const Framer::ParseResult& result) {
+                REQUIRE(result.has_value());
+                views.push_back(*result);
+            });
+
+            THEN("the v1 header is decoded") {
+                REQUIRE(views.size() == 1);
+                CHECK(views[0].msgid == 0);
+                CHECK(views[0].seq == 3);
+                CHECK(views[0].sysid == 2);
+                CHECK(views[0].payload.size() == 9);
+                CHECK(views[0].payload[5] == 3);
+                CHECK(views[0].frame.size() == stream.size());
+            }
+        }
+    }
+}
+
+SCENARIO("Mavlink checksum validation", "[mavlink][framer]") {
+    GIVEN("A framer validating against the common message registry") {
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto buffer_span = std::span<std::uint8_t>(buffer);
+        auto framer = create_framer(&buffer_span, FramerOptions{CommonMessages::Entries});
+
+        auto stream = std::vector<std::uint8_t>{};
+        append_frame(stream, make_heartbeat(), 0);
+
+        WHEN("an intact frame is pushed byte by byte") {
+            auto result = Framer::YieldedValue{};
+            for (auto b : stream) {
+                if (auto yielded = framer.push_byte(b)) {
+                    result = yielded;
+                }
+            }
+
+            THEN("the frame is yielded") {
+                REQUIRE(result.has_value());
+                CHECK(result->has_value());
+            }
+        }
+
+        WHEN("a frame with a corrupted payload byte is pushed byte by byte") {
+            stream[12] ^= 0x40;
+            auto result = Framer::YieldedValue{};
+            for (auto b : stream) {
+                if (auto yielded = framer.push_byte(b)) {
+                    result = yielded;
+                }
+            }
+
+            THEN("an InvalidChecksum error is yielded") {
+                REQUIRE(result.has_value());
+                REQUIRE_FALSE(result->has_value());
+                CHECK(result->error().first == MavlinkError::InvalidChecksum);
+            }
+        }
+
+        WHEN("an intact and a corrupted frame are pushed as one chunk") {
+            append_frame(stream, make_attitude(), 1);
+            stream.back() ^= 0x01;  // corrupt the CRC of the attitude frame
+            auto results = std::vector<Framer::ParseResult>{};
+            framer.push_bytes(stream, [&](const Framer::ParseResult& result) { results.push_back(result); });
+
+            THEN("the intact frame is yielded and the corrupted one is rejected") {
+                REQUIRE(results.size() == 2);
+                CHECK(results[0].has_value());
+                REQUIRE_FALSE(results[1].has_value());
+                CHECK(results[1].error().first == MavlinkError::InvalidChecksum);
+            }
+        }
+    }
+
+    GIVEN("A frame whose msgid is not in the registry") {
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto buffer_span = std::span<std::uint8_t>(buffer);
+
+        // msgid 0x123456 is not defined, the CRC is arbitrary
+        auto stream = std::vector<std::uint8_t>{0xFD, 2, 0, 0, 4, 1, 1, 0x56, 0x34, 0x12, 0xAA, 0xBB, 0x00, 0x00};
+
+        WHEN("the framer passes unknown messages through") {
+            auto framer = create_framer(&buffer_span, FramerOptions{CommonMessages::Entries});
+            auto views = std::vector<MessageView>{};
+            framer.push_bytes(stream, [&](const Framer::ParseResult& result) {
+                REQUIRE(result.has_value());
+                views.push_back(*result);
+            });
+
+            THEN("the frame is yielded unchecked") {
+                REQUIRE(views.size() == 1);
+                CHECK(views[0].msgid == 0x123456);
+            }
+        }
+
+        WHEN("the framer drops unknown messages") {
+            auto framer = create_framer(&buffer_span,
+                                        FramerOptions{CommonMessages::Entries, UnknownMessagePolicy::Drop});
+            auto yielded = 0;
+            for (auto b : stream) {
+                yielded += framer.push_byte(b).has_value() ? 1 : 0;
+            }
+            framer.push_bytes(stream, [&]([[maybe_unused]] const Framer::ParseResult& result) { ++yielded; });
+
+            THEN("nothing is yielded") { CHECK(yielded == 0); }
+        }
+    }
+}
+
+SCENARIO("Mavlink resynchronization after a rejected frame", "[mavlink][framer]") {
+    GIVEN("A Heartbeat whose length byte is corrupted, so that it swallows the six Attitude frames after it") {
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto buffer_span = std::span<std::uint8_t>(buffer);
+        auto framer = create_framer(&buffer_span, FramerOptions{CommonMessages::Entries});
+
+        auto stream = std::vector<std::uint8_t>{};
+        append_frame(stream, make_heartbeat(), 0);
+        stream[1] = 200;
+        for (auto seq = std::uint8_t{1}; seq <= 6; ++seq) {
+            append_frame(stream, make_attitude(), seq);
+        }
+        REQUIRE(stream.size() > HeaderLengthV2 + 200 + ChecksumLength);
+
+        auto seqs = std::vector<std::uint8_t>{};
+        auto errors = std::vector<MavlinkError>{};
+        auto collect = [&](const Framer::ParseResult& result) {
+            if (result) {
+                seqs.push_back(result->seq);
+            } else {
+                errors.push_back(result.error().first);
+            }
+        };
+        const auto recovered = std::vector<std::uint8_t>{1, 2, 3, 4, 5, 6};
+
+        WHEN("the stream is pushed as one chunk") {
+            framer.push_bytes(stream, collect);
+
+            THEN("the false frame is rejected and every Attitude frame is recovered in order") {
+                CHECK(errors == std::vector<MavlinkError>{MavlinkError::InvalidChecksum});
+                CHECK(seqs == recovered);
+            }
+        }
+
+        WHEN("the stream is pushed in chunks shorter than the false frame") {
+            auto remaining = std::span<const std::uint8_t>(stream);
+            while (!remaining.empty()) {
+                auto n = std::min<std::size_t>(remaining.size(), 16);
+                framer.push_bytes(remaining.first(n), collect);
+                remaining = remaining.subspan(n);
+            }
+
+            THEN("the buffered bytes are rescanned and every Attitude frame is recovered in order") {
+                CHECK(errors == std::vector<MavlinkError>{MavlinkError::InvalidChecksum});
+                CHECK(seqs == recovered);
+            }
+        }
+
+        WHEN("the stream is pushed byte by byte, then the rest is rescanned") {
+            for (auto b : stream) {
+                if (auto result = framer.push_byte(b)) {
+                    collect(*result);
+                }
+            }
+            while (auto result = framer.rescan()) {
+                collect(*result);
+            }
+
+            THEN("every Attitude frame is recovered in order") {
+                CHECK(errors == std::vector<MavlinkError>{MavlinkError::InvalidChecksum});
+                CHECK(seqs == recovered);
+                CHECK_FALSE(framer.rescan().has_value());
+            }
+        }
+    }
+
+    GIVEN("A Heartbeat whose msgid is corrupted to an unknown one, and a framer dropping unknown messages") {
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto buffer_span = std::span<std::uint8_t>(buffer);
+        auto framer = create_framer(&buffer_span, FramerOptions{CommonMessages::Entries, UnknownMessagePolicy::Drop});
+
+        auto stream = std::vector<std::uint8_t>{};
+        append_frame(stream, make_heartbeat(), 0);
+        stream[1] = 40;
+        stream[9] = 0x77;
+        append_frame(stream, make_attitude(), 1);
+        append_frame(stream, make_attitude(), 2);
+
+        WHEN("the stream is pushed in two chunks") {
+            auto seqs = std::vector<std::uint8_t>{};
+            auto half = stream.size() / 2;
+            auto collect = [&](const Framer::ParseResult& result) {
+                REQUIRE(result.has_value());
+                seqs.push_back(result->seq);
+            };
+            framer.push_bytes(std::span<const std::uint8_t>(stream).first(half), collect);
+            framer.push_bytes(std::span<const std::uint8_t>(stream).subspan(half), collect);
+
+            THEN("the Attitude frames inside the dropped frame are recovered") {
+                CHECK(seqs == std::vector<std::uint8_t>{1, 2});
+            }
+        }
+    }
+
+    GIVEN("A Heartbeat of an unknown msgid split across two chunks, and a framer dropping unknown messages") {
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto buffer_span = std::span<std::uint8_t>(buffer);
+        auto framer = create_framer(&buffer_span, FramerOptions{CommonMessages::Entries, UnknownMessagePolicy::Drop});
+
+        auto stream = std::vector<std::uint8_t>{};
+        append_frame(stream, make_heartbeat(), 0);
+        stream[9] = 0x77;
+        append_frame(stream, make_attitude(), 1);
+        append_frame(stream, make_attitude(), 2);
+        auto second = std::span<const std::uint8_t>(stream).subspan(5);
+
+        WHEN("the Heartbeat is dropped while finishing it from the second chunk") {
+            auto views = std::vector<MessageView>{};
+            auto collect = [&](const Framer::ParseResult& result) {
+                REQUIRE(result.has_value());
+                views.push_back(*result);
+            };
+            framer.push_bytes(std::span<const std::uint8_t>(stream).first(5), collect);
+            framer.push_bytes(second, collect);
+
+            THEN("the framer is back to scanning the chunk and validates the following frames in place") {
+                REQUIRE(views.size() == 2);
+                CHECK(views[0].seq == 1);
+                CHECK(views[1].seq == 2);
+                for (const auto& view : views) {
+                    CHECK(view.frame.data() >= second.data());
+                    CHECK(view.frame.data() < second.data() + second.size());
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Mavlink start marker scan", "[mavlink][framer]") {
+    GIVEN("Byte ranges with and without start markers") {
+        auto none = std::array<std::uint8_t, 19>{};
+        auto late = std::array<std::uint8_t, 19>{};
+        late[17] = 0xFE;
+        late[18] = 0xFD;
+        auto early = std::array<std::uint8_t, 4>{0x00, 0xFD, 0x00, 0x00};
+
+        THEN("the index of the first marker is found") {
+            CHECK(find_start_marker(none) == none.size());
+            CHECK(find_start_marker(late) == 17);
+            CHECK(find_start_marker(early) == 1);
+        }
+    }
+}
+
+SCENARIO("Mavlink framer allocation", "[mavlink][framer]") {
+    GIVEN("A memory resource over a fixed arena, with no heap behind it") {
+        auto arena = std::array<std::byte, 4096>{};
+        auto monotonic =
+            std::pmr::monotonic_buffer_resource(arena.data(), arena.size(), std::pmr::null_memory_resource());
+        auto resource = CountingResource(&monotonic);
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto buffer_span = std::span<std::uint8_t>(buffer);
+        auto stream = std::vector<std::uint8_t>{};
+        append_frame(stream, make_heartbeat(), 3);
+
+        WHEN("a framer is created from it, used and destroyed") {
+            auto frames = 0;
+            {
+                auto framer = create_framer(std::allocator_arg, &resource, &buffer_span,
+                                            FramerOptions{CommonMessages::Entries});
+                framer.push_bytes(stream, [&](const Framer::ParseResult& result) { frames += result.has_value(); });
+                CHECK(resource.allocations == 1);
+                CHECK(resource.deallocations == 0);
+            }
+
+            THEN("its coroutine frame came from the arena and went back to it") {
+                CHECK(frames == 1);
+                CHECK(resource.allocations == 1);
+                CHECK(resource.deallocations == 1);
+            }
+        }
+
+        WHEN("it is the default resource and a framer is created without one") {
+            auto* previous = std::pmr::set_default_resource(&resource);
+            {
+                auto framer = create_framer(&buffer_span);
+            }
+            std::pmr::set_default_resource(previous);
+
+            THEN("the framer is allocated from it") {
+                CHECK(resource.allocations == 1);
+                CHECK(resource.deallocations == 1);
+            }
+        }
+    }
+}
@@ -1,10 +1,14 @@
+#include <algorithm>
 #include <array>
 #include <cstdint>
+#include <span>
 #include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include "mavlink/deserializer.hpp"
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/common_messages.hpp"
 #include "mavlink/payloads/gps_raw_int.hpp"
 #include "mavlink/serializer.hpp"
 
@@ -12,6 +16,18 @@ using namespace mavlink;
 using namespace mavlink::payloads;
 using namespace mavlink::enumerations;
 
+namespace {
+
+// The frame mavlink_msg_gps_raw_int_pack(1, 1, &msg, ...) of the reference C library packs for the values used
+// below with seq 0: mavlink_gps_raw_int_t payload offsets, CRC_EXTRA 24, no trailing zeros to truncate.
+constexpr auto ReferenceFrame = std::array<std::uint8_t, 64>{
+    0xFD, 0x34, 0x00, 0x00, 0x00, 0x01, 0x01, 0x18, 0x00, 0x00, 0x40, 0x42, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0x3A, 0x1C, 0x60, 0xA0, 0x18, 0x05, 0x20, 0xA1, 0x07, 0x00, 0x64, 0x00,
+    0xC8, 0x00, 0xDC, 0x05, 0x50, 0x46, 0x03, 0x0A, 0x70, 0x64, 0x08, 0x00, 0xF4, 0x01, 0x00, 0x00,
+    0x20, 0x03, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x00, 0x00, 0x28, 0x23, 0x39, 0x98};
+
+}  // namespace
+
 SCENARIO("GpsRawInt Serialization", "[mavlink][gps_raw_int]") {
     GIVEN("A populated GpsRawInt message") {
         GpsRawInt gps;
@@ -58,28 +74,23 @@ SCENARIO("GpsRawInt Serialization", "[mavlink][gps_raw_int]") {
                 }
 
                 AND_THEN("the payload is correct") {
-                    // time_usec (8 bytes)
-                    // lat (4 bytes)
-                    // lon (4 bytes)
-                    // alt (4 bytes)
-                    // alt_ellipsoid (4 bytes)
-                    // h_acc (4 bytes)
-                    // v_acc (4 bytes)
-                    // vel_acc (4 bytes)
-                    // hdg_acc (4 bytes)
-                    // eph (2 bytes)
-                    // epv (2 bytes)
-                    // vel (2 bytes)
-                    // cog (2 bytes)
-                    // yaw (2 bytes)
-                    // fix_type (1 byte)
-                    // satellites_visible (1 byte)
-
-                    // fix_type is at offset 8+4*8 + 5*2 = 8+32+10 = 50
-                    CHECK(buffer[10 + 50] == MavGpsFixType::FIX_3D);
-
-                    // satellites_visible at 51
-                    CHECK(buffer[10 + 51] == 10);
+                    // base fields, largest first: time_usec (8), lat, lon, alt (4 each), eph, epv, vel, cog (2 each),
+                    // fix_type, satellites_visible (1 each); then the extensions in declaration order:
+                    // alt_ellipsoid, h_acc, v_acc, vel_acc, hdg_acc (4 each), yaw (2)
+
+                    // fix_type is at offset 8 + 3*4 + 4*2 = 28
+                    CHECK(buffer[10 + 28] == MavGpsFixType::FIX_3D);
+
+                    // satellites_visible at 29
+                    CHECK(buffer[10 + 29] == 10);
+
+                    // yaw closes the payload at 50
+                    CHECK(buffer[10 + 50] == (9000 & 0xFF));
+                    CHECK(buffer[10 + 51] == (9000 >> 8));
+                }
+
+                AND_THEN("the frame matches the reference frame") {
+                    CHECK(std::ranges::equal(std::span(buffer).first(len), ReferenceFrame));
                 }
             }
         }
@@ -143,3 +154,33 @@ SCENARIO("GpsRawInt Deserialization", "[mavlink][gps_raw_int]") {
         }
     }
 }
+
+SCENARIO("GpsRawInt CRC_EXTRA", "[mavlink][gps_raw_int]") {
+    GIVEN("The GPS_RAW_INT definition") {
+        THEN("CRC_EXTRA and the payload lengths match the published definition") {
+            CHECK(GpsRawInt::CrcExtra() == 24);
+            CHECK(make_message_info<GpsRawInt>().min_length == 30);
+            CHECK(make_message_info<GpsRawInt>().max_length == 52);
+        }
+    }
+
+    GIVEN("A frame packed by the reference C library") {
+        WHEN("it is framed against the common message registry") {
+            auto buffer = std::array<std::uint8_t, 280>{};
+            auto buffer_span = std::span<std::uint8_t>(buffer);
+            auto framer = create_framer(&buffer_span, FramerOptions{CommonMessages::Entries});
+            auto results = std::vector<Framer::ParseResult>{};
+            framer.push_bytes(ReferenceFrame, [&](const Framer::ParseResult& result) { results.push_back(result); });
+
+            THEN("its checksum is accepted and its fields are read back") {
+                REQUIRE(results.size() == 1);
+                REQUIRE(results[0].has_value());
+                auto gps = deserialize<GpsRawInt>(*results[0]);
+                REQUIRE(gps.has_value());
+                CHECK(gps->lat.value == 473600000);
+                CHECK(gps->satellites_visible.value == 10);
+                CHECK(gps->yaw.value == 9000);
+            }
+        }
+    }
+}
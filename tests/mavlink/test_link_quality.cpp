@@ -0,0 +1,138 @@
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "mavlink/link_quality.hpp"
+#include "mavlink/types.hpp"
+
+using namespace mavlink;
+using namespace std::chrono_literals;
+
+namespace {
+
+using Tracker = LinkQualityTracker<4>;
+
+// Records frames of the given length from a source with the given sequence numbers.
+void record(Tracker& tracker,
+            std::initializer_list<std::uint8_t> seqs,
+            Tracker::Clock::time_point now,
+            std::uint8_t sysid = 1,
+            std::size_t length = 20) {
+    static const auto frame = std::vector<std::uint8_t>(280);
+    auto view = MessageView{};
+    view.sysid = sysid;
+    view.compid = 1;
+    view.frame = std::span<const std::uint8_t>(frame).first(length);
+    for (auto seq : seqs) {
+        view.seq = seq;
+        tracker.record(view, now);
+    }
+}
+
+}  // namespace
+
+SCENARIO("Mavlink link quality tracking", "[mavlink][link_quality]") {
+    GIVEN("A tracker with a one second window") {
+        auto tracker = Tracker{100ms};
+        auto start = Tracker::Clock::time_point{} + 1000s;
+
+        WHEN("a source sends an unbroken sequence across the wrap-around") {
+            record(tracker, {253, 254, 255, 0, 1}, start);
+            auto quality = tracker.quality(1, 1, start);
+
+            THEN("every frame is counted as received and none as lost") {
+                REQUIRE(quality.has_value());
+                CHECK(quality->received == 5);
+                CHECK(quality->lost == 0);
+                CHECK(quality->loss_rate == 0.0);
+                CHECK(quality->bytes == 100);
+            }
+        }
+
+        WHEN("a source skips sequence numbers") {
+            record(tracker, {10, 11, 14, 15}, start);
+            auto quality = tracker.quality(1, 1, start);
+
+            THEN("the gaps are counted as lost") {
+                REQUIRE(quality.has_value());
+                CHECK(quality->received == 4);
+                CHECK(quality->lost == 2);
+                CHECK(quality->loss_rate == Catch::Approx(2.0 / 6.0));
+            }
+        }
+
+        WHEN("a frame arrives late and another twice") {
+            record(tracker, {10, 12, 11, 12, 11}, start);
+            auto quality = tracker.quality(1, 1, start);
+
+            THEN("the late frame is reordered, not lost, and the repeats are duplicates") {
+                REQUIRE(quality.has_value());
+                CHECK(quality->received == 3);
+                CHECK(quality->lost == 0);
+                CHECK(quality->reordered == 1);
+                CHECK(quality->duplicated == 2);
+            }
+        }
+
+        WHEN("a frame lost in one bucket arrives late in the next, after another gap") {
+            record(tracker, {10, 12}, start);
+            record(tracker, {13, 15, 11}, start + 150ms);
+            auto quality = tracker.quality(1, 1, start + 1050ms);
+
+            THEN("the late frame is taken off the earlier bucket's loss, not the later one's") {
+                REQUIRE(quality.has_value());
+                CHECK(quality->lost == 1);
+                CHECK(quality->reordered == 1);
+                CHECK(quality->loss_rate == Catch::Approx(1.0 / 4.0));
+            }
+        }
+
+        WHEN("two sources interleave their traffic") {
+            record(tracker, {0, 1}, start, 1);
+            record(tracker, {7, 9}, start, 2);
+            record(tracker, {2}, start, 1);
+
+            THEN("each source is tracked separately") {
+                CHECK(tracker.quality(1, 1, start)->lost == 0);
+                CHECK(tracker.quality(2, 1, start)->lost == 1);
+            }
+        }
+
+        WHEN("traffic is spread over more than the window") {
+            record(tracker, {0, 2}, start, 1, 100);
+            record(tracker, {3, 4, 5, 6}, start + 1500ms, 1, 50);
+            auto quality = tracker.quality(1, 1, start + 1500ms);
+
+            THEN("the rolling rates cover only the window") {
+                REQUIRE(quality.has_value());
+                CHECK(quality->lost == 1);
+                CHECK(quality->loss_rate == 0.0);
+                CHECK(quality->bytes_per_second == Catch::Approx(200.0));
+            }
+
+            THEN("the window is empty once traffic stops") {
+                auto later = tracker.quality(1, 1, start + 3s);
+                REQUIRE(later.has_value());
+                CHECK(later->bytes_per_second == 0.0);
+                CHECK(later->received == 6);
+            }
+        }
+
+        WHEN("more sources are heard than the table holds") {
+            for (auto sysid : std::initializer_list<std::uint8_t>{1, 2, 3, 4, 5}) {
+                record(tracker, {0}, start, sysid);
+            }
+
+            THEN("the first sources are tracked and the rest are ignored") {
+                CHECK(tracker.quality(4, 1, start).has_value());
+                CHECK_FALSE(tracker.quality(5, 1, start).has_value());
+            }
+        }
+
+        THEN("an unheard source has no link quality") { CHECK_FALSE(tracker.quality(9, 9, start).has_value()); }
+    }
+}
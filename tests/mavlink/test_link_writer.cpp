@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <expected>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mavlink/framer.hpp"
+#include "mavlink/link_writer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/heartbeat.hpp"
+#include "mavlink/signing.hpp"
+#include "uart/uart.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+using namespace std::chrono_literals;
+
+namespace {
+
+/// @brief UART that records every write, optionally accepting only part of each.
+class RecordingUART {
+   public:
+    using native_handle_type = std::nullptr_t;
+
+    explicit RecordingUART([[maybe_unused]] std::string_view devicename) {}
+
+    [[nodiscard]] auto write(const std::ranges::sized_range auto& buffer)
+        -> std::expected<std::size_t, std::pair<int, std::string>> {
+        auto count = std::min(std::ranges::size(buffer), max_write);
+        writes.emplace_back(std::ranges::begin(buffer), std::ranges::begin(buffer) + count);
+        return count;
+    }
+
+    std::vector<std::vector<std::uint8_t>> writes;
+    std::size_t max_write = std::numeric_limits<std::size_t>::max();
+};
+
+// Frames a byte stream and returns the sequence numbers of its frames.
+std::vector<std::uint8_t> sequences(std::span<const std::uint8_t> stream) {
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto span = std::span<std::uint8_t>(buffer);
+    auto framer = create_framer(&span);
+    auto seqs = std::vector<std::uint8_t>{};
+    framer.push_bytes(stream, [&](const Framer::ParseResult& result) {
+        REQUIRE(result.has_value());
+        seqs.push_back(result->seq);
+    });
+    return seqs;
+}
+
+}  // namespace
+
+SCENARIO("Batched Mavlink link writing", "[mavlink][link_writer]") {
+    GIVEN("A link writer with room for a few frames and a 10 ms deadline") {
+        auto device = std::make_shared<RecordingUART>("");
+        auto port = uart::UART<RecordingUART>(device);
+        auto writer = LinkWriter<RecordingUART, 128>(port, 1, 1, 10ms);
+        auto start = LinkWriter<RecordingUART, 128>::Clock::time_point{} + 1000s;
+        auto hb = Heartbeat{};
+        hb.type.value = 2;
+
+        WHEN("frames are written before the deadline") {
+            auto first = writer.write(hb, start);
+            auto second = writer.write(Attitude{}, start + 1ms);
+
+            THEN("they are batched without touching the UART") {
+                REQUIRE(first == 0U);
+                REQUIRE(second == 0U);
+                CHECK(device->writes.empty());
+                CHECK(writer.stats().frames == 2);
+                CHECK(writer.sequence() == 2);
+            }
+
+            AND_WHEN("the deadline passes") {
+                auto flushed = writer.poll(start + 10ms);
+
+                THEN("the batch goes out in one write with consecutive sequence numbers") {
+                    REQUIRE(flushed.has_value());
+                    CHECK(*flushed > 0);
+                    REQUIRE(device->writes.size() == 1);
+                    CHECK(writer.pending().empty());
+                    CHECK(writer.stats().writes == 1);
+                    CHECK(writer.stats().bytes == *flushed);
+                    CHECK(sequences(device->writes[0]) == std::vector<std::uint8_t>{0, 1});
+                }
+            }
+        }
+
+        WHEN("more frames are written than the batch holds") {
+            for (auto i : std::views::iota(0, 10)) {
+                REQUIRE(writer.write(hb, start + std::chrono::microseconds{i}).has_value());
+            }
+
+            THEN("full batches are flushed as they fill up") {
+                REQUIRE_FALSE(device->writes.empty());
+                auto stream = std::vector<std::uint8_t>{};
+                for (const auto& write : device->writes) {
+                    stream.insert(stream.end(), write.begin(), write.end());
+                }
+                stream.insert(stream.end(), writer.pending().begin(), writer.pending().end());
+                CHECK(sequences(stream) == std::vector<std::uint8_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+            }
+        }
+
+        WHEN("the UART writes short") {
+            device->max_write = 5;
+            REQUIRE(writer.write(hb, start).has_value());
+            auto pending = writer.pending().size();
+            auto flushed = writer.flush();
+
+            THEN("the writer keeps writing until the batch is out") {
+                REQUIRE(flushed == pending);
+                CHECK(device->writes.size() == (pending + 4) / 5);
+                CHECK(writer.pending().empty());
+            }
+        }
+    }
+
+    GIVEN("A link writer with a signer") {
+        auto device = std::make_shared<RecordingUART>("");
+        auto port = uart::UART<RecordingUART>(device);
+        auto key = SecretKey{};
+        key.fill(0x42);
+        auto signer = Signer(key, 1, 1000);
+        auto writer = LinkWriter<RecordingUART>(port, 1, 1, 10ms, &signer);
+
+        WHEN("a frame is written and flushed") {
+            REQUIRE(writer.write(Heartbeat{}, {}).has_value());
+            REQUIRE(writer.flush().has_value());
+
+            THEN("it is signed") {
+                REQUIRE(device->writes.size() == 1);
+                CHECK(device->writes[0][2] == IncompatFlagSigned);
+                CHECK(signer.timestamp() == 1001);
+            }
+        }
+    }
+}
@@ -0,0 +1,60 @@
+#include <cstdint>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mavlink/message_registry.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/autopilot_version.hpp"
+#include "mavlink/payloads/command_long.hpp"
+#include "mavlink/payloads/common_messages.hpp"
+#include "mavlink/payloads/heartbeat.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+SCENARIO("Compile-time message registry", "[mavlink][registry]") {
+    GIVEN("A registry declared out of msgid order") {
+        using Registry = MessageRegistry<AutopilotVersion, Attitude, Heartbeat>;
+
+        THEN("the entries are sorted by msgid") {
+            STATIC_REQUIRE(Registry::Entries[0].msgid == Heartbeat::MessageId);
+            STATIC_REQUIRE(Registry::Entries[1].msgid == Attitude::MessageId);
+            STATIC_REQUIRE(Registry::Entries[2].msgid == AutopilotVersion::MessageId);
+        }
+
+        THEN("registered messages are found with their CRC extra and payload lengths") {
+            constexpr auto heartbeat = Registry::find(Heartbeat::MessageId);
+            STATIC_REQUIRE(heartbeat.has_value());
+            STATIC_REQUIRE(heartbeat->crc_extra == 50);
+            STATIC_REQUIRE(heartbeat->min_length == 9);
+            STATIC_REQUIRE(heartbeat->max_length == 9);
+
+            constexpr auto version = Registry::find(AutopilotVersion::MessageId);
+            STATIC_REQUIRE(version.has_value());
+            STATIC_REQUIRE(version->min_length == 60);
+            STATIC_REQUIRE(version->max_length == 78);
+        }
+
+        THEN("unregistered messages are not found") {
+            CHECK_FALSE(Registry::find(1).has_value());
+            CHECK_FALSE(Registry::find(0xFFFFFF).has_value());
+        }
+    }
+
+    GIVEN("The common message registry") {
+        THEN("every library payload is registered") {
+            CHECK(CommonMessages::Entries.size() == 27);
+            CHECK(CommonMessages::find(Attitude::MessageId)->crc_extra == 39);
+        }
+
+        THEN("the target fields of addressed messages are located") {
+            constexpr auto command = CommonMessages::find(CommandLong::MessageId);
+            STATIC_REQUIRE(command->target_system_offset == 30);
+            STATIC_REQUIRE(command->target_component_offset == 31);
+
+            constexpr auto heartbeat = CommonMessages::find(Heartbeat::MessageId);
+            STATIC_REQUIRE_FALSE(heartbeat->target_system_offset.has_value());
+            STATIC_REQUIRE_FALSE(heartbeat->target_component_offset.has_value());
+        }
+    }
+}
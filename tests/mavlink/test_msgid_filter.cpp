@@ -0,0 +1,198 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "frame_stream.hpp"
+#include "mavlink/framer.hpp"
+#include "mavlink/msgid_filter.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/autopilot_version.hpp"
+#include "mavlink/payloads/common_messages.hpp"
+#include "mavlink/payloads/heartbeat.hpp"
+#include "mavlink/serializer.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+// Four rounds of a Heartbeat, an Attitude and an AutopilotVersion, numbered in sequence.
+std::vector<std::uint8_t> make_stream() {
+    auto stream = std::vector<std::uint8_t>{0x00, 0x11};
+    auto seq = std::uint8_t{0};
+    for (auto round = 0; round < 4; ++round) {
+        append_frame(stream, Heartbeat{}, seq++);
+        append_frame(stream, Attitude{}, seq++);
+        auto version = AutopilotVersion{};
+        version.uid.value = 0x0102030405060708;
+        append_frame(stream, version, seq++);
+    }
+    return stream;
+}
+
+}  // namespace
+
+SCENARIO("Mavlink msgid filter", "[mavlink][filter]") {
+    GIVEN("A filter built from a list of msgids across several pages") {
+        auto filter = MsgidFilter{0, 30, 255, 256, 12900, 0xFFFFFF};
+
+        THEN("exactly the listed msgids are allowed") {
+            CHECK(filter.contains(0));
+            CHECK(filter.contains(30));
+            CHECK(filter.contains(255));
+            CHECK(filter.contains(256));
+            CHECK(filter.contains(12900));
+            CHECK(filter.contains(0xFFFFFF));
+            CHECK_FALSE(filter.contains(1));
+            CHECK_FALSE(filter.contains(257));
+            CHECK_FALSE(filter.contains(12901));
+            CHECK_FALSE(filter.contains(0x010000));
+        }
+
+        WHEN("another msgid is allowed") {
+            filter.allow(148);
+            filter.allow(0x123456);
+
+            THEN("it is allowed as well") {
+                CHECK(filter.contains(148));
+                CHECK(filter.contains(0x123456));
+                CHECK(filter.contains(12900));
+            }
+        }
+    }
+
+    GIVEN("Filters built from payload types and from a message registry") {
+        auto by_type = MsgidFilter::of<Heartbeat, Attitude>();
+        auto by_registry = MsgidFilter{MessageRegistry<Heartbeat, Attitude>::Entries};
+        auto empty = MsgidFilter{};
+
+        THEN("they allow the same messages") {
+            for (auto msgid : {Heartbeat::MessageId, Attitude::MessageId}) {
+                CHECK(by_type.contains(msgid));
+                CHECK(by_registry.contains(msgid));
+                CHECK_FALSE(empty.contains(msgid));
+            }
+            CHECK_FALSE(by_type.contains(AutopilotVersion::MessageId));
+            CHECK_FALSE(by_registry.contains(AutopilotVersion::MessageId));
+        }
+    }
+}
+
+SCENARIO("Mavlink framing with a msgid filter", "[mavlink][framer][filter]") {
+    GIVEN("A framer that only yields Attitude frames") {
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto buffer_span = std::span<std::uint8_t>(buffer);
+        const auto filter = MsgidFilter::of<Attitude>();
+        auto framer = create_framer(&buffer_span, FramerOptions{.messages = CommonMessages::Entries, .filter = filter});
+        const auto stream = make_stream();
+
+        auto results = std::vector<Framer::ParseResult>{};
+        auto visitor = [&](const Framer::ParseResult& result) { results.push_back(result); };
+        auto check_results = [&] {
+            REQUIRE(results.size() == 4);
+            for (auto i = std::size_t{0}; i < results.size(); ++i) {
+                REQUIRE(results[i].has_value());
+                CHECK(results[i]->msgid == Attitude::MessageId);
+                CHECK(results[i]->seq == 3 * i + 1);
+            }
+            CHECK(framer.filtered() == 8);
+        };
+
+        WHEN("the stream is pushed byte by byte") {
+            for (auto b : stream) {
+                if (auto result = framer.push_byte(b)) {
+                    results.push_back(*result);
+                }
+            }
+
+            THEN("the other frames are only counted") {
+                check_results();
+            }
+        }
+
+        WHEN("the stream is pushed as one chunk") {
+            framer.push_bytes(stream, visitor);
+
+            THEN("the other frames are only counted") {
+                check_results();
+            }
+        }
+
+        WHEN("the stream is pushed in chunks that split headers and skipped payloads") {
+            auto chunk_size = std::size_t{7};
+            for (auto offset = std::size_t{0}; offset < stream.size(); offset += chunk_size) {
+                framer.push_bytes(std::span(stream).subspan(offset, std::min(chunk_size, stream.size() - offset)),
+                                  visitor);
+            }
+
+            THEN("the other frames are only counted") {
+                check_results();
+            }
+        }
+
+        WHEN("byte-by-byte and bulk pushes are mixed in the middle of a skipped frame") {
+            auto split = std::size_t{2 + 5};  // inside the header of the first Heartbeat
+            for (auto b : std::span(stream).first(split)) {
+                if (auto result = framer.push_byte(b)) {
+                    results.push_back(*result);
+                }
+            }
+            framer.push_bytes(std::span(stream).subspan(split), visitor);
+
+            THEN("the stream is framed as if it had been pushed at once") {
+                check_results();
+            }
+        }
+    }
+    GIVEN("A framer that only yields Attitude frames, and noise with false start markers of other msgids") {
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto buffer_span = std::span<std::uint8_t>(buffer);
+        const auto filter = MsgidFilter::of<Attitude>();
+        auto framer = create_framer(&buffer_span, FramerOptions{.messages = CommonMessages::Entries, .filter = filter});
+
+        // a header of an unknown msgid, then one of Heartbeat whose frame would swallow the start of the next Attitude
+        auto stream = std::vector<std::uint8_t>{MagicV2, 9, 0, 0, 0, 1, 1, 0x34, 0x12, 0x00};
+        append_frame(stream, Attitude{}, 0);
+        stream.insert(stream.end(), {MagicV2, 9, 0, 0, 0, 1, 1, 0x00, 0x00, 0x00});
+        append_frame(stream, Attitude{}, 1);
+
+        auto results = std::vector<Framer::ParseResult>{};
+        auto check_results = [&] {
+            REQUIRE(results.size() == 3);
+            REQUIRE(results[0].has_value());
+            CHECK(results[0]->seq == 0);
+            REQUIRE_FALSE(results[1].has_value());
+            CHECK(results[1].error().first == MavlinkError::InvalidChecksum);
+            REQUIRE(results[2].has_value());
+            CHECK(results[2]->seq == 1);
+            CHECK(framer.filtered() == 0);
+        };
+
+        WHEN("the stream is pushed byte by byte") {
+            for (auto b : stream) {
+                if (auto result = framer.push_byte(b)) {
+                    results.push_back(*result);
+                }
+                while (auto result = framer.rescan()) {
+                    results.push_back(*result);
+                }
+            }
+
+            THEN("the false headers are not trusted and the frames behind them are found") {
+                check_results();
+            }
+        }
+
+        WHEN("the stream is pushed as one chunk") {
+            framer.push_bytes(stream, [&](const Framer::ParseResult& result) { results.push_back(result); });
+
+            THEN("the false headers are not trusted and the frames behind them are found") {
+                check_results();
+            }
+        }
+    }
+}
@@ -0,0 +1,145 @@
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mavlink/framer.hpp"
+#include "mavlink/outbound_queue.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/autopilot_version.hpp"
+#include "mavlink/payloads/command_long.hpp"
+#include "mavlink/payloads/heartbeat.hpp"
+#include "mavlink/payloads/param_value.hpp"
+#include "mavlink/serializer.hpp"
+#include "uart/settings.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+using namespace std::chrono_literals;
+
+namespace {
+
+using Queue = OutboundQueue<4>;
+
+// Sends whatever the queue admits and returns the msgids of the sent frames.
+std::vector<std::uint32_t> send(Queue& queue, Queue::Clock::time_point now) {
+    auto msgids = std::vector<std::uint32_t>{};
+    queue.send(now, [&](std::span<const std::uint8_t> frame) { msgids.push_back(parse_frame(frame).msgid); });
+    return msgids;
+}
+
+}  // namespace
+
+SCENARIO("Mavlink outbound scheduling", "[mavlink][outbound_queue]") {
+    GIVEN("A queue on a 57600 baud 8N1 link") {
+        auto queue = Queue{uart::BaudRate::b57600};
+        auto start = Queue::Clock::time_point{} + 1000s;
+
+        THEN("a character takes ten bit periods on the wire") {
+            CHECK(queue.wire_time(576) == 100ms);
+        }
+
+        WHEN("bulk, telemetry and command frames are pushed in that order") {
+            REQUIRE(queue.push(ParamValue{}, 1, 1, 0, OutboundPriority::Bulk, start));
+            REQUIRE(queue.push(Attitude{}, 1, 1, 1, OutboundPriority::Telemetry, start));
+            REQUIRE(queue.push(CommandLong{}, 1, 1, 2, OutboundPriority::Command, start));
+
+            THEN("they are sent highest priority first") {
+                CHECK(send(queue, start) == std::vector<std::uint32_t>{CommandLong::MessageId, Attitude::MessageId,
+                                                                      ParamValue::MessageId});
+                CHECK(queue.size() == 0);
+                CHECK(queue.stats().sent == 3);
+            }
+        }
+
+        WHEN("attitudes of one system are pushed with coalescing") {
+            auto att = Attitude{};
+            for (auto i : std::views::iota(0, 3)) {
+                att.time_boot_ms.value = static_cast<std::uint32_t>(i + 1);
+                REQUIRE(queue.push(att, 1, 1, 0, OutboundPriority::Telemetry, start, CoalescePolicy::Replace));
+            }
+            REQUIRE(queue.push(att, 2, 1, 0, OutboundPriority::Telemetry, start, CoalescePolicy::Replace));
+
+            THEN("only the newest per system is pending") {
+                CHECK(queue.size() == 2);
+                CHECK(queue.stats().coalesced == 2);
+
+                auto frames = std::vector<std::vector<std::uint8_t>>{};
+                queue.send(start, [&](std::span<const std::uint8_t> frame) {
+                    frames.emplace_back(frame.begin(), frame.end());
+                });
+                REQUIRE(frames.size() == 2);
+                CHECK(parse_frame(frames[0]).sysid == 1);
+                CHECK(parse_frame(frames[0]).payload[0] == 3);
+            }
+        }
+
+        WHEN("the queue is full of bulk frames and a command is pushed") {
+            for (auto seq : std::views::iota(0, 4)) {
+                REQUIRE(queue.push(ParamValue{}, 1, 1, static_cast<std::uint8_t>(seq), OutboundPriority::Bulk, start));
+            }
+            auto command = queue.push(CommandLong{}, 1, 1, 4, OutboundPriority::Command, start);
+            auto bulk = queue.push(ParamValue{}, 1, 1, 5, OutboundPriority::Bulk, start);
+
+            THEN("the oldest bulk frame makes room for the command, but not for more bulk") {
+                CHECK(command);
+                CHECK_FALSE(bulk);
+                CHECK(queue.stats().evicted == 1);
+                CHECK(queue.stats().rejected == 1);
+                CHECK(send(queue, start).front() == CommandLong::MessageId);
+            }
+        }
+
+        WHEN("more frames are pushed than the line budget admits at once") {
+            auto burst_queue = Queue{uart::BaudRate::b57600, 0};
+            auto version = AutopilotVersion{};
+            version.uid2.value.back() = 1;
+            for (auto seq : std::views::iota(0, 4)) {
+                REQUIRE(burst_queue.push(version, 1, 1, static_cast<std::uint8_t>(seq), OutboundPriority::Bulk, start));
+            }
+
+            THEN("only a burst of one full frame's line time is sent, and the rest once the line has had time") {
+                CHECK(send(burst_queue, start).size() == 3);
+                CHECK(send(burst_queue, start).empty());
+                CHECK(send(burst_queue, start + 1s).size() == 1);
+            }
+        }
+
+        WHEN("telemetry waits longer than its maximum age") {
+            queue.set_max_age(OutboundPriority::Telemetry, 100ms);
+            REQUIRE(queue.push(Attitude{}, 1, 1, 0, OutboundPriority::Telemetry, start));
+            REQUIRE(queue.push(Attitude{}, 2, 1, 0, OutboundPriority::Telemetry, start + 150ms));
+
+            THEN("the stale frame is dropped instead of sent") {
+                CHECK(send(queue, start + 200ms).size() == 1);
+                CHECK(queue.stats().expired == 1);
+            }
+        }
+
+        WHEN("spans that are not exactly one frame are pushed") {
+            auto buffer = std::array<std::uint8_t, 280>{};
+            auto length = serialize(Attitude{}, 1, 1, 0, buffer);
+            REQUIRE(length.has_value());
+            auto frame = std::span<const std::uint8_t>(buffer).first(*length);
+            auto v1_frame = std::array<std::uint8_t, 8>{MagicV1, 0, 0, 1, 1, 0, 0, 0};
+
+            THEN("short, truncated and overlong spans are rejected, whole frames accepted") {
+                CHECK_FALSE(queue.push(std::span<const std::uint8_t>{}, OutboundPriority::Telemetry, start));
+                CHECK_FALSE(queue.push(frame.first(8), OutboundPriority::Telemetry, start));
+                CHECK_FALSE(queue.push(frame.first(HeaderLengthV2 - 1), OutboundPriority::Telemetry, start));
+                CHECK_FALSE(queue.push(frame.first(HeaderLengthV2 + 4), OutboundPriority::Telemetry, start));
+                CHECK_FALSE(queue.push(frame.first(*length - 1), OutboundPriority::Telemetry, start));
+                CHECK_FALSE(queue.push(std::span<const std::uint8_t>(buffer).first(*length + 1),
+                                       OutboundPriority::Telemetry, start));
+                CHECK(queue.size() == 0);
+                CHECK(queue.push(frame, OutboundPriority::Telemetry, start));
+                CHECK(queue.push(v1_frame, OutboundPriority::Telemetry, start));
+                CHECK(queue.size() == 2);
+            }
+        }
+    }
+}
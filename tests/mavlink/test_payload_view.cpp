@@ -0,0 +1,103 @@
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mavlink/deserializer.hpp"
+#include "mavlink/dispatcher.hpp"
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/autopilot_version.hpp"
+#include "mavlink/payloads/sys_status.hpp"
+#include "mavlink/serializer.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+static_assert(ViewPayload<ViewAttitude>);
+static_assert(!ViewPayload<LazyAttitude>);
+static_assert(ViewAttitude::CrcExtra() == Attitude::CrcExtra());
+static_assert(MaxFrameLength<ViewAttitude> == MaxFrameLength<Attitude>);
+
+SCENARIO("Lazy Mavlink payload views", "[mavlink][view]") {
+    GIVEN("A serialized Attitude") {
+        auto att = Attitude{};
+        att.time_boot_ms.value = 0x12345678;
+        att.roll.value = 1.0f;
+        att.yaw.value = -0.5f;
+        att.yawspeed.value = 0.25f;
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto length = serialize(att, 1, 1, 0, buffer);
+        REQUIRE(length.has_value());
+        auto view = parse_frame(std::span<const std::uint8_t>(buffer).first(*length));
+
+        WHEN("it is deserialized into a view payload") {
+            auto result = deserialize<ViewAttitude>(view);
+
+            THEN("the fields view the payload in place and decode on access") {
+                REQUIRE(result.has_value());
+                CHECK(result->time_boot_ms.bytes.data() == view.payload.data());
+                CHECK(result->yaw.bytes.data() == view.payload.data() + 12);
+                CHECK(result->time_boot_ms.value() == 0x12345678);
+                CHECK(result->roll.value() == 1.0f);
+                CHECK(result->pitch.value() == 0.0f);
+                CHECK(result->yaw.value() == -0.5f);
+                CHECK(result->yawspeed.value() == 0.25f);
+            }
+        }
+
+        WHEN("it is dispatched to a view payload") {
+            auto yaw = 0.0f;
+            auto dispatched = Dispatcher<ViewAttitude>::dispatch(view, [&](const auto& result) {
+                REQUIRE(result.has_value());
+                yaw = result->yaw.value();
+            });
+
+            THEN("the visitor reads the field from the view") {
+                CHECK(dispatched);
+                CHECK(yaw == -0.5f);
+            }
+        }
+    }
+
+    GIVEN("A zero-truncated SysStatus payload") {
+        auto sys = SysStatus{};
+        sys.onboard_control_sensors_present.value = 0x01020304;
+        sys.load.value = 0x0201;
+        auto payload = std::array<std::uint8_t, 31>{};
+        serialize_payload(sys, payload);
+
+        WHEN("only part of a field is present") {
+            auto message = ViewSysStatus{};
+            bind_payload(std::span<const std::uint8_t>(payload).first(13), message);
+
+            THEN("the missing bytes and fields read as zero") {
+                CHECK(message.onboard_control_sensors_present.value() == 0x01020304);
+                CHECK(message.load.bytes.size() == 1);
+                CHECK(message.load.value() == 0x0001);
+                CHECK(message.voltage_battery.bytes.empty());
+                CHECK(message.voltage_battery.value() == 0);
+                CHECK(message.battery_remaining.value() == 0);
+            }
+        }
+    }
+
+    GIVEN("An AutopilotVersion with array fields") {
+        auto version = AutopilotVersion{};
+        version.flight_custom_version.value = {1, 2, 3, 4, 5, 6, 7, 8};
+        version.uid2.value[17] = 0xAA;
+        auto payload = std::array<std::uint8_t, 78>{};
+        serialize_payload(version, payload);
+
+        WHEN("it is bound to a view payload") {
+            auto message = ViewAutopilotVersion{};
+            bind_payload(std::span<const std::uint8_t>(payload), message);
+
+            THEN("the arrays are decoded whole") {
+                CHECK(message.flight_custom_version.value() == std::array<std::uint8_t, 8>{1, 2, 3, 4, 5, 6, 7, 8});
+                CHECK(message.uid2.value()[17] == 0xAA);
+            }
+        }
+    }
+}
@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/command_long.hpp"
+#include "mavlink/payloads/common_messages.hpp"
+#include "mavlink/payloads/heartbeat.hpp"
+#include "mavlink/router.hpp"
+#include "mavlink/serializer.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+// A serialized frame, framed back into a view over its own bytes.
+struct ReceivedFrame {
+    std::vector<std::uint8_t> bytes;
+    MessageView view;
+};
+
+template <typename MessageT>
+ReceivedFrame receive(const MessageT& message, std::uint8_t sysid, std::uint8_t compid) {
+    auto frame = ReceivedFrame{std::vector<std::uint8_t>(280), {}};
+    auto len = serialize(message, sysid, compid, 0, frame.bytes);
+    REQUIRE(len.has_value());
+    frame.bytes.resize(*len);
+    frame.view = parse_frame(frame.bytes);
+    return frame;
+}
+
+CommandLong make_command(std::uint8_t target_system, std::uint8_t target_component) {
+    auto command = CommandLong{};
+    command.command.value = 400;
+    command.param1.value = 1.0f;
+    command.target_system.value = target_system;
+    command.target_component.value = target_component;
+    command.confirmation.value = 1;
+    return command;
+}
+
+// Lets a router hear a Heartbeat from a system/component on a link.
+template <typename RouterT>
+void hear(RouterT& router, std::uint8_t sysid, std::uint8_t compid, std::size_t link) {
+    [[maybe_unused]] auto links = router.route(receive(Heartbeat{}, sysid, compid).view, link);
+}
+
+}  // namespace
+
+SCENARIO("Mavlink frame routing", "[mavlink][router]") {
+    GIVEN("A router that has heard an autopilot, a companion computer and a ground station") {
+        auto router = Router<8>{4, CommonMessages::Entries};
+        // autopilot (1, 1) on link 0, companion (1, 191) on link 1, ground station (255, 190) on link 2
+        hear(router, 1, 1, 0);
+        hear(router, 1, 191, 1);
+        hear(router, 255, 190, 2);
+
+        THEN("the routes are learned") {
+            CHECK(router.routes().size() == 3);
+            CHECK(router.links_to(1) == Router<8>::LinkSet{0b0011});
+            CHECK(router.links_to(1, 191) == Router<8>::LinkSet{0b0010});
+            CHECK(router.links_to(42).none());
+        }
+
+        WHEN("a message without a target arrives") {
+            auto links = router.route(receive(Heartbeat{}, 1, 1).view, 0);
+
+            THEN("it is broadcast to every other link") { CHECK(links == Router<8>::LinkSet{0b1110}); }
+        }
+
+        WHEN("a command for the companion computer arrives from the ground station") {
+            auto links = router.route(receive(make_command(1, 191), 255, 190).view, 2);
+
+            THEN("it goes only to the companion computer's link") { CHECK(links == Router<8>::LinkSet{0b0010}); }
+        }
+
+        WHEN("a command for any component of system 1 arrives") {
+            auto links = router.route(receive(make_command(1, 0), 255, 190).view, 2);
+
+            THEN("it goes to every link system 1 was heard on") { CHECK(links == Router<8>::LinkSet{0b0011}); }
+        }
+
+        WHEN("a command for all systems arrives") {
+            auto links = router.route(receive(make_command(0, 0), 255, 190).view, 2);
+
+            THEN("it is broadcast to every other link") { CHECK(links == Router<8>::LinkSet{0b1011}); }
+        }
+
+        WHEN("a command for an unknown system arrives") {
+            auto links = router.route(receive(make_command(42, 1), 255, 190).view, 2);
+
+            THEN("it is not forwarded") { CHECK(links.none()); }
+        }
+
+        WHEN("a frame is forwarded") {
+            auto frame = receive(make_command(1, 1), 255, 190);
+            auto sent = std::vector<std::pair<std::size_t, std::vector<std::uint8_t>>>{};
+            auto count = router.forward(frame.view, 2, [&](std::size_t link, std::span<const std::uint8_t> bytes) {
+                sent.emplace_back(link, std::vector<std::uint8_t>(bytes.begin(), bytes.end()));
+            });
+
+            THEN("the original frame bytes are handed to the sink once per output link") {
+                REQUIRE(count == 1);
+                REQUIRE(sent.size() == 1);
+                CHECK(sent[0].first == 0);
+                CHECK(sent[0].second == frame.bytes);
+            }
+        }
+
+        WHEN("a frame arrives on a link outside the router's range") {
+            auto links = router.route(receive(Heartbeat{}, 3, 1).view, 4);
+
+            THEN("it is neither learned nor forwarded") {
+                CHECK(links.none());
+                CHECK(router.links_to(3).none());
+            }
+        }
+    }
+
+    GIVEN("A router with a full route table") {
+        auto router = Router<4, 2>{2};
+        hear(router, 1, 1, 0);
+        hear(router, 2, 1, 0);
+
+        WHEN("another system is heard") {
+            hear(router, 3, 1, 1);
+
+            THEN("it is not learned") {
+                CHECK(router.routes().size() == 2);
+                CHECK(router.links_to(3).none());
+            }
+        }
+    }
+}
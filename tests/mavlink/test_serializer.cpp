@@ -0,0 +1,221 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mavlink/deserializer.hpp"
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/autopilot_version.hpp"
+#include "mavlink/payloads/heartbeat.hpp"
+#include "mavlink/payloads/sys_status.hpp"
+#include "mavlink/serializer.hpp"
+#include "mavlink/signing.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+/// @brief Payload whose second field is not naturally aligned at its wire offset.
+template <typename Traits>
+struct Misaligned_T {
+    static constexpr std::uint32_t MessageId = 0xFFFF00;
+    static constexpr std::string_view MessageName = "MISALIGNED";
+
+    typename Traits::template Field<std::uint8_t> flag;
+    typename Traits::template Field<std::uint32_t> value;
+
+    static constexpr std::uint8_t CrcExtra() { return calculate_crc_extra<Misaligned_T<Traits>>(); }
+};
+
+using Misaligned = Misaligned_T<TxTraits>;
+using LazyMisaligned = Misaligned_T<RxTraits>;
+
+}  // namespace
+
+static_assert(MaxFrameLength<Heartbeat> == 21);
+static_assert(MaxSignedFrameLength<Heartbeat> == 34);
+static_assert(MaxFrameLength<Attitude> == 40);
+static_assert(MaxFrameLength<AutopilotVersion> == 10 + 78 + 2);
+
+static_assert(WireCompatible<Heartbeat>);
+static_assert(WireCompatible<Attitude>);
+static_assert(WireCompatible<LazyAttitude>);
+static_assert(WireCompatible<SysStatus>);  // 31 byte payload, tail padded to 32
+static_assert(WireCompatible<AutopilotVersion>);
+static_assert(!WireCompatible<Misaligned>);
+static_assert(!WireCompatible<LazyMisaligned>);
+
+SCENARIO("Mavlink serialization into exactly sized buffers", "[mavlink][serializer]") {
+    GIVEN("A Heartbeat") {
+        auto hb = Heartbeat{};
+        hb.custom_mode.value = 0x01020304;
+        hb.type.value = 2;
+        hb.mavlink_version.value = 3;
+
+        auto reference = std::array<std::uint8_t, 280>{};
+        auto reference_length = serialize(hb, 1, 1, 7, reference);
+        REQUIRE(reference_length.has_value());
+
+        WHEN("it is serialized into a buffer of MaxFrameLength bytes") {
+            auto buffer = std::array<std::uint8_t, MaxFrameLength<Heartbeat>>{};
+            auto length = serialize(hb, 1, 1, 7, std::span(buffer));
+
+            THEN("the frame matches the one serialized into a 280 byte buffer") {
+                REQUIRE(length == *reference_length);
+                CHECK(std::ranges::equal(std::span(buffer).first(length),
+                                         std::span(reference).first(*reference_length)));
+            }
+        }
+
+        WHEN("it is serialized into an exactly sized dynamic span") {
+            auto buffer = std::array<std::uint8_t, MaxFrameLength<Heartbeat>>{};
+            auto length = serialize(hb, 1, 1, 7, std::span<std::uint8_t>(buffer));
+
+            THEN("it succeeds") {
+                REQUIRE(length.has_value());
+                CHECK(*length == *reference_length);
+            }
+        }
+
+        WHEN("it is serialized into a dynamic span one byte too short") {
+            auto buffer = std::array<std::uint8_t, MaxFrameLength<Heartbeat>>{};
+            auto length = serialize(hb, 1, 1, 7, std::span<std::uint8_t>(buffer).first(buffer.size() - 1));
+
+            THEN("it is rejected") {
+                REQUIRE_FALSE(length.has_value());
+                CHECK(length.error() == MavlinkError::BufferOverrun);
+            }
+        }
+
+        WHEN("it is signed into a buffer of MaxSignedFrameLength bytes") {
+            auto key = SecretKey{};
+            key.fill(0x42);
+            auto signer = Signer(key, 1, 1000);
+            auto reference_signer = Signer(key, 1, 1000);
+            auto signed_reference = std::array<std::uint8_t, 280>{};
+            auto signed_reference_length = serialize(hb, 1, 1, 7, signed_reference, reference_signer);
+            REQUIRE(signed_reference_length.has_value());
+
+            auto buffer = std::array<std::uint8_t, MaxSignedFrameLength<Heartbeat>>{};
+            auto length = serialize(hb, 1, 1, 7, std::span(buffer), signer);
+
+            THEN("the signed frame matches the one serialized into a 280 byte buffer") {
+                REQUIRE(length == *signed_reference_length);
+                CHECK(std::ranges::equal(std::span(buffer).first(length),
+                                         std::span(signed_reference).first(*signed_reference_length)));
+            }
+        }
+    }
+
+    GIVEN("A batch buffer and several messages") {
+        auto hb = Heartbeat{};
+        hb.type.value = 2;
+        auto att = Attitude{};
+        att.roll.value = 0.5f;
+
+        auto batch = std::array<std::uint8_t, 2 * MaxFrameLength<Heartbeat> + MaxFrameLength<Attitude>>{};
+        auto remaining = std::span<std::uint8_t>(batch);
+
+        WHEN("the frames are written back to back") {
+            auto used = serialize(hb, 1, 1, 0, remaining.first<MaxFrameLength<Heartbeat>>());
+            remaining = remaining.subspan(used);
+            used = serialize(att, 1, 1, 1, remaining.first<MaxFrameLength<Attitude>>());
+            remaining = remaining.subspan(used);
+            used = serialize(hb, 1, 1, 2, remaining.first<MaxFrameLength<Heartbeat>>());
+            remaining = remaining.subspan(used);
+            auto stream = std::span<const std::uint8_t>(batch).first(batch.size() - remaining.size());
+
+            THEN("the batch frames back into the same messages") {
+                auto framer_buffer = std::array<std::uint8_t, 280>{};
+                auto framer_span = std::span<std::uint8_t>(framer_buffer);
+                auto framer = create_framer(&framer_span);
+                auto msgids = std::vector<std::uint32_t>{};
+                framer.push_bytes(stream, [&](const Framer::ParseResult& result) {
+                    REQUIRE(result.has_value());
+                    msgids.push_back(result->msgid);
+                });
+                CHECK(msgids ==
+                      std::vector<std::uint32_t>{Heartbeat::MessageId, Attitude::MessageId, Heartbeat::MessageId});
+            }
+        }
+    }
+}
+
+SCENARIO("Mavlink payload copies", "[mavlink][serializer]") {
+    GIVEN("A SysStatus, whose payload is copied with a single memcpy") {
+        auto sys = SysStatus{};
+        sys.onboard_control_sensors_present.value = 0x01020304;
+        sys.load.value = 500;
+        sys.current_battery.value = -100;
+        sys.errors_count4.value = 6;
+        sys.battery_remaining.value = 80;
+
+        WHEN("its payload is serialized in bulk and field by field") {
+            auto bulk = std::array<std::uint8_t, 31>{};
+            auto fields = std::array<std::uint8_t, 31>{};
+            auto bulk_length = serialize_payload(sys, bulk);
+            auto fields_length = serialize_payload_fields(sys, fields);
+
+            THEN("both paths write the same wire bytes") {
+                CHECK(bulk_length == 31);
+                CHECK(fields_length == 31);
+                CHECK(bulk == fields);
+            }
+
+            AND_WHEN("a zero-truncated payload is deserialized in bulk and field by field") {
+                auto truncated = std::span<const std::uint8_t>(bulk).first(20);
+                auto bulk_message = LazySysStatus{};
+                bulk_message.battery_remaining.value = 99;
+                bulk_message.errors_count4.value = 99;
+                auto fields_message = LazySysStatus{};
+                deserialize_payload(truncated, bulk_message);
+                deserialize_payload_fields(truncated, fields_message);
+
+                THEN("both paths read the present fields and zero the missing ones") {
+                    CHECK(bulk_message.onboard_control_sensors_present.value == 0x01020304);
+                    CHECK(bulk_message.load.value == 500);
+                    CHECK(bulk_message.current_battery.value == -100);
+                    CHECK(bulk_message.errors_count4.value == 0);
+                    CHECK(bulk_message.battery_remaining.value == 0);
+                    CHECK(fields_message.onboard_control_sensors_present.value == 0x01020304);
+                    CHECK(fields_message.current_battery.value == -100);
+                    CHECK(fields_message.errors_count4.value == 0);
+                }
+            }
+        }
+    }
+
+    GIVEN("A payload that is not laid out like the wire, which is copied field by field") {
+        auto message = Misaligned{};
+        message.flag.value = 0xAA;
+        message.value.value = 0x11223344;
+
+        WHEN("it is serialized and framed") {
+            auto buffer = std::array<std::uint8_t, MaxFrameLength<Misaligned>>{};
+            auto length = serialize(message, 1, 1, 0, std::span(buffer));
+
+            THEN("the fields are packed without padding") {
+                REQUIRE(length == 10 + 5 + 2);
+                CHECK(buffer[10] == 0xAA);
+                CHECK(buffer[11] == 0x44);
+                CHECK(buffer[14] == 0x11);
+            }
+
+            AND_THEN("it deserializes back") {
+                auto view = MessageView{};
+                view.msgid = Misaligned::MessageId;
+                view.payload = std::span<const std::uint8_t>(buffer).subspan(10, 5);
+                auto result = deserialize<LazyMisaligned>(view);
+                REQUIRE(result.has_value());
+                CHECK(result->flag.value == 0xAA);
+                CHECK(result->value.value == 0x11223344);
+            }
+        }
+    }
+}
@@ -0,0 +1,85 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mavlink/sha256.hpp"
+
+using namespace mavlink;
+
+namespace {
+
+std::span<const std::uint8_t> as_bytes(std::string_view text) {
+    return {reinterpret_cast<const std::uint8_t*>(text.data()), text.size()};
+}
+
+// Hashes a message, feeding it to the hash in chunks of the given size.
+template <auto Compress>
+Sha256Digest hash(std::span<const std::uint8_t> message, std::size_t chunk) {
+    auto sha = Sha256<Compress>{};
+    while (!message.empty()) {
+        auto part = message.first(std::min(chunk, message.size()));
+        sha.update(part);
+        message = message.subspan(part.size());
+    }
+    return sha.finalize();
+}
+
+}  // namespace
+
+SCENARIO("SHA-256 digests", "[mavlink][signing]") {
+    GIVEN("The FIPS 180-2 test messages") {
+        constexpr auto abc = Sha256Digest{0xBA, 0x78, 0x16, 0xBF, 0x8F, 0x01, 0xCF, 0xEA, 0x41, 0x41, 0x40,
+                                          0xDE, 0x5D, 0xAE, 0x22, 0x23, 0xB0, 0x03, 0x61, 0xA3, 0x96, 0x17,
+                                          0x7A, 0x9C, 0xB4, 0x10, 0xFF, 0x61, 0xF2, 0x00, 0x15, 0xAD};
+        constexpr auto two_blocks = Sha256Digest{0x24, 0x8D, 0x6A, 0x61, 0xD2, 0x06, 0x38, 0xB8, 0xE5, 0xC0, 0x26,
+                                                 0x93, 0x0C, 0x3E, 0x60, 0x39, 0xA3, 0x3C, 0xE4, 0x59, 0x64, 0xFF,
+                                                 0x21, 0x67, 0xF6, 0xEC, 0xED, 0xD4, 0x19, 0xDB, 0x06, 0xC1};
+        constexpr auto empty = Sha256Digest{0xE3, 0xB0, 0xC4, 0x42, 0x98, 0xFC, 0x1C, 0x14, 0x9A, 0xFB, 0xF4,
+                                            0xC8, 0x99, 0x6F, 0xB9, 0x24, 0x27, 0xAE, 0x41, 0xE4, 0x64, 0x9B,
+                                            0x93, 0x4C, 0xA4, 0x95, 0x99, 0x1B, 0x78, 0x52, 0xB8, 0x55};
+
+        THEN("the portable kernel produces the published digests") {
+            CHECK(hash<sha256_compress_portable>(as_bytes("abc"), 64) == abc);
+            CHECK(hash<sha256_compress_portable>(
+                      as_bytes("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"), 64) == two_blocks);
+            CHECK(Sha256<sha256_compress_portable>{}.finalize() == empty);
+        }
+
+        THEN("the digest can be computed at compile time") {
+            constexpr auto digest = [] {
+                auto sha = Sha256<>{};
+                sha.update(std::array<std::uint8_t, 3>{'a', 'b', 'c'});
+                return sha.finalize();
+            }();
+            STATIC_CHECK(digest == abc);
+        }
+    }
+
+    GIVEN("Messages of every length around the padding boundaries") {
+        auto data = std::vector<std::uint8_t>(300);
+        for (auto i : std::views::iota(std::size_t{0}, data.size())) {
+            data[i] = static_cast<std::uint8_t>(i * 7 + 3);
+        }
+
+        THEN("the digest does not depend on how the message is split, nor on the kernel") {
+            for (auto length : std::views::iota(std::size_t{0}, data.size())) {
+                auto message = std::span<const std::uint8_t>(data).first(length);
+                auto expected = hash<sha256_compress_portable>(message, data.size());
+                REQUIRE(hash<sha256_compress_portable>(message, 1) == expected);
+                REQUIRE(hash<sha256_compress_portable>(message, 13) == expected);
+                REQUIRE(hash<sha256_compress>(message, 64) == expected);
+#if defined(AVIONICPP_SHA_NI)
+                if (sha256_sha_ni_supported()) {
+                    REQUIRE(hash<sha256_compress_sha_ni>(message, 7) == expected);
+                }
+#endif
+            }
+        }
+    }
+}
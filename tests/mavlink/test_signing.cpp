@@ -0,0 +1,236 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/common_messages.hpp"
+#include "mavlink/payloads/heartbeat.hpp"
+#include "mavlink/serializer.hpp"
+#include "mavlink/signing.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+SecretKey make_key() {
+    auto key = SecretKey{};
+    std::ranges::copy(std::views::iota(std::uint8_t{0}, std::uint8_t{32}), key.begin());
+    return key;
+}
+
+Heartbeat make_heartbeat() {
+    auto hb = Heartbeat{};
+    hb.custom_mode.value = 0xDEADBEEF;
+    hb.type.value = MavType::QUADROTOR;
+    hb.mavlink_version.value = 3;
+    return hb;
+}
+
+// Appends a signed Heartbeat from the given system to a byte stream.
+void append_signed(std::vector<std::uint8_t>& stream, Signer& signer, std::uint8_t sysid = 1) {
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto len = serialize(make_heartbeat(), sysid, 1, 0, buffer, signer);
+    REQUIRE(len.has_value());
+    stream.insert(stream.end(), buffer.begin(), buffer.begin() + *len);
+}
+
+std::vector<Framer::ParseResult> push_all(Framer& framer, std::span<const std::uint8_t> stream) {
+    auto results = std::vector<Framer::ParseResult>{};
+    framer.push_bytes(stream, [&](const Framer::ParseResult& result) { results.push_back(result); });
+    return results;
+}
+
+}  // namespace
+
+SCENARIO("Mavlink frame signing", "[mavlink][signing]") {
+    GIVEN("A signer for link 5") {
+        auto signer = Signer{make_key(), 5, 1234567};
+
+        WHEN("a Heartbeat is serialized with it") {
+            auto buffer = std::array<std::uint8_t, 280>{};
+            auto len = serialize(make_heartbeat(), 1, 1, 7, buffer, signer);
+
+            THEN("the frame carries the signed flag, link ID, timestamp and signature") {
+                // reference frame computed independently with Python's hashlib
+                constexpr auto expected = std::array<std::uint8_t, 34>{
+                    0xFD, 0x09, 0x01, 0x00, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00, 0xEF, 0xBE, 0xAD, 0xDE, 0x02, 0x00,
+                    0x00, 0x00, 0x03, 0x34, 0xB3, 0x05, 0x87, 0xD6, 0x12, 0x00, 0x00, 0x00, 0x69, 0x99, 0x0D, 0x6D,
+                    0x76, 0xC9};
+                REQUIRE(len.has_value());
+                REQUIRE(*len == expected.size());
+                CHECK(std::ranges::equal(std::span(buffer).first(*len), expected));
+                CHECK(signature_timestamp(std::span(buffer).first(*len)) == 1234567);
+            }
+
+            THEN("the timestamp advances for the next frame") { CHECK(signer.timestamp() == 1234568); }
+        }
+
+        WHEN("the clock is set behind the signer's timestamp") {
+            signer.set_timestamp(1000);
+
+            THEN("the timestamp does not move backward") { CHECK(signer.timestamp() == 1234567); }
+        }
+    }
+}
+
+SCENARIO("Mavlink signature verification in the framer", "[mavlink][signing]") {
+    GIVEN("A framer with a signature verifier and a stream of signed frames") {
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto buffer_span = std::span<std::uint8_t>(buffer);
+        auto streams = std::array<SigningStream, 4>{};
+        auto verifier = SignatureVerifier{make_key(), streams};
+        auto options = FramerOptions{CommonMessages::Entries};
+        options.signing = verifier;
+        auto framer = create_framer(&buffer_span, options);
+
+        auto signer = Signer{make_key(), 2, 5000};
+        auto stream = std::vector<std::uint8_t>{};
+        append_signed(stream, signer);
+        append_signed(stream, signer);
+
+        WHEN("the stream is pushed in one chunk") {
+            auto results = push_all(framer, stream);
+
+            THEN("both frames are yielded and the verifier tracks their timestamp") {
+                REQUIRE(results.size() == 2);
+                CHECK(results[0].has_value());
+                CHECK(results[1].has_value());
+                CHECK(verifier.timestamp() == 5001);
+            }
+        }
+
+        WHEN("the stream is pushed byte by byte") {
+            auto accepted = 0;
+            for (auto b : stream) {
+                if (auto result = framer.push_byte(b); result && result->has_value()) {
+                    ++accepted;
+                }
+            }
+
+            THEN("both frames are yielded") { CHECK(accepted == 2); }
+        }
+
+        WHEN("the same stream is pushed twice") {
+            [[maybe_unused]] auto first_pass = push_all(framer, stream);
+            auto results = push_all(framer, stream);
+
+            THEN("the replayed frames are rejected") {
+                REQUIRE(results.size() == 2);
+                for (const auto& result : results) {
+                    REQUIRE_FALSE(result.has_value());
+                    CHECK(result.error().first == MavlinkError::InvalidSignature);
+                }
+            }
+        }
+
+        WHEN("a signature byte is corrupted") {
+            stream.back() ^= 0x01;
+            auto results = push_all(framer, stream);
+
+            THEN("only the intact frame is yielded") {
+                REQUIRE(results.size() == 2);
+                CHECK(results[0].has_value());
+                REQUIRE_FALSE(results[1].has_value());
+                CHECK(results[1].error().first == MavlinkError::InvalidSignature);
+            }
+        }
+
+        WHEN("frames signed with another key are pushed") {
+            auto other_key = make_key();
+            other_key[0] ^= 0xFF;
+            auto other_signer = Signer{other_key, 2, 9000};
+            auto forged = std::vector<std::uint8_t>{};
+            append_signed(forged, other_signer);
+            auto results = push_all(framer, forged);
+
+            THEN("they are rejected") {
+                REQUIRE(results.size() == 1);
+                REQUIRE_FALSE(results[0].has_value());
+                CHECK(results[0].error().first == MavlinkError::InvalidSignature);
+            }
+        }
+    }
+
+    GIVEN("An unsigned frame") {
+        auto buffer = std::array<std::uint8_t, 280>{};
+        auto buffer_span = std::span<std::uint8_t>(buffer);
+        auto streams = std::array<SigningStream, 4>{};
+        auto verifier = SignatureVerifier{make_key(), streams};
+
+        auto frame = std::array<std::uint8_t, 280>{};
+        auto len = serialize(make_heartbeat(), 1, 1, 0, frame);
+        REQUIRE(len.has_value());
+        auto stream = std::span<const std::uint8_t>(frame).first(*len);
+
+        WHEN("the framer rejects unsigned messages") {
+            auto options = FramerOptions{CommonMessages::Entries};
+            options.signing = verifier;
+            auto framer = create_framer(&buffer_span, options);
+            auto results = push_all(framer, stream);
+
+            THEN("an InvalidSignature error is yielded") {
+                REQUIRE(results.size() == 1);
+                REQUIRE_FALSE(results[0].has_value());
+                CHECK(results[0].error().first == MavlinkError::InvalidSignature);
+            }
+        }
+
+        WHEN("the framer accepts unsigned messages") {
+            auto options = FramerOptions{CommonMessages::Entries};
+            options.signing = verifier;
+            options.unsigned_messages = UnsignedMessagePolicy::Accept;
+            auto framer = create_framer(&buffer_span, options);
+            auto results = push_all(framer, stream);
+
+            THEN("the frame is yielded") {
+                REQUIRE(results.size() == 1);
+                CHECK(results[0].has_value());
+            }
+        }
+    }
+}
+
+SCENARIO("Mavlink signing stream table", "[mavlink][signing]") {
+    GIVEN("A verifier with room for two streams") {
+        auto streams = std::array<SigningStream, 2>{};
+        auto verifier = SignatureVerifier{make_key(), streams, 100'000'000};
+        auto frame = [](Signer& signer, std::uint8_t sysid) {
+            auto stream = std::vector<std::uint8_t>{};
+            append_signed(stream, signer, sysid);
+            return stream;
+        };
+
+        WHEN("a new stream starts more than a minute behind the local timestamp") {
+            auto signer = Signer{make_key(), 1, 100'000'000 - SigningReplayWindow - 1};
+
+            THEN("it is rejected as stale") { CHECK_FALSE(verifier.verify(frame(signer, 1)).has_value()); }
+        }
+
+        WHEN("a new stream starts within a minute of the local timestamp") {
+            auto signer = Signer{make_key(), 1, 100'000'000 - SigningReplayWindow};
+
+            THEN("it is accepted") { CHECK(verifier.verify(frame(signer, 1)).has_value()); }
+        }
+
+        WHEN("three systems send on the same link") {
+            auto first = Signer{make_key(), 1, 100'000'000};
+            auto second = Signer{make_key(), 1, 100'000'010};
+            auto third = Signer{make_key(), 1, 100'000'020};
+            auto replay = frame(first, 1);
+            REQUIRE(verifier.verify(replay).has_value());
+            REQUIRE(verifier.verify(frame(second, 2)).has_value());
+            REQUIRE(verifier.verify(frame(third, 3)).has_value());
+
+            THEN("the oldest stream is evicted and treated as new again") {
+                CHECK(verifier.verify(replay).has_value());
+                CHECK_FALSE(verifier.verify(replay).has_value());
+            }
+        }
+    }
+}
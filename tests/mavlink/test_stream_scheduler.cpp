@@ -0,0 +1,156 @@
+#include <chrono>
+#include <cstdint>
+#include <expected>
+#include <ranges>
+#include <set>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mavlink/stream_scheduler.hpp"
+
+using namespace mavlink;
+using namespace std::chrono_literals;
+
+namespace {
+
+using Scheduler = StreamScheduler<8, 16>;
+
+// An output whose writes fail every third time.
+struct FlakyOutput {
+    std::vector<int> written;
+    int calls = 0;
+
+    std::expected<std::size_t, int> write(int message, Scheduler::Clock::time_point) {
+        if (++calls % 3 == 0) {
+            return std::unexpected(5);
+        }
+        written.push_back(message);
+        return 1;
+    }
+};
+
+// Polls the scheduler every step from start until end.
+void run_for(Scheduler& scheduler,
+             Scheduler::Clock::time_point start,
+             Scheduler::Clock::duration length,
+             Scheduler::Clock::duration step = 1ms) {
+    for (auto now = start; now < start + length; now += step) {
+        scheduler.poll(now);
+    }
+}
+
+}  // namespace
+
+SCENARIO("Periodic Mavlink stream scheduling", "[mavlink][stream_scheduler]") {
+    GIVEN("A scheduler with streams at 1 Hz, 2 Hz and 50 Hz") {
+        auto start = Scheduler::Clock::time_point{} + 1000s;
+        auto scheduler = Scheduler{start};
+        auto counts = std::vector<int>(3);
+        auto ticks = std::vector<std::vector<std::int64_t>>(3);
+        auto periods = std::vector<Scheduler::Clock::duration>{1s, 500ms, 20ms};
+        for (auto i : std::views::iota(0, 3)) {
+            auto id = scheduler.add(periods[i], [&, i](Scheduler::Clock::time_point now) {
+                ++counts[i];
+                ticks[i].push_back((now - start) / 1ms);
+            });
+            REQUIRE(id == static_cast<std::size_t>(i));
+        }
+
+        WHEN("it is polled every millisecond for ten seconds") {
+            run_for(scheduler, start, 10s);
+
+            THEN("each stream runs at its rate, on time") {
+                CHECK(counts == std::vector<int>{10, 20, 500});
+                for (auto i : std::views::iota(0, 3)) {
+                    auto stats = scheduler.stats(i);
+                    CHECK(stats.missed == 0);
+                    CHECK(stats.jitter_p99 == 0ms);
+                }
+            }
+
+            THEN("the streams are staggered so they never run in the same tick") {
+                auto all = std::set<std::int64_t>{};
+                auto total = std::size_t{0};
+                for (const auto& stream : ticks) {
+                    all.insert(stream.begin(), stream.end());
+                    total += stream.size();
+                }
+                CHECK(all.size() == total);
+            }
+        }
+
+        WHEN("it is polled only every 7 milliseconds") {
+            run_for(scheduler, start, 10s, 7ms);
+
+            THEN("the streams keep their nominal rate and report the polling lateness as jitter") {
+                CHECK(counts[2] >= 499);
+                CHECK(counts[2] <= 500);
+                auto stats = scheduler.stats(2);
+                CHECK(stats.missed == 0);
+                CHECK(stats.jitter_max > 0ms);
+                CHECK(stats.jitter_max < 7ms);
+                CHECK(stats.jitter_p50 <= stats.jitter_p99);
+            }
+        }
+
+        WHEN("it is not polled for longer than the fastest period") {
+            scheduler.poll(start);
+            scheduler.poll(start + 105ms);
+
+            THEN("the periods in between are counted as missed, not run in a burst") {
+                CHECK(counts[2] == 1);
+                CHECK(scheduler.stats(2).missed > 0);
+                CHECK(scheduler.next_due(2) > start + 105ms);
+            }
+        }
+    }
+
+    GIVEN("A stream with a period beyond the first two wheel levels") {
+        auto start = Scheduler::Clock::time_point{} + 1000s;
+        auto scheduler = Scheduler{start};
+        auto runs = std::vector<std::int64_t>{};
+        REQUIRE(scheduler.add(5000ms, [&](Scheduler::Clock::time_point now) { runs.push_back((now - start) / 1ms); })
+                    .has_value());
+
+        WHEN("it is polled for twenty seconds") {
+            run_for(scheduler, start, 20s);
+
+            THEN("it runs every five seconds, cascading down the wheel") {
+                REQUIRE(runs.size() == 4);
+                CHECK(runs[1] - runs[0] == 5000);
+                CHECK(runs[3] - runs[2] == 5000);
+            }
+        }
+    }
+
+    GIVEN("A stream writing into an output that fails now and then") {
+        auto start = Scheduler::Clock::time_point{} + 1000s;
+        auto scheduler = Scheduler{start};
+        auto output = FlakyOutput{};
+        auto id = scheduler.add(10ms, output, [] { return 42; });
+        REQUIRE(id.has_value());
+
+        WHEN("it runs for a second") {
+            run_for(scheduler, start, 1s);
+
+            THEN("the failed writes are counted in its stats") {
+                auto stats = scheduler.stats(*id);
+                CHECK(stats.fired == 100);
+                CHECK(stats.failed == 33);
+                CHECK(output.written.size() == 67);
+            }
+        }
+    }
+
+    GIVEN("A full scheduler") {
+        auto scheduler = Scheduler{Scheduler::Clock::time_point{}};
+        for ([[maybe_unused]] auto i : std::views::iota(0, 8)) {
+            REQUIRE(scheduler.add(10ms, [](Scheduler::Clock::time_point) {}).has_value());
+        }
+
+        THEN("further streams are not added") {
+            CHECK_FALSE(scheduler.add(10ms, [](Scheduler::Clock::time_point) {}).has_value());
+        }
+    }
+}
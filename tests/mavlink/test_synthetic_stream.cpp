@@ -0,0 +1,135 @@
+#include <array>
+#include <cstdint>
+#include <map>
+#include <span>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/common_messages.hpp"
+#include "mavlink/payloads/heartbeat.hpp"
+#include "mavlink/synthetic_stream.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+struct Parsed {
+    std::map<std::uint32_t, std::size_t> frames;  ///< valid frames per msgid
+    std::size_t errors = 0;
+};
+
+Parsed parse(std::span<const std::uint8_t> stream) {
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto buffer_span = std::span<std::uint8_t>(buffer);
+    auto framer = create_framer(&buffer_span, FramerOptions{CommonMessages::Entries});
+    auto parsed = Parsed{};
+    framer.push_bytes(stream, [&](const Framer::ParseResult& result) {
+        if (result) {
+            ++parsed.frames[result->msgid];
+        } else {
+            ++parsed.errors;
+        }
+    });
+    return parsed;
+}
+
+std::size_t total(const Parsed& parsed) {
+    auto frames = std::size_t{0};
+    for (const auto& [msgid, count] : parsed.frames) {
+        frames += count;
+    }
+    return frames;
+}
+
+}  // namespace
+
+SCENARIO("Synthetic Mavlink streams", "[mavlink][synthetic]") {
+    GIVEN("A clean stream of every common message from two systems") {
+        auto generator = CommonSyntheticStream{42, SyntheticFaults{}, 2};
+        auto stream = generator.generate(1 << 20);
+
+        THEN("every frame parses, and every message is in the mix at its typical rate") {
+            CHECK(stream.size() >= (1U << 20));
+            CHECK(generator.stats().bytes == stream.size());
+            CHECK(generator.stats().intact_frames == generator.stats().frames);
+            auto parsed = parse(stream);
+            CHECK(parsed.errors == 0);
+            CHECK(total(parsed) == generator.stats().frames);
+            CHECK(parsed.frames.size() == CommonMessages::Entries.size());
+            auto seconds = static_cast<double>(generator.time_us()) / 1e6;
+            CHECK(parsed.frames[Attitude::MessageId] >= static_cast<std::size_t>(2 * 25 * (seconds - 1)));
+            CHECK(parsed.frames[Heartbeat::MessageId] <= static_cast<std::size_t>(2 * (seconds + 1)));
+        }
+
+        THEN("the same seed generates the same bytes, and another seed different ones") {
+            auto same = CommonSyntheticStream{42, SyntheticFaults{}, 2};
+            CHECK(same.generate(1 << 20) == stream);
+            auto other = CommonSyntheticStream{43, SyntheticFaults{}, 2};
+            CHECK(other.generate(1 << 20) != stream);
+        }
+    }
+
+    GIVEN("A stream of ATTITUDE and HEARTBEAT at set rates") {
+        auto generator = SyntheticStream<Attitude, Heartbeat>{7};
+        generator.set_rate<Attitude>(100.0);
+        generator.set_rate<Heartbeat>(0.0);
+        auto stream = std::vector<std::uint8_t>{};
+        for ([[maybe_unused]] auto message : std::views::iota(0, 1000)) {
+            REQUIRE(generator.next(stream));
+        }
+
+        THEN("only ATTITUDE is sent, 10 ms apart") {
+            auto parsed = parse(stream);
+            CHECK(parsed.frames.size() == 1);
+            CHECK(parsed.frames[Attitude::MessageId] == 1000);
+            CHECK(generator.time_us() < 10'000'000);
+            CHECK(generator.time_us() >= 9'990'000);
+        }
+
+        THEN("stopping every payload ends the stream") {
+            generator.set_rates(0.0);
+            CHECK_FALSE(generator.next(stream));
+            CHECK(generator.generate(100).empty());
+        }
+    }
+
+    GIVEN("A stream of HEARTBEAT from every one of 255 systems") {
+        auto generator = SyntheticStream<Heartbeat>{1, SyntheticFaults{}, 255};
+        auto stream = std::vector<std::uint8_t>{};
+        REQUIRE(generator.next(stream));
+
+        THEN("each system sends one frame per message") {
+            CHECK(generator.stats().frames == 255);
+            CHECK(parse(stream).frames[Heartbeat::MessageId] == 255);
+        }
+    }
+
+    GIVEN("A stream with every kind of fault") {
+        auto faults = SyntheticFaults{0.02, 0.02, 0.02, 0.02, 64};
+        auto generator = CommonSyntheticStream{1, faults};
+        auto stream = generator.generate(1 << 20);
+        const auto& stats = generator.stats();
+
+        THEN("faults occur at about the set probabilities") {
+            auto expected = static_cast<double>(stats.frames) * 0.02;
+            for (auto count : {stats.bit_flips, stats.dropped_bytes, stats.truncations, stats.garbage_bursts}) {
+                CHECK(static_cast<double>(count) > expected * 0.8);
+                CHECK(static_cast<double>(count) < expected * 1.2);
+            }
+            CHECK(stats.garbage_bytes >= stats.garbage_bursts);
+            CHECK(stats.garbage_bytes <= stats.garbage_bursts * 64);
+            CHECK(stats.intact_frames < stats.frames);
+        }
+
+        THEN("no damaged frame is accepted, and the framer gets back in sync after the damage") {
+            auto parsed = parse(stream);
+            CHECK(parsed.errors > 0);
+            CHECK(total(parsed) <= stats.intact_frames);
+            CHECK(total(parsed) > stats.intact_frames * 8 / 10);
+        }
+    }
+}
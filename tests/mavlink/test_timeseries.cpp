@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "mavlink/deserializer.hpp"
+#include "mavlink/framer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/global_position_int.hpp"
+#include "mavlink/serializer.hpp"
+#include "mavlink/timeseries.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+/// @brief Aggregates the samples of a time range one by one.
+SeriesBucket brute_force(const TimeSeries& series, std::uint64_t begin_us, std::uint64_t end_us) {
+    auto bucket = SeriesBucket{};
+    for (auto index : std::views::iota(std::size_t{0}, series.size())) {
+        if (series[index].timestamp_us >= begin_us && series[index].timestamp_us < end_us) {
+            bucket.add(series[index].timestamp_us, series[index].value);
+        }
+    }
+    return bucket;
+}
+
+void check_same(const SeriesBucket& bucket, const SeriesBucket& expected) {
+    REQUIRE(bucket.count == expected.count);
+    if (expected.count > 0) {
+        CHECK(bucket.first_us == expected.first_us);
+        CHECK(bucket.last_us == expected.last_us);
+        CHECK(bucket.min == expected.min);
+        CHECK(bucket.min_us == expected.min_us);
+        CHECK(bucket.max == expected.max);
+        CHECK(bucket.max_us == expected.max_us);
+        CHECK(bucket.mean() == Catch::Approx(expected.mean()));
+    }
+}
+
+}  // namespace
+
+SCENARIO("Telemetry time series", "[mavlink][timeseries]") {
+    GIVEN("A series of 1000 samples that has been pushed 2500 random samples, 1 ms apart") {
+        auto rng = std::mt19937{9};
+        auto values = std::uniform_real_distribution<double>{-100.0, 100.0};
+        auto series = TimeSeries{1000};
+        for (auto sample : std::views::iota(std::uint64_t{0}, std::uint64_t{2500})) {
+            REQUIRE(series.push(sample * 1000, values(rng)));
+        }
+
+        THEN("only the latest 1000 samples are kept, and memory stays bounded") {
+            CHECK(series.size() == 1000);
+            CHECK(series[0].timestamp_us == 1'500'000);
+            CHECK(series[999].timestamp_us == 2'499'000);
+            CHECK(series.levels() == 3);
+            CHECK(series.memory() < 1000 * (sizeof(SeriesPoint) + 2 * sizeof(SeriesBucket) / (SeriesFanout - 1)));
+        }
+
+        THEN("an older sample is dropped") {
+            CHECK_FALSE(series.push(2'000'000, 0.0));
+            CHECK(series.size() == 1000);
+        }
+
+        THEN("aggregates of any range match aggregating the samples one by one") {
+            auto bounds = std::uniform_int_distribution<std::uint64_t>{1'400'000, 2'600'000};
+            for ([[maybe_unused]] auto attempt : std::views::iota(0, 200)) {
+                auto begin = bounds(rng);
+                auto end = bounds(rng);
+                check_same(series.aggregate(begin, end), brute_force(series, begin, end));
+            }
+            check_same(series.aggregate(0, 3'000'000), brute_force(series, 0, 3'000'000));
+        }
+
+        WHEN("a range is downsampled into buckets") {
+            auto buckets = std::array<SeriesBucket, 37>{};
+            series.downsample(1'234'000, 2'600'000, buckets);
+
+            THEN("each bucket aggregates its equal part of the range, and together they cover it") {
+                auto total = std::uint64_t{0};
+                for (auto bucket : std::views::iota(std::size_t{0}, buckets.size())) {
+                    auto begin = 1'234'000 + (2'600'000 - 1'234'000) * bucket / buckets.size();
+                    auto end = 1'234'000 + (2'600'000 - 1'234'000) * (bucket + 1) / buckets.size();
+                    check_same(buckets[bucket], brute_force(series, begin, end));
+                    total += buckets[bucket].count;
+                }
+                CHECK(total == 1000);
+                CHECK(buckets[0].count == 0);
+            }
+        }
+    }
+
+    GIVEN("A flat series with a single spike") {
+        auto series = TimeSeries{10'000};
+        for (auto sample : std::views::iota(std::uint64_t{0}, std::uint64_t{10'000})) {
+            series.push(sample * 100, sample == 6543 ? 50.0 : std::sin(static_cast<double>(sample) / 1000.0));
+        }
+
+        WHEN("it is decimated by LTTB") {
+            auto points = std::array<SeriesPoint, 100>{};
+            auto picked = series.lttb(0, 1'000'000, points);
+
+            THEN("the first and last samples and the spike are kept, in time order") {
+                REQUIRE(picked > 90);
+                REQUIRE(picked <= points.size());
+                CHECK(points[0].timestamp_us == 0);
+                CHECK(points[picked - 1].timestamp_us == 999'900);
+                CHECK(std::ranges::is_sorted(std::span(points).first(picked), std::less{}, &SeriesPoint::timestamp_us));
+                auto spike = std::ranges::find(points, 654'300, &SeriesPoint::timestamp_us);
+                REQUIRE(spike != points.end());
+                CHECK(spike->value == 50.0);
+                for (const auto& point : std::span(points).first(picked)) {
+                    CHECK(series[point.timestamp_us / 100].value == point.value);
+                }
+            }
+        }
+
+        WHEN("a range with fewer samples than points is decimated") {
+            auto points = std::array<SeriesPoint, 100>{};
+            auto picked = series.lttb(1000, 3000, points);
+
+            THEN("every sample is returned") {
+                REQUIRE(picked == 20);
+                CHECK(points[0].timestamp_us == 1000);
+                CHECK(points[19].timestamp_us == 2900);
+            }
+        }
+    }
+}
+
+SCENARIO("Telemetry store", "[mavlink][timeseries]") {
+    GIVEN("A store tracking ATTITUDE roll of system 1 and GLOBAL_POSITION_INT altitude of systems 1 and 2") {
+        auto store = TelemetryStore{};
+        store.track<Attitude, 1>(1, 600);
+        store.track<GlobalPositionInt, 3>(1, 600);
+        store.track<GlobalPositionInt, 3>(2, 60);
+
+        WHEN("payloads are added") {
+            for (auto second : std::views::iota(std::uint32_t{0}, std::uint32_t{100})) {
+                auto att = LazyAttitude{};
+                att.roll.value = static_cast<float>(second) / 100.0f;
+                CHECK(store.add(1, second * 1'000'000ULL, att) == 1);
+                CHECK(store.add(2, second * 1'000'000ULL, att) == 0);
+
+                auto pos = GlobalPositionInt{};
+                pos.alt.value = static_cast<std::int32_t>(second * 1000);
+                auto buffer = std::array<std::uint8_t, 280>{};
+                auto length = serialize(pos, 2, 1, 0, buffer);
+                auto view = deserialize<ViewGlobalPositionInt>(
+                    parse_frame(std::span<const std::uint8_t>(buffer).first(*length)));
+                REQUIRE(view.has_value());
+                CHECK(store.add(2, second * 1'000'000ULL, *view) == 1);
+            }
+
+            THEN("each tracked field has its series, with its own capacity") {
+                CHECK(store.size() == 3);
+                REQUIRE(store.find<Attitude, 1>(1) != nullptr);
+                CHECK(store.find<Attitude, 1>(1)->size() == 100);
+                CHECK(store.find<Attitude, 1>(1)->aggregate(0, 10'000'000).max == Catch::Approx(0.09));
+                CHECK(store.find<Attitude, 2>(1) == nullptr);
+                CHECK(store.find<GlobalPositionInt, 3>(1)->size() == 0);
+                REQUIRE(store.find<GlobalPositionInt, 3>(2) != nullptr);
+                CHECK(store.find<GlobalPositionInt, 3>(2)->size() == 60);
+                CHECK((*store.find<GlobalPositionInt, 3>(2))[59].value == 99'000.0);
+            }
+
+            THEN("untracking a field releases it") {
+                auto memory = store.memory();
+                store.untrack(SeriesKey{GlobalPositionInt::MessageId, 1, 3});
+                CHECK(store.size() == 2);
+                CHECK(store.memory() < memory);
+            }
+        }
+    }
+}
@@ -0,0 +1,219 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mavlink/deserializer.hpp"
+#include "mavlink/payloads/attitude.hpp"
+#include "mavlink/payloads/common_messages.hpp"
+#include "mavlink/payloads/global_position_int.hpp"
+#include "mavlink/payloads/param_value.hpp"
+#include "mavlink/serializer.hpp"
+#include "mavlink/tlog.hpp"
+#include "temporary_file.hpp"
+
+using namespace mavlink;
+using namespace mavlink::payloads;
+
+namespace {
+
+// Appends one GlobalPositionInt from each of systems 1 and 2, and an Attitude from system 1, per second.
+void write_seconds(TlogWriter& writer, std::uint64_t first, std::uint64_t last) {
+    auto buffer = std::array<std::uint8_t, 280>{};
+    for (auto second = first; second < last; ++second) {
+        auto timestamp = second * 1'000'000;
+        for (auto sysid : {std::uint8_t{1}, std::uint8_t{2}}) {
+            auto position = GlobalPositionInt{};
+            position.time_boot_ms.value = static_cast<std::uint32_t>(second * 1000);
+            position.lat.value = static_cast<std::int32_t>(sysid);
+            auto length = serialize(position, sysid, 1, 0, buffer);
+            REQUIRE(writer.write(std::span<const std::uint8_t>(buffer).first(*length), timestamp + sysid).has_value());
+        }
+        auto attitude = Attitude{};
+        auto length = serialize(attitude, 1, 1, 0, buffer);
+        REQUIRE(writer.write(std::span<const std::uint8_t>(buffer).first(*length), timestamp + 500).has_value());
+    }
+}
+
+std::vector<std::uint32_t> positions_of(const TlogReader& reader, std::uint8_t sysid, std::uint64_t begin_s,
+                                        std::uint64_t end_s) {
+    auto times = std::vector<std::uint32_t>{};
+    reader.query(TlogQuery{GlobalPositionInt::MessageId, sysid, begin_s * 1'000'000, end_s * 1'000'000},
+                 [&](const TlogRecord& record) {
+                     auto position = deserialize<LazyGlobalPositionInt>(record.view);
+                     REQUIRE(position.has_value());
+                     CHECK(position->lat.value == sysid);
+                     times.push_back(position->time_boot_ms.value);
+                 });
+    return times;
+}
+
+// Builds a ~6 MiB tlog in memory whose payloads are full of start-of-frame markers, with corrupt stretches between
+// some records.
+std::vector<std::uint8_t> make_noisy_tlog() {
+    auto tlog = std::vector<std::uint8_t>{};
+    auto buffer = std::array<std::uint8_t, 280>{};
+    auto param = ParamValue{};
+    param.param_id.value.fill(static_cast<char>(MagicV2));
+    for (auto record = std::uint32_t{0}; tlog.size() < (6U << 20); ++record) {
+        param.param_index.value = static_cast<std::uint16_t>(record);
+        param.param_value.value = (record % 3 == 0) ? -1.0f : 1.0f;
+        auto length = serialize(param, static_cast<std::uint8_t>(record % 4), 1, 0, buffer);
+        for (auto shift : {56, 48, 40, 32, 24, 16, 8, 0}) {
+            tlog.push_back(static_cast<std::uint8_t>((std::uint64_t{record} * 1000) >> shift));
+        }
+        tlog.insert(tlog.end(), buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(*length));
+        if (record % 9973 == 0) {
+            tlog.insert(tlog.end(), {MagicV2, 3, 0, 0, MagicV1, 0x55});
+        }
+    }
+    return tlog;
+}
+
+}  // namespace
+
+SCENARIO("Mavlink tlog reading and writing", "[mavlink][tlog]") {
+    GIVEN("A tlog of ten seconds from two systems") {
+        auto tlog = TemporaryFile{".tlog", {".idx"}};
+        auto writer = TlogWriter{tlog.path.string()};
+        REQUIRE(writer.open().has_value());
+        write_seconds(writer, 0, 10);
+        writer.close();
+
+        auto reader = TlogReader{tlog.path.string()};
+        REQUIRE(reader.open().has_value());
+
+        THEN("every record is indexed and the index is stored next to the tlog") {
+            CHECK(reader.size() == 30);
+            CHECK(reader.index()[2].msgid == Attitude::MessageId);
+            CHECK(reader.index()[2].timestamp_us == 500);
+            CHECK(std::filesystem::exists(tlog.sidecars.front()));
+        }
+
+        THEN("a query selects the records of one message and system in a time range") {
+            CHECK(positions_of(reader, 1, 3, 6) == std::vector<std::uint32_t>{3000, 4000, 5000});
+            CHECK(positions_of(reader, 2, 9, 20) == std::vector<std::uint32_t>{9000});
+        }
+
+        THEN("a query without a msgid visits every message in the time range") {
+            auto count = reader.query(TlogQuery{.begin_us = 2'000'000, .end_us = 4'000'000},
+                                      []([[maybe_unused]] const TlogRecord& record) {});
+            CHECK(count == 6);
+        }
+
+        WHEN("records are appended and the tlog is opened again") {
+            REQUIRE(writer.open().has_value());
+            write_seconds(writer, 10, 12);
+            writer.close();
+            REQUIRE(reader.open().has_value());
+
+            THEN("the stored index is extended with the new records") {
+                CHECK(reader.size() == 36);
+                CHECK(positions_of(reader, 1, 9, 20) == std::vector<std::uint32_t>{9000, 10000, 11000});
+                auto again = TlogReader{tlog.path.string()};
+                REQUIRE(again.open().has_value());
+                CHECK(again.size() == 36);
+            }
+        }
+
+        WHEN("the tlog ends in a cut-off record and has garbage between records") {
+            auto bytes = std::vector<char>(std::filesystem::file_size(tlog.path));
+            std::ifstream(tlog.path, std::ios::binary).read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+            auto second_record = static_cast<std::ptrdiff_t>(reader.index()[1].offset);
+            bytes.insert(bytes.begin() + second_record, {'\x00', '\x13', '\x37'});
+            bytes.resize(bytes.size() - 3);
+            std::ofstream(tlog.path, std::ios::binary | std::ios::trunc)
+                .write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+            REQUIRE(reader.open().has_value());
+
+            THEN("the garbage is skipped and the cut-off record is left out") {
+                CHECK(reader.size() == 29);
+                CHECK(reader.index()[1].offset == static_cast<std::uint64_t>(second_record) + 3);
+                CHECK(positions_of(reader, 2, 0, 20).size() == 10);
+            }
+        }
+    }
+
+    GIVEN("A tlog of two captures concatenated out of order") {
+        auto tlog = TemporaryFile{".tlog", {".idx"}};
+        auto writer = TlogWriter{tlog.path.string()};
+        REQUIRE(writer.open().has_value());
+        write_seconds(writer, 5, 10);
+        write_seconds(writer, 0, 5);
+        writer.close();
+
+        auto reader = TlogReader{tlog.path.string()};
+        REQUIRE(reader.open().has_value());
+
+        THEN("the index stays in file order") {
+            CHECK(reader.index().front().timestamp_us == 5'000'001);
+        }
+
+        THEN("queries visit the records in timestamp order") {
+            auto timestamps = std::vector<std::uint64_t>{};
+            auto count = reader.query(TlogQuery{.begin_us = 3'000'000, .end_us = 7'000'000},
+                                      [&](const TlogRecord& record) { timestamps.push_back(record.timestamp_us); });
+            CHECK(count == 12);
+            CHECK(std::ranges::is_sorted(timestamps));
+            CHECK(timestamps.front() == 3'000'001);
+            CHECK(positions_of(reader, 1, 0, 20).size() == 10);
+            CHECK(std::ranges::is_sorted(positions_of(reader, 1, 0, 20)));
+        }
+    }
+
+    GIVEN("A writer and a frame longer than a record can hold") {
+        auto tlog = TemporaryFile{".tlog", {".idx"}};
+        auto writer = TlogWriter{tlog.path.string()};
+        REQUIRE(writer.open().has_value());
+        auto frame = std::vector<std::uint8_t>(MaxTlogRecordLength);
+
+        THEN("the frame is rejected") { CHECK_FALSE(writer.write(frame, std::uint64_t{0}).has_value()); }
+    }
+}
+
+SCENARIO("Parallel Mavlink tlog scanning", "[mavlink][tlog]") {
+    GIVEN("A large tlog with false start-of-frame markers and corrupt stretches") {
+        static const auto tlog = make_noisy_tlog();
+        auto options = FramerOptions{CommonMessages::Entries};
+
+        WHEN("it is scanned on one thread and on several") {
+            auto serial = scan_tlog(tlog, 0, options, 1);
+            auto parallel = scan_tlog(tlog, 0, options, 8);
+            auto unchecked = scan_tlog(tlog, 0, FramerOptions{}, 8);
+
+            THEN("every record is found once, in file order, whatever the thread count") {
+                REQUIRE(serial.entries.size() == parallel.entries.size());
+                CHECK(serial.end == tlog.size());
+                CHECK(parallel.end == tlog.size());
+                auto same = std::ranges::equal(serial.entries, parallel.entries, [](const auto& lhs, const auto& rhs) {
+                    return lhs.offset == rhs.offset && lhs.timestamp_us == rhs.timestamp_us;
+                });
+                CHECK(same);
+                CHECK(std::ranges::is_sorted(parallel.entries, std::less{}, &TlogIndexEntry::timestamp_us));
+                CHECK(parallel.entries.back().timestamp_us == (parallel.entries.size() - 1) * 1000);
+            }
+
+            THEN("without checksums the next-record check still rejects the false markers") {
+                CHECK(unchecked.entries.size() == serial.entries.size());
+            }
+        }
+
+        WHEN("the tlog is cut off in its last record") {
+            auto cut = std::span(tlog).first(tlog.size() - 5);
+            auto scan = scan_tlog(cut, 0, options, 8);
+
+            THEN("the scan stops at the cut-off record") {
+                REQUIRE_FALSE(scan.entries.empty());
+                CHECK(scan.end == scan.entries.back().offset + TlogTimestampLength + scan.entries.back().length);
+                CHECK(scan.end < cut.size());
+            }
+        }
+    }
+}
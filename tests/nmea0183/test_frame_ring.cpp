@@ -0,0 +1,119 @@
+#include <array>
+#include <initializer_list>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "nmea0183/frame_ring.hpp"
+#include "nmea0183/framer.hpp"
+#include "nmea0183/types.hpp"
+
+using namespace std::string_literals;
+
+namespace {
+
+constexpr std::string_view Gga = "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47\r\n";
+constexpr std::string_view Hdt = "$HEHDT,274.07,T*19\r\n";
+
+// Pushes sentences into the framer and collects every result.
+std::vector<nmea0183::Framer::ParseResult> push_sentences(nmea0183::Framer& framer,
+                                                          std::initializer_list<std::string_view> sentences) {
+    auto results = std::vector<nmea0183::Framer::ParseResult>{};
+    for (auto sentence : sentences) {
+        for (char c : sentence) {
+            if (auto yielded = framer.push_byte(c)) {
+                results.push_back(*yielded);
+            }
+        }
+    }
+    return results;
+}
+
+}  // namespace
+
+SCENARIO("NMEA-0183 frame ring", "[framer][ring]") {
+    GIVEN("Slot storage of various sizes") {
+        THEN("a ring needs at least two slots, known at compile time") {
+            STATIC_CHECK(std::is_constructible_v<nmea0183::FrameRing, std::array<nmea0183::FrameSlot, 2>&>);
+            STATIC_CHECK(std::is_constructible_v<nmea0183::FrameRing, std::span<nmea0183::FrameSlot, 2>>);
+            STATIC_CHECK_FALSE(std::is_constructible_v<nmea0183::FrameRing, std::array<nmea0183::FrameSlot, 1>&>);
+            STATIC_CHECK_FALSE(std::is_constructible_v<nmea0183::FrameRing, std::array<nmea0183::FrameSlot, 0>&>);
+            STATIC_CHECK_FALSE(std::is_constructible_v<nmea0183::FrameRing, std::span<nmea0183::FrameSlot, 1>>);
+            STATIC_CHECK_FALSE(std::is_constructible_v<nmea0183::FrameRing, std::span<nmea0183::FrameSlot>>);
+        }
+    }
+
+    GIVEN("A framer receiving into a ring of three slots") {
+        auto slots = std::array<nmea0183::FrameSlot, 3>{};
+        auto ring = nmea0183::FrameRing{slots};
+        auto framer = nmea0183::create_framer(ring);
+
+        WHEN("two sentences are pushed and neither is released") {
+            auto results = push_sentences(framer, {Gga, Hdt});
+
+            THEN("both views stay valid, each in its own slot") {
+                REQUIRE(results.size() == 2);
+                REQUIRE(results[0].has_value());
+                REQUIRE(results[1].has_value());
+                CHECK(ring.held() == 2);
+
+                const auto& gga = results[0].value();
+                CHECK(std::string(gga.message_type) == "GGA"s);
+                CHECK(gga.talker_id.data() == slots[0].bytes.data());
+                CHECK(std::string(gga.fields[0]) == "123519"s);
+                CHECK(std::string(gga.fields[10]) == "46.9"s);
+
+                const auto& hdt = results[1].value();
+                CHECK(hdt.talker_id.data() == slots[1].bytes.data());
+                CHECK(std::string(hdt.fields[0]) == "274.07"s);
+            }
+
+            THEN("a third sentence is refused until a view is released") {
+                auto refused = push_sentences(framer, {Hdt});
+                REQUIRE(refused.size() == 1);
+                REQUIRE_FALSE(refused[0].has_value());
+                CHECK(refused[0].error().first == 1);
+
+                ring.release(results[0].value());
+                CHECK(ring.held() == 1);
+                auto accepted = push_sentences(framer, {Hdt});
+                REQUIRE(accepted.size() == 1);
+                REQUIRE(accepted[0].has_value());
+                CHECK(accepted[0]->talker_id.data() == slots[2].bytes.data());
+                CHECK(std::string(results[1]->fields[0]) == "274.07"s);
+            }
+        }
+
+        WHEN("every view is released as soon as it is handled") {
+            auto count = 0;
+            for (auto round = 0; round < 10; ++round) {
+                for (const auto& result : push_sentences(framer, {Gga, Hdt})) {
+                    REQUIRE(result.has_value());
+                    ring.release(*result);
+                    ++count;
+                }
+            }
+
+            THEN("the slots are reused and none is left held") {
+                CHECK(count == 20);
+                CHECK(ring.held() == 0);
+            }
+        }
+
+        WHEN("a sentence is corrupted") {
+            auto results = push_sentences(framer, {"$HEHDT,274.07,T*18\r\n", Hdt});
+
+            THEN("its slot is not held and is reused for the next sentence") {
+                REQUIRE(results.size() == 2);
+                CHECK_FALSE(results[0].has_value());
+                REQUIRE(results[1].has_value());
+                CHECK(results[1]->talker_id.data() == slots[0].bytes.data());
+                CHECK(ring.held() == 1);
+            }
+        }
+    }
+}
@@ -1,5 +1,8 @@
 #include <array>
+#include <cstddef>
 #include <expected>
+#include <memory>
+#include <memory_resource>
 #include <string_view>
 #include <vector>
 
@@ -23,6 +26,32 @@ auto push_string(nmea0183::Framer& framer, std::string_view sv) -> nmea0183::Fra
     return std::nullopt;
 }
 
+namespace {
+
+// Memory resource counting the blocks it hands out from an upstream resource.
+class CountingResource : public std::pmr::memory_resource {
+   public:
+    explicit CountingResource(std::pmr::memory_resource* upstream) : upstream_(upstream) {}
+
+    std::size_t allocations = 0;
+    std::size_t deallocations = 0;
+
+   private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocations;
+        return upstream_->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        ++deallocations;
+        upstream_->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    std::pmr::memory_resource* upstream_;
+};
+
+}  // namespace
+
 SCENARIO("NMEA-0183 Message Framing", "[framer]") {
     GIVEN("A NMEA-0183 framer and a buffer") {
         std::array<char, 256> buffer;
@@ -130,3 +159,44 @@ SCENARIO("NMEA-0183 Message Framing", "[framer]") {
         }
     }
 }
+
+SCENARIO("NMEA-0183 framer allocation", "[framer]") {
+    GIVEN("A memory resource over a fixed arena, with no heap behind it") {
+        auto arena = std::array<std::byte, 4096>{};
+        auto monotonic =
+            std::pmr::monotonic_buffer_resource(arena.data(), arena.size(), std::pmr::null_memory_resource());
+        auto resource = CountingResource(&monotonic);
+        std::array<char, 256> buffer;
+        std::span<char> buffer_span(buffer);
+
+        WHEN("a framer is created from it, used and destroyed") {
+            auto result = nmea0183::Framer::YieldedValue{};
+            {
+                auto framer = nmea0183::create_framer(std::allocator_arg, &resource, &buffer_span);
+                result = push_string(framer, "$HEHDT,274.07,T*19\r\n");
+                CHECK(resource.allocations == 1);
+                CHECK(resource.deallocations == 0);
+            }
+
+            THEN("its coroutine frame came from the arena and went back to it") {
+                REQUIRE(result.has_value());
+                CHECK(result->has_value());
+                CHECK(resource.allocations == 1);
+                CHECK(resource.deallocations == 1);
+            }
+        }
+
+        WHEN("it is the default resource and a framer is created without one") {
+            auto* previous = std::pmr::set_default_resource(&resource);
+            {
+                auto framer = nmea0183::create_framer(&buffer_span);
+            }
+            std::pmr::set_default_resource(previous);
+
+            THEN("the framer is allocated from it") {
+                CHECK(resource.allocations == 1);
+                CHECK(resource.deallocations == 1);
+            }
+        }
+    }
+}
@@ -0,0 +1,141 @@
+#include <array>
+#include <map>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "nmea0183/deserializer.hpp"
+#include "nmea0183/framer.hpp"
+#include "nmea0183/payloads/gga.hpp"
+#include "nmea0183/payloads/hdt.hpp"
+#include "nmea0183/payloads/rmc.hpp"
+#include "nmea0183/synthetic_stream.hpp"
+
+using namespace nmea0183;
+using namespace nmea0183::payloads;
+
+namespace {
+
+struct Parsed {
+    std::map<std::string, std::size_t> sentences;  ///< valid sentences per type
+    std::size_t errors = 0;
+    std::size_t unbound = 0;  ///< valid sentences that did not bind to their payload
+};
+
+Parsed parse(std::span<const char> stream) {
+    auto buffer = std::array<char, 256>{};
+    auto buffer_span = std::span<char>(buffer);
+    auto framer = create_framer(&buffer_span);
+    auto parsed = Parsed{};
+    for (auto c : stream) {
+        if (auto result = framer.push_byte(c)) {
+            if (*result) {
+                const auto& view = result->value();
+                ++parsed.sentences[std::string(view.message_type)];
+                if (view.message_type == "GGA" && !bind<LazyGGA>(view)) {
+                    ++parsed.unbound;
+                }
+            } else {
+                ++parsed.errors;
+            }
+        }
+    }
+    return parsed;
+}
+
+std::size_t total(const Parsed& parsed) {
+    auto sentences = std::size_t{0};
+    for (const auto& [type, count] : parsed.sentences) {
+        sentences += count;
+    }
+    return sentences;
+}
+
+}  // namespace
+
+SCENARIO("Synthetic NMEA-0183 streams", "[nmea0183][synthetic]") {
+    GIVEN("A clean stream of every sentence") {
+        auto generator = GnssSyntheticStream{42};
+        auto stream = generator.generate(1 << 18);
+
+        THEN("every sentence parses and binds, and every type is in the mix at its typical rate") {
+            CHECK(generator.stats().bytes == stream.size());
+            CHECK(generator.stats().intact_sentences == generator.stats().sentences);
+            auto parsed = parse(stream);
+            CHECK(parsed.errors == 0);
+            CHECK(parsed.unbound == 0);
+            CHECK(total(parsed) == generator.stats().sentences);
+            CHECK(parsed.sentences.size() == 12);
+            auto seconds = static_cast<double>(generator.time_us()) / 1e6;
+            CHECK(parsed.sentences["HDT"] >= static_cast<std::size_t>(10 * (seconds - 1)));
+            CHECK(parsed.sentences["GGA"] <= static_cast<std::size_t>(seconds + 1));
+        }
+
+        THEN("no sentence is longer than the 82 characters NMEA 0183 allows") {
+            auto start = std::size_t{0};
+            for (auto index = std::size_t{0}; index < stream.size(); ++index) {
+                if (stream[index] == '\n') {
+                    CHECK(index + 1 - start <= 82);
+                    start = index + 1;
+                }
+            }
+        }
+
+        THEN("the same seed generates the same bytes, and another seed different ones") {
+            auto same = GnssSyntheticStream{42};
+            CHECK(same.generate(1 << 18) == stream);
+            auto other = GnssSyntheticStream{43};
+            CHECK(other.generate(1 << 18) != stream);
+        }
+    }
+
+    GIVEN("A stream of GGA and RMC at set rates") {
+        auto generator = SyntheticStream<"GN", GGA, RMC>{7};
+        generator.set_rate<GGA>(5.0);
+        generator.set_rate<RMC>(0.0);
+        auto stream = std::vector<char>{};
+        for ([[maybe_unused]] auto sentence : std::views::iota(0, 100)) {
+            REQUIRE(generator.next(stream));
+        }
+
+        THEN("only GGA is sent, 200 ms apart, with the talker ID") {
+            auto parsed = parse(stream);
+            CHECK(parsed.sentences.size() == 1);
+            CHECK(parsed.sentences["GGA"] == 100);
+            CHECK(std::string(stream.begin(), stream.begin() + 6) == "$GNGGA");
+            CHECK(generator.time_us() < 20'000'000);
+            CHECK(generator.time_us() >= 19'800'000);
+        }
+
+        THEN("stopping every sentence ends the stream") {
+            generator.set_rates(0.0);
+            CHECK_FALSE(generator.next(stream));
+            CHECK(generator.generate(100).empty());
+        }
+    }
+
+    GIVEN("A stream with every kind of fault") {
+        auto faults = SyntheticFaults{0.02, 0.02, 0.02, 0.02, 64};
+        auto generator = GnssSyntheticStream{1, faults};
+        auto stream = generator.generate(1 << 20);
+        const auto& stats = generator.stats();
+
+        THEN("faults occur at about the set probabilities") {
+            auto expected = static_cast<double>(stats.sentences) * 0.02;
+            for (auto count : {stats.bit_flips, stats.dropped_bytes, stats.truncations, stats.garbage_bursts}) {
+                CHECK(static_cast<double>(count) > expected * 0.8);
+                CHECK(static_cast<double>(count) < expected * 1.2);
+            }
+            CHECK(stats.garbage_bytes >= stats.garbage_bursts);
+            CHECK(stats.garbage_bytes <= stats.garbage_bursts * 64);
+        }
+
+        THEN("the framer reports errors and recovers most intact sentences") {
+            auto parsed = parse(stream);
+            CHECK(parsed.errors > 0);
+            CHECK(total(parsed) > stats.intact_sentences * 8 / 10);
+        }
+    }
+}
@@ -0,0 +1,150 @@
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "uart/posixtcp.hpp"
+#include "uart/uart.hpp"
+
+using namespace std::chrono_literals;
+
+namespace {
+
+/// @brief Reads until count bytes have arrived or a read times out.
+std::vector<std::uint8_t> read_bytes(auto& socket, std::size_t count) {
+    auto received = std::vector<std::uint8_t>{};
+    auto buffer = std::array<std::uint8_t, 512>{};
+    while (received.size() < count) {
+        auto result = socket.read(buffer, count - received.size());
+        if (!result || *result == 0) {
+            break;
+        }
+        received.insert(received.end(), buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(*result));
+    }
+    return received;
+}
+
+}  // namespace
+
+SCENARIO("PosixTCP Communication via loopback", "[uart][posix][tcp]") {
+    GIVEN("A tcpin server on an ephemeral loopback port") {
+        auto server = uart::PosixTCP{"tcpin:127.0.0.1:0"};
+        REQUIRE(server.open().has_value());
+        REQUIRE(server.set_timeout(200ms).has_value());
+        REQUIRE(server.port() != 0);
+
+        THEN("it has no client to write to, and reads time out with 0 bytes") {
+            CHECK_FALSE(server.is_connected());
+            auto write = server.write(std::array<std::uint8_t, 3>{1, 2, 3});
+            REQUIRE_FALSE(write.has_value());
+            CHECK(write.error().first == ENOTCONN);
+            auto buffer = std::array<std::uint8_t, 16>{};
+            auto read = server.read(buffer, buffer.size());
+            REQUIRE(read.has_value());
+            CHECK(*read == 0);
+        }
+
+        AND_GIVEN("a tcp client connected to it") {
+            auto client = std::make_unique<uart::PosixTCP>("tcp:127.0.0.1:" + std::to_string(server.port()));
+            REQUIRE(client->open().has_value());
+            REQUIRE(client->set_timeout(200ms).has_value());
+            CHECK(client->is_connected());
+
+            WHEN("the client writes") {
+                auto sent = client->write(std::array<std::uint8_t, 5>{0xFD, 0x09, 0x00, 0x00, 0x00});
+                REQUIRE(sent.has_value());
+                CHECK(*sent == 5);
+
+                THEN("the server accepts it and reads the bytes, and can answer") {
+                    CHECK(read_bytes(server, 5) == std::vector<std::uint8_t>{0xFD, 0x09, 0x00, 0x00, 0x00});
+                    CHECK(server.is_connected());
+
+                    auto reply = server.write(std::array<std::uint8_t, 2>{0xAA, 0xBB});
+                    REQUIRE(reply.has_value());
+                    CHECK(read_bytes(*client, 2) == std::vector<std::uint8_t>{0xAA, 0xBB});
+                }
+
+                AND_WHEN("the client disconnects") {
+                    CHECK(read_bytes(server, 5).size() == 5);
+                    client.reset();
+
+                    THEN("the server drops it and accepts the next client") {
+                        auto buffer = std::array<std::uint8_t, 16>{};
+                        auto read = server.read(buffer, buffer.size());
+                        REQUIRE(read.has_value());
+                        CHECK(*read == 0);
+                        CHECK_FALSE(server.is_connected());
+
+                        auto next = uart::PosixTCP{"tcp:127.0.0.1:" + std::to_string(server.port())};
+                        REQUIRE(next.open().has_value());
+                        REQUIRE(next.write(std::string{"again"}).has_value());
+                        CHECK(read_bytes(server, 5) == std::vector<std::uint8_t>{'a', 'g', 'a', 'i', 'n'});
+                    }
+                }
+            }
+
+            WHEN("the server closes") {
+                CHECK(server.write(std::string{"x"}).has_value());
+                server.close();
+
+                THEN("the client reads what was sent, then sees the connection closed") {
+                    CHECK(read_bytes(*client, 1) == std::vector<std::uint8_t>{'x'});
+                    auto buffer = std::array<std::uint8_t, 16>{};
+                    auto read = client->read(buffer, buffer.size());
+                    REQUIRE_FALSE(read.has_value());
+                    CHECK(read.error().first == ECONNRESET);
+                    CHECK_FALSE(client->is_connected());
+                }
+            }
+        }
+    }
+
+    GIVEN("A tcp client wrapped in UART, talking to a tcpin server") {
+        auto server = uart::PosixTCP{"tcpin:127.0.0.1:0"};
+        REQUIRE(server.open().has_value());
+        REQUIRE(server.set_timeout(200ms).has_value());
+        auto link = uart::UART<uart::PosixTCP>{"tcp:127.0.0.1:" + std::to_string(server.port())};
+        REQUIRE(link.open().has_value());
+        REQUIRE(link.set_timeout(200ms).has_value());
+
+        WHEN("the wrapper writes") {
+            REQUIRE(link.write(std::string{"heartbeat"}).has_value());
+
+            THEN("the server reads it") {
+                auto received = read_bytes(server, 9);
+                CHECK(std::string(received.begin(), received.end()) == "heartbeat");
+            }
+        }
+    }
+
+    GIVEN("A port nobody listens on") {
+        auto server = uart::PosixTCP{"tcpin:127.0.0.1:0"};
+        REQUIRE(server.open().has_value());
+        auto port = server.port();
+        server.close();
+
+        THEN("connecting fails with ECONNREFUSED") {
+            auto client = uart::PosixTCP{"tcp:127.0.0.1:" + std::to_string(port)};
+            auto result = client.open();
+            REQUIRE_FALSE(result.has_value());
+            CHECK(result.error().first == ECONNREFUSED);
+            CHECK_FALSE(client.is_open());
+        }
+    }
+
+    GIVEN("Malformed device names") {
+        THEN("opening fails with EINVAL") {
+            for (auto name : {"tcp:5760", "udpin:127.0.0.1:14550", "tcp:127.0.0.1:notaport"}) {
+                auto client = uart::PosixTCP{name};
+                auto result = client.open();
+                REQUIRE_FALSE(result.has_value());
+                CHECK(result.error().first == EINVAL);
+            }
+        }
+    }
+}
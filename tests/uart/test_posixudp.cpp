@@ -0,0 +1,149 @@
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "uart/posixudp.hpp"
+#include "uart/uart.hpp"
+
+using namespace std::chrono_literals;
+
+namespace {
+
+/// @brief Reads until count bytes have arrived or a read times out.
+std::vector<std::uint8_t> read_bytes(auto& socket, std::size_t count, std::size_t chunk = 512) {
+    auto received = std::vector<std::uint8_t>{};
+    auto buffer = std::vector<std::uint8_t>(chunk);
+    while (received.size() < count) {
+        auto result = socket.read(buffer, buffer.size());
+        if (!result || *result == 0) {
+            break;
+        }
+        received.insert(received.end(), buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(*result));
+    }
+    return received;
+}
+
+}  // namespace
+
+SCENARIO("PosixUDP Communication via loopback", "[uart][posix][udp]") {
+    GIVEN("A udpin socket on an ephemeral loopback port") {
+        auto ground = uart::PosixUDP{"udpin:127.0.0.1:0"};
+        REQUIRE(ground.open().has_value());
+        REQUIRE(ground.set_timeout(200ms).has_value());
+        REQUIRE(ground.port() != 0);
+
+        THEN("it has no peer to write to until something arrives") {
+            CHECK_FALSE(ground.has_peer());
+            auto result = ground.write(std::array<std::uint8_t, 3>{1, 2, 3});
+            REQUIRE_FALSE(result.has_value());
+            CHECK(result.error().first == EDESTADDRREQ);
+        }
+
+        THEN("a read with nothing sent times out with 0 bytes") {
+            auto buffer = std::array<std::uint8_t, 16>{};
+            auto result = ground.read(buffer, buffer.size());
+            REQUIRE(result.has_value());
+            CHECK(*result == 0);
+        }
+
+        AND_GIVEN("a udpout socket sending to it") {
+            auto vehicle = uart::PosixUDP{"udpout:127.0.0.1:" + std::to_string(ground.port())};
+            REQUIRE(vehicle.open().has_value());
+            REQUIRE(vehicle.set_timeout(200ms).has_value());
+            CHECK(vehicle.has_peer());
+
+            WHEN("the vehicle writes a datagram") {
+                auto sent = vehicle.write(std::array<std::uint8_t, 5>{0xFD, 1, 2, 3, 4});
+                REQUIRE(sent.has_value());
+                CHECK(*sent == 5);
+
+                THEN("the ground reads it, and can answer the sender") {
+                    auto received = read_bytes(ground, 5);
+                    CHECK(received == std::vector<std::uint8_t>{0xFD, 1, 2, 3, 4});
+                    CHECK(ground.has_peer());
+
+                    auto reply = ground.write(std::array<std::uint8_t, 2>{0xAA, 0xBB});
+                    REQUIRE(reply.has_value());
+                    CHECK(read_bytes(vehicle, 2) == std::vector<std::uint8_t>{0xAA, 0xBB});
+                }
+            }
+
+            WHEN("the vehicle sends 200 datagrams in batches") {
+                auto payloads = std::vector<std::vector<std::uint8_t>>{};
+                auto expected = std::vector<std::uint8_t>{};
+                for (auto index = 0; index < 200; ++index) {
+                    auto& payload = payloads.emplace_back(static_cast<std::size_t>(10 + index % 30));
+                    for (auto& byte : payload) {
+                        byte = static_cast<std::uint8_t>(index);
+                    }
+                    expected.insert(expected.end(), payload.begin(), payload.end());
+                }
+                auto datagrams = std::vector<std::span<const std::byte>>{};
+                for (const auto& payload : payloads) {
+                    datagrams.push_back(std::as_bytes(std::span(payload)));
+                }
+                auto sent = vehicle.write_datagrams(datagrams);
+                REQUIRE(sent.has_value());
+                CHECK(*sent == 200);
+
+                THEN("the ground reads every byte in order, also into a buffer smaller than a datagram") {
+                    CHECK(read_bytes(ground, expected.size(), 7) == expected);
+                }
+            }
+        }
+
+        WHEN("it is closed") {
+            ground.close();
+
+            THEN("reads and writes fail") {
+                CHECK_FALSE(ground.is_open());
+                auto buffer = std::array<std::uint8_t, 1>{};
+                auto read = ground.read(buffer, 1);
+                REQUIRE_FALSE(read.has_value());
+                CHECK(read.error().first == EBADF);
+                auto write = ground.write(buffer);
+                REQUIRE_FALSE(write.has_value());
+                CHECK(write.error().first == EBADF);
+            }
+        }
+    }
+
+    GIVEN("A udpin socket wrapped in UART") {
+        auto socket = std::make_shared<uart::PosixUDP>("udpin:127.0.0.1:0");
+        auto link = uart::UART<uart::PosixUDP>{socket};
+        REQUIRE(link.open().has_value());
+        REQUIRE(link.set_timeout(200ms).has_value());
+
+        WHEN("a datagram is sent to it") {
+            auto vehicle = uart::PosixUDP{"udpout:127.0.0.1:" + std::to_string(socket->port())};
+            REQUIRE(vehicle.open().has_value());
+            REQUIRE(vehicle.write(std::string{"heartbeat"}).has_value());
+
+            THEN("it is read through the wrapper") {
+                auto buffer = std::array<char, 32>{};
+                auto result = link.read(buffer, buffer.size());
+                REQUIRE(result.has_value());
+                CHECK(std::string(buffer.data(), *result) == "heartbeat");
+            }
+        }
+    }
+
+    GIVEN("Malformed device names") {
+        THEN("opening fails with EINVAL") {
+            for (auto name : {"udpin:14550", "udpin:127.0.0.1:", "tcp:127.0.0.1:14550", "udpin:127.0.0.1:notaport"}) {
+                auto socket = uart::PosixUDP{name};
+                auto result = socket.open();
+                REQUIRE_FALSE(result.has_value());
+                CHECK(result.error().first == EINVAL);
+                CHECK_FALSE(socket.is_open());
+            }
+        }
+    }
+}